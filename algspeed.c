@@ -0,0 +1,299 @@
+/*
+ * Placed in the public domain.
+ *
+ * Local throughput calibration for "Ciphers auto-fast" and "MACs auto-fast".
+ * Each allowed algorithm is timed over a short burst of full-sized packets
+ * and the proposal is ordered fastest first.  Results are cached in a small
+ * text file so the calibration cost is only paid once per host.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "xmalloc.h"
+#include "log.h"
+#include "buffer.h"
+#include "cipher.h"
+#include "key.h"
+#include "kex.h"
+#include "mac.h"
+#include "algspeed.h"
+
+#define ALGSPEED_MAGIC		"algspeed-v1"
+#define ALGSPEED_PACKET		16384		/* bytes per timed packet */
+#define ALGSPEED_USEC		20000		/* time spent per algorithm */
+#define ALGSPEED_MAX_AGE	(30 * 24 * 60 * 60)
+#define ALGSPEED_MAX		64
+
+struct algspeed {
+	int	 type;
+	char	*name;
+	double	 mbps;
+	int	 pos;		/* position in the allowed list, for ties */
+};
+
+static const char *type_names[] = { "cipher", "mac" };
+
+static double
+elapsed(struct timeval *start)
+{
+	struct timeval now, diff;
+
+	gettimeofday(&now, NULL);
+	timersub(&now, start, &diff);
+	return (diff.tv_sec + diff.tv_usec / 1000000.0);
+}
+
+static double
+cipher_speed(const char *name)
+{
+	Cipher *c;
+	CipherContext cc;
+	struct timeval start;
+	u_char key[64], iv[64], *buf;
+	u_int64_t bytes = 0;
+	double secs;
+
+	if ((c = cipher_by_name(name)) == NULL ||
+	    cipher_get_number(c) != SSH_CIPHER_SSH2)
+		return (-1);
+	memset(key, 0x5a, sizeof(key));
+	memset(iv, 0xa5, sizeof(iv));
+	buf = xcalloc(1, ALGSPEED_PACKET);
+	cipher_init(&cc, c, key, cipher_keylen(c), iv, cipher_blocksize(c),
+	    CIPHER_ENCRYPT);
+	gettimeofday(&start, NULL);
+	do {
+		cipher_crypt(&cc, buf, buf, ALGSPEED_PACKET);
+		bytes += ALGSPEED_PACKET;
+	} while ((secs = elapsed(&start)) < ALGSPEED_USEC / 1000000.0);
+	cipher_cleanup(&cc);
+	xfree(buf);
+	return (bytes / secs / (1024 * 1024));
+}
+
+static double
+mac_speed(char *name)
+{
+	Mac mac;
+	struct timeval start;
+	u_char key[128], *buf;
+	u_int64_t bytes = 0;
+	u_int32_t seqno = 0;
+	double secs;
+
+	memset(&mac, 0, sizeof(mac));
+	if (mac_setup(&mac, name) < 0 || mac.key_len > sizeof(key))
+		return (-1);
+	memset(key, 0x3c, sizeof(key));
+	mac.name = name;
+	mac.key = key;
+	if (mac_init(&mac) < 0)
+		return (-1);
+	buf = xcalloc(1, ALGSPEED_PACKET);
+	gettimeofday(&start, NULL);
+	do {
+		mac_compute(&mac, seqno++, buf, ALGSPEED_PACKET);
+		bytes += ALGSPEED_PACKET;
+	} while ((secs = elapsed(&start)) < ALGSPEED_USEC / 1000000.0);
+	mac_clear(&mac);
+	xfree(buf);
+	return (bytes / secs / (1024 * 1024));
+}
+
+static void
+cache_host(char *host, size_t len)
+{
+	if (gethostname(host, len) == -1)
+		strlcpy(host, "unknown", len);
+}
+
+/*
+ * Loads the cache file into 'tab'.  The cache is ignored if it was
+ * produced on another host (shared home directories) or is too old.
+ */
+static u_int
+cache_load(const char *path, struct algspeed *tab, u_int max)
+{
+	FILE *f;
+	char line[256], host[256], *cp, *kind, *name, *speed;
+	u_int n = 0, linenum = 0;
+	long long stamp;
+	int type;
+
+	if ((f = fopen(path, "r")) == NULL)
+		return (0);
+	cache_host(host, sizeof(host));
+
+	/* The first line is the header: magic, host and calibration time */
+	cp = line;
+	if (fgets(line, sizeof(line), f) == NULL ||
+	    (kind = strsep(&cp, " \t\n")) == NULL ||
+	    (name = strsep(&cp, " \t\n")) == NULL ||
+	    (speed = strsep(&cp, " \t\n")) == NULL ||
+	    strcmp(kind, ALGSPEED_MAGIC) != 0 ||
+	    strcmp(name, host) != 0 ||
+	    (stamp = strtoll(speed, NULL, 10)) > (long long)time(NULL) ||
+	    stamp + ALGSPEED_MAX_AGE < (long long)time(NULL)) {
+		debug("%s: %s is stale, recalibrating", __func__, path);
+		fclose(f);
+		return (0);
+	}
+	linenum = 1;
+
+	while (fgets(line, sizeof(line), f) != NULL && n < max) {
+		linenum++;
+		cp = line;
+		if ((kind = strsep(&cp, " \t\n")) == NULL || *kind == '#' ||
+		    *kind == '\0')
+			continue;
+		name = strsep(&cp, " \t\n");
+		speed = strsep(&cp, " \t\n");
+		if (name == NULL || speed == NULL)
+			goto bad;
+		if (strcmp(kind, type_names[ALGSPEED_CIPHER]) == 0)
+			type = ALGSPEED_CIPHER;
+		else if (strcmp(kind, type_names[ALGSPEED_MAC]) == 0)
+			type = ALGSPEED_MAC;
+		else
+			goto bad;
+		tab[n].type = type;
+		tab[n].name = xstrdup(name);
+		tab[n].mbps = strtod(speed, NULL);
+		tab[n].pos = -1;
+		n++;
+		continue;
+ bad:
+		debug("%s: %s line %u: bad entry", __func__, path, linenum);
+	}
+	fclose(f);
+	return (n);
+}
+
+static void
+cache_save(const char *path, struct algspeed *tab, u_int n)
+{
+	FILE *f;
+	char host[256], *tmp;
+	u_int i;
+	int fd;
+
+	cache_host(host, sizeof(host));
+	xasprintf(&tmp, "%s.XXXXXXXXXX", path);
+	if ((fd = mkstemp(tmp)) == -1 || (f = fdopen(fd, "w")) == NULL) {
+		debug("%s: cannot create %s: %s", __func__, tmp,
+		    strerror(errno));
+		if (fd != -1) {
+			close(fd);
+			unlink(tmp);
+		}
+		xfree(tmp);
+		return;
+	}
+	fprintf(f, "%s %s %lld\n", ALGSPEED_MAGIC, host,
+	    (long long)time(NULL));
+	fprintf(f, "# measured local throughput in MB/s; "
+	    "delete this file to recalibrate\n");
+	for (i = 0; i < n; i++)
+		fprintf(f, "%s %s %.2f\n", type_names[tab[i].type],
+		    tab[i].name, tab[i].mbps);
+	if (fclose(f) != 0 || rename(tmp, path) == -1) {
+		debug("%s: cannot write %s: %s", __func__, path,
+		    strerror(errno));
+		unlink(tmp);
+	}
+	xfree(tmp);
+}
+
+static int
+speed_cmp(const void *a, const void *b)
+{
+	const struct algspeed *x = a, *y = b;
+
+	if (x->mbps != y->mbps)
+		return (x->mbps > y->mbps ? -1 : 1);
+	return (x->pos - y->pos);
+}
+
+/*
+ * Returns the algorithms of 'allowed' (a comma-separated list of ciphers
+ * or MACs, according to 'type') ordered by measured local throughput,
+ * fastest first.  Algorithms missing from the cache at 'cachefile' are
+ * measured and the cache is rewritten; a NULL 'cachefile' disables caching.
+ */
+char *
+algspeed_order(int type, const char *allowed, const char *cachefile)
+{
+	struct algspeed cache[ALGSPEED_MAX], sel[ALGSPEED_MAX];
+	u_int i, ncache = 0, nsel = 0;
+	char *list, *cp, *p, *ret;
+	size_t len = 0;
+	int dirty = 0;
+
+	if (type != ALGSPEED_CIPHER && type != ALGSPEED_MAC)
+		fatal("%s: bad type %d", __func__, type);
+	if (cachefile != NULL)
+		ncache = cache_load(cachefile, cache, ALGSPEED_MAX);
+
+	list = cp = xstrdup(allowed);
+	while ((p = strsep(&cp, ",")) != NULL && nsel < ALGSPEED_MAX) {
+		if (*p == '\0')
+			continue;
+		for (i = 0; i < ncache; i++)
+			if (cache[i].type == type &&
+			    strcmp(cache[i].name, p) == 0)
+				break;
+		if (i == ncache) {
+			/* Not calibrated yet */
+			if (ncache == ALGSPEED_MAX)
+				continue;
+			cache[i].type = type;
+			cache[i].name = xstrdup(p);
+			cache[i].mbps = (type == ALGSPEED_CIPHER) ?
+			    cipher_speed(p) : mac_speed(p);
+			ncache++;
+			dirty = 1;
+		}
+		if (cache[i].mbps < 0) {
+			debug("%s: %s %s unsupported", __func__,
+			    type_names[type], p);
+			continue;
+		}
+		debug2("%s: %s %s %.2f MB/s", __func__, type_names[type], p,
+		    cache[i].mbps);
+		sel[nsel] = cache[i];
+		sel[nsel].pos = nsel;
+		len += strlen(p) + 1;
+		nsel++;
+	}
+	xfree(list);
+	if (dirty && cachefile != NULL)
+		cache_save(cachefile, cache, ncache);
+	if (nsel == 0)
+		fatal("%s: no usable %s in \"%s\"", __func__,
+		    type_names[type], allowed);
+
+	qsort(sel, nsel, sizeof(sel[0]), speed_cmp);
+	ret = xmalloc(len);
+	ret[0] = '\0';
+	for (i = 0; i < nsel; i++) {
+		if (i > 0)
+			strlcat(ret, ",", len);
+		strlcat(ret, sel[i].name, len);
+	}
+	for (i = 0; i < ncache; i++)
+		xfree(cache[i].name);
+	debug("%s: %s proposal %s", __func__, type_names[type], ret);
+	return (ret);
+}
@@ -0,0 +1,16 @@
+/*
+ * Placed in the public domain.
+ */
+
+#ifndef ALGSPEED_H
+#define ALGSPEED_H
+
+/* Keyword accepted by Ciphers/MACs to select measured ordering */
+#define ALGSPEED_AUTO_FAST	"auto-fast"
+
+#define ALGSPEED_CIPHER		0
+#define ALGSPEED_MAC		1
+
+char	*algspeed_order(int, const char *, const char *);
+
+#endif				/* ALGSPEED_H */
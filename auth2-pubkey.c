@@ -28,9 +28,13 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#include <openssl/evp.h>
+
 #include <pwd.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "xmalloc.h"
 #include "ssh.h"
@@ -52,6 +56,7 @@
 #endif
 #include "monitor_wrap.h"
 #include "misc.h"
+#include "uuencode.h"
 
 /* import */
 extern ServerOptions options;
@@ -175,17 +180,313 @@ done:
 	return authenticated;
 }
 
+/*
+ * authorized_keys index.
+ *
+ * Accounts with thousands of authorized keys spend most of each lookup
+ * in key_read(), and a key is usually looked up twice (query, then
+ * signed request).  The first lookup in a file indexes it by the MD5
+ * of each line's decoded key blob, which needs no key parsing; later
+ * lookups only read the lines whose blob matches the offered key.
+ * Lines that don't look like "[options] type blob" are always checked.
+ * The index lives for the connection and is dropped when the file's
+ * device, inode, size or mtime change.
+ */
+#define AUTHKEYS_CACHE_SIZE	4
+#define AUTHKEYS_NONE		((u_int)-1)
+
+struct authkeys_line {
+	long off;		/* where read_keyfile_line() starts */
+	u_long linenum;		/* line number before the line */
+};
+
+struct authkeys_entry {
+	u_char fp[16];
+	u_int next;
+	struct authkeys_line l;
+};
+
+struct authkeys_index {
+	char *file;
+	dev_t dev;
+	ino_t ino;
+	off_t size;
+	time_t mtime;
+	u_int nbuckets, nentries, nscan;
+	u_int *buckets;
+	struct authkeys_entry *entries;
+	struct authkeys_line *scan;
+};
+
+static struct authkeys_index *authkeys_cache[AUTHKEYS_CACHE_SIZE];
+
+static void
+authkeys_index_free(struct authkeys_index *ai)
+{
+	xfree(ai->file);
+	if (ai->buckets != NULL)
+		xfree(ai->buckets);
+	if (ai->entries != NULL)
+		xfree(ai->entries);
+	if (ai->scan != NULL)
+		xfree(ai->scan);
+	xfree(ai);
+}
+
+static int
+authkeys_blob_fp(const u_char *blob, u_int len, u_char *fp)
+{
+	u_int fplen;
+
+	return (EVP_Digest(blob, len, fp, &fplen, EVP_md5(), NULL) == 1 &&
+	    fplen == 16) ? 0 : -1;
+}
+
+/*
+ * Find the key blob on a line the way key_read() would.  Returns the
+ * MD5 of the decoded blob in fp, or -1 if no SSH2 key can be read here.
+ */
+static int
+authkeys_line_fp(char *cp, u_char *fp)
+{
+	char *space;
+	u_char *blob;
+	int n, type;
+
+	if ((space = strchr(cp, ' ')) == NULL)
+		return -1;
+	*space = '\0';
+	type = key_type_from_name(cp);
+	*space = ' ';
+	if (type == KEY_UNSPEC || type == KEY_RSA1 || space[1] == '\0')
+		return -1;
+	cp = space + 1;
+	blob = xmalloc(2 * strlen(cp));
+	n = uudecode(cp, blob, 2 * strlen(cp));
+	if (n < 0 || authkeys_blob_fp(blob, n, fp) != 0) {
+		xfree(blob);
+		return -1;
+	}
+	xfree(blob);
+	return 0;
+}
+
+static struct authkeys_index *
+authkeys_index_build(FILE *f, const char *file, const struct stat *st)
+{
+	struct authkeys_index *ai;
+	struct authkeys_line l;
+	char line[SSH_MAX_PUBKEY_BYTES], *cp;
+	u_char fp[16];
+	u_int i, b, aentries = 0, ascan = 0;
+	u_long linenum = 0;
+	int quoted;
+
+	ai = xcalloc(1, sizeof(*ai));
+	ai->file = xstrdup(file);
+	ai->dev = st->st_dev;
+	ai->ino = st->st_ino;
+	ai->size = st->st_size;
+	ai->mtime = st->st_mtime;
+
+	for (;;) {
+		l.off = ftell(f);
+		l.linenum = linenum;
+		if (l.off < 0 || read_keyfile_line(f, file, line,
+		    sizeof(line), &linenum) == -1)
+			break;
+
+		/* Skip leading whitespace, empty and comment lines. */
+		for (cp = line; *cp == ' ' || *cp == '\t'; cp++)
+			;
+		if (!*cp || *cp == '\n' || *cp == '#')
+			continue;
+
+		if (authkeys_line_fp(cp, fp) != 0) {
+			/* skip options, as user_key_allowed2() does */
+			for (quoted = 0; *cp &&
+			    (quoted || (*cp != ' ' && *cp != '\t')); cp++) {
+				if (*cp == '\\' && cp[1] == '"')
+					cp++;	/* Skip both */
+				else if (*cp == '"')
+					quoted = !quoted;
+			}
+			for (; *cp == ' ' || *cp == '\t'; cp++)
+				;
+			if (authkeys_line_fp(cp, fp) != 0) {
+				if (ai->nscan >= ascan) {
+					ascan = ascan ? ascan * 2 : 16;
+					ai->scan = xrealloc(ai->scan, ascan,
+					    sizeof(*ai->scan));
+				}
+				ai->scan[ai->nscan++] = l;
+				continue;
+			}
+		}
+		if (ai->nentries >= aentries) {
+			aentries = aentries ? aentries * 2 : 64;
+			ai->entries = xrealloc(ai->entries, aentries,
+			    sizeof(*ai->entries));
+		}
+		memcpy(ai->entries[ai->nentries].fp, fp, sizeof(fp));
+		ai->entries[ai->nentries++].l = l;
+	}
+	if (ferror(f)) {
+		authkeys_index_free(ai);
+		return NULL;
+	}
+
+	for (ai->nbuckets = 16; ai->nbuckets < ai->nentries; )
+		ai->nbuckets <<= 1;
+	ai->buckets = xcalloc(ai->nbuckets, sizeof(*ai->buckets));
+	for (b = 0; b < ai->nbuckets; b++)
+		ai->buckets[b] = AUTHKEYS_NONE;
+	for (i = 0; i < ai->nentries; i++) {
+		b = get_u32(ai->entries[i].fp) & (ai->nbuckets - 1);
+		ai->entries[i].next = ai->buckets[b];
+		ai->buckets[b] = i;
+	}
+	debug3("%s: %s: %u keys, %u other lines", __func__, file,
+	    ai->nentries, ai->nscan);
+	return ai;
+}
+
+/* Return the index for open file f, (re)building it if needed */
+static struct authkeys_index *
+authkeys_index_get(FILE *f, const char *file)
+{
+	static u_int next;
+	struct authkeys_index *ai;
+	struct stat st;
+	u_int i;
+
+	if (fstat(fileno(f), &st) == -1)
+		return NULL;
+	for (i = 0; i < AUTHKEYS_CACHE_SIZE; i++) {
+		if ((ai = authkeys_cache[i]) == NULL ||
+		    strcmp(ai->file, file) != 0)
+			continue;
+		if (ai->dev == st.st_dev && ai->ino == st.st_ino &&
+		    ai->size == st.st_size && ai->mtime == st.st_mtime)
+			return ai;
+		authkeys_index_free(ai);
+		authkeys_cache[i] = NULL;
+		break;
+	}
+	if (i == AUTHKEYS_CACHE_SIZE) {
+		i = next++ % AUTHKEYS_CACHE_SIZE;
+		if (authkeys_cache[i] != NULL)
+			authkeys_index_free(authkeys_cache[i]);
+		authkeys_cache[i] = NULL;
+	}
+	if ((ai = authkeys_index_build(f, file, &st)) != NULL)
+		authkeys_cache[i] = ai;
+	return ai;
+}
+
+static int
+authkeys_line_cmp(const void *a, const void *b)
+{
+	const struct authkeys_line *la = a, *lb = b;
+
+	return (la->linenum < lb->linenum ? -1 :
+	    la->linenum > lb->linenum ? 1 : 0);
+}
+
+/*
+ * Lines of the indexed file that may hold key, in file order.  Returns
+ * the number of lines, or -1 if the key can't be fingerprinted.
+ */
+static int
+authkeys_candidates(struct authkeys_index *ai, Key *key,
+    struct authkeys_line **linesp)
+{
+	struct authkeys_line *lines;
+	u_char *blob, fp[16];
+	u_int i, n, len;
+
+	if (key_to_blob(key, &blob, &len) == 0)
+		return -1;
+	if (authkeys_blob_fp(blob, len, fp) != 0) {
+		xfree(blob);
+		return -1;
+	}
+	xfree(blob);
+
+	lines = xcalloc(ai->nscan + 1, sizeof(*lines));
+	memcpy(lines, ai->scan, ai->nscan * sizeof(*lines));
+	n = ai->nscan;
+	for (i = ai->buckets[get_u32(fp) & (ai->nbuckets - 1)];
+	    i != AUTHKEYS_NONE; i = ai->entries[i].next) {
+		if (memcmp(ai->entries[i].fp, fp, sizeof(fp)) != 0)
+			continue;
+		lines = xrealloc(lines, n + 1, sizeof(*lines));
+		lines[n++] = ai->entries[i].l;
+	}
+	qsort(lines, n, sizeof(*lines), authkeys_line_cmp);
+	*linesp = lines;
+	return n;
+}
+
+/* check one authorized_keys line; returns 1 if it allows key */
+static int
+user_key_allowed_line(struct passwd *pw, Key *key, Key *found, char *line,
+    char *file, u_long linenum)
+{
+	char *cp, *key_options = NULL;
+	char *fp;
+
+	/* Skip leading whitespace, empty and comment lines. */
+	for (cp = line; *cp == ' ' || *cp == '\t'; cp++)
+		;
+	if (!*cp || *cp == '\n' || *cp == '#')
+		return 0;
+
+	if (key_read(found, &cp) != 1) {
+		/* no key?  check if there are options for this key */
+		int quoted = 0;
+		debug2("user_key_allowed: check options: '%s'", cp);
+		key_options = cp;
+		for (; *cp && (quoted || (*cp != ' ' && *cp != '\t')); cp++) {
+			if (*cp == '\\' && cp[1] == '"')
+				cp++;	/* Skip both */
+			else if (*cp == '"')
+				quoted = !quoted;
+		}
+		/* Skip remaining whitespace. */
+		for (; *cp == ' ' || *cp == '\t'; cp++)
+			;
+		if (key_read(found, &cp) != 1) {
+			debug2("user_key_allowed: advance: '%s'", cp);
+			/* still no key?  advance to next line*/
+			return 0;
+		}
+	}
+	if (key_equal(found, key) &&
+	    auth_parse_options(pw, key_options, file, linenum) == 1) {
+		debug("matching key found: file %s, line %lu",
+		    file, linenum);
+		fp = key_fingerprint(found, SSH_FP_MD5, SSH_FP_HEX);
+		verbose("Found matching %s key: %s",
+		    key_type(found), fp);
+		xfree(fp);
+		return 1;
+	}
+	return 0;
+}
+
 /* return 1 if user allows given key */
 static int
 user_key_allowed2(struct passwd *pw, Key *key, char *file)
 {
 	char line[SSH_MAX_PUBKEY_BYTES];
-	int found_key = 0;
+	int found_key = 0, i, n;
 	FILE *f;
 	u_long linenum = 0;
 	struct stat st;
+	struct authkeys_index *ai;
+	struct authkeys_line *lines;
 	Key *found;
-	char *fp;
 
 	/* Temporarily use the user's uid. */
 	temporarily_use_uid(pw);
@@ -216,46 +517,24 @@ user_key_allowed2(struct passwd *pw, Key *key, char *file)
 	found_key = 0;
 	found = key_new(key->type);
 
-	while (read_keyfile_line(f, file, line, sizeof(line), &linenum) != -1) {
-		char *cp, *key_options = NULL;
-
-		/* Skip leading whitespace, empty and comment lines. */
-		for (cp = line; *cp == ' ' || *cp == '\t'; cp++)
-			;
-		if (!*cp || *cp == '\n' || *cp == '#')
-			continue;
-
-		if (key_read(found, &cp) != 1) {
-			/* no key?  check if there are options for this key */
-			int quoted = 0;
-			debug2("user_key_allowed: check options: '%s'", cp);
-			key_options = cp;
-			for (; *cp && (quoted || (*cp != ' ' && *cp != '\t')); cp++) {
-				if (*cp == '\\' && cp[1] == '"')
-					cp++;	/* Skip both */
-				else if (*cp == '"')
-					quoted = !quoted;
-			}
-			/* Skip remaining whitespace. */
-			for (; *cp == ' ' || *cp == '\t'; cp++)
-				;
-			if (key_read(found, &cp) != 1) {
-				debug2("user_key_allowed: advance: '%s'", cp);
-				/* still no key?  advance to next line*/
-				continue;
-			}
-		}
-		if (key_equal(found, key) &&
-		    auth_parse_options(pw, key_options, file, linenum) == 1) {
-			found_key = 1;
-			debug("matching key found: file %s, line %lu",
-			    file, linenum);
-			fp = key_fingerprint(found, SSH_FP_MD5, SSH_FP_HEX);
-			verbose("Found matching %s key: %s",
-			    key_type(found), fp);
-			xfree(fp);
-			break;
+	if ((ai = authkeys_index_get(f, file)) != NULL &&
+	    (n = authkeys_candidates(ai, key, &lines)) >= 0) {
+		for (i = 0; i < n && !found_key; i++) {
+			linenum = lines[i].linenum;
+			if (fseek(f, lines[i].off, SEEK_SET) == -1 ||
+			    read_keyfile_line(f, file, line, sizeof(line),
+			    &linenum) == -1)
+				break;
+			found_key = user_key_allowed_line(pw, key, found,
+			    line, file, linenum);
 		}
+		xfree(lines);
+	} else {
+		rewind(f);
+		while (!found_key && read_keyfile_line(f, file, line,
+		    sizeof(line), &linenum) != -1)
+			found_key = user_key_allowed_line(pw, key, found,
+			    line, file, linenum);
 	}
 	restore_uid();
 	fclose(f);
@@ -0,0 +1,563 @@
+/*
+ * Placed in the public domain.
+ *
+ * bench-crypto: measure the throughput of the transport primitives in
+ * libssh (ciphers, MACs and packet compression) without a network
+ * connection or a running sshd.  Every entry in the cipher and MAC tables
+ * is driven through cipher_crypt()/mac_compute() over a range of packet
+ * sizes, and buffer_compress() (zlib, and zstd when built --with-zstd) is
+ * run over compressible and incompressible input.  Results are reported in
+ * MB/s and, where the CPU exposes a cycle counter, in cycles per byte.
+ * Finally the key agreement of each key exchange method (both sides'
+ * ephemeral keys and shared secrets, without the host key signature) is
+ * timed and reported as milliseconds per handshake, followed by the
+ * key_sign() and key_verify() cost of each host/user key type.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+#include <sys/time.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "xmalloc.h"
+#include "log.h"
+#include "buffer.h"
+#include "cipher.h"
+#include "key.h"
+#include "kex.h"
+#include "mac.h"
+#include "compress.h"
+#include "dh.h"
+#include "misc.h"
+
+extern char *__progname;
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+# define BENCH_CYCLES
+static u_int64_t
+cycles(void)
+{
+	u_int32_t lo, hi;
+
+	__asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+	return (((u_int64_t)hi << 32) | lo);
+}
+#else
+static u_int64_t
+cycles(void)
+{
+	return 0;
+}
+#endif
+
+#define DEFAULT_SIZES	"16,64,256,1024,4096,16384,32768"
+#define DEFAULT_BYTES	(16 * 1024 * 1024)
+#define MAX_PACKET	(256 * 1024)
+#define KEX_SECS	0.5		/* time spent per kex method */
+#define KEX_NEED	160		/* bits, as for aes128 + hmac-sha1 */
+#define SIG_SECS	0.5		/* time spent per key type and op */
+
+static u_int64_t total_bytes = DEFAULT_BYTES;
+static u_int sizes[32];
+static u_int nsizes;
+
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1000000.0);
+}
+
+static void
+report(const char *what, const char *name, u_int size, u_int64_t bytes,
+    double secs, u_int64_t cyc, const char *extra)
+{
+	char cpb[32];
+
+	if (secs <= 0)
+		secs = 1e-9;
+#ifdef BENCH_CYCLES
+	snprintf(cpb, sizeof(cpb), "%9.2f", (double)cyc / bytes);
+#else
+	strlcpy(cpb, "        -", sizeof(cpb));
+#endif
+	printf("%-8s %-28s %6u %10.2f %s%s\n", what, name, size,
+	    bytes / secs / (1024 * 1024), cpb, extra == NULL ? "" : extra);
+	fflush(stdout);
+}
+
+/* Number of packets of 'size' bytes needed to cover total_bytes */
+static u_int64_t
+iterations(u_int size)
+{
+	u_int64_t n = total_bytes / size;
+
+	return (n == 0 ? 1 : n);
+}
+
+static void
+bench_cipher(const char *name, u_char *data)
+{
+	Cipher *c;
+	CipherContext cc;
+	u_char key[64], iv[64];
+	u_int64_t i, n, cyc;
+	u_int j, bs, len;
+	double start;
+
+	if ((c = cipher_by_name(name)) == NULL) {
+		error("unknown cipher \"%s\"", name);
+		return;
+	}
+	memset(key, 0x5a, sizeof(key));
+	memset(iv, 0xa5, sizeof(iv));
+	bs = cipher_blocksize(c);
+	cipher_init(&cc, c, key, cipher_keylen(c), iv, bs, CIPHER_ENCRYPT);
+	for (j = 0; j < nsizes; j++) {
+		/* Packets are always padded to a whole number of blocks */
+		len = ((sizes[j] + bs - 1) / bs) * bs;
+		n = iterations(len);
+		start = now();
+		cyc = cycles();
+		for (i = 0; i < n; i++)
+			cipher_crypt(&cc, data, data, len);
+		cyc = cycles() - cyc;
+		report("cipher", name, len, n * len, now() - start, cyc, NULL);
+	}
+	cipher_cleanup(&cc);
+}
+
+static void
+bench_mac(char *name, u_char *data)
+{
+	Mac mac;
+	u_char key[128];
+	u_int64_t i, n, cyc;
+	u_int j;
+	double start;
+
+	memset(&mac, 0, sizeof(mac));
+	if (mac_setup(&mac, name) < 0) {
+		error("unknown mac \"%s\"", name);
+		return;
+	}
+	if (mac.key_len > sizeof(key))
+		fatal("%s: key too long for %s", __func__, name);
+	memset(key, 0x3c, sizeof(key));
+	mac.name = name;
+	mac.key = key;
+	if (mac_init(&mac) < 0)
+		fatal("%s: mac_init failed for %s", __func__, name);
+	for (j = 0; j < nsizes; j++) {
+		n = iterations(sizes[j]);
+		start = now();
+		cyc = cycles();
+		for (i = 0; i < n; i++)
+			mac_compute(&mac, (u_int32_t)i, data, sizes[j]);
+		cyc = cycles() - cyc;
+		report("mac", name, sizes[j], n * sizes[j], now() - start, cyc,
+		    NULL);
+	}
+	mac_clear(&mac);
+}
+
+static void
+bench_compress(const char *method, int level, const char *kind, u_char *data)
+{
+	Buffer in, out;
+	u_int64_t i, n, cyc, produced;
+	u_int j;
+	double start;
+	char name[64], ratio[32];
+
+	snprintf(name, sizeof(name), "%s-%d/%s", method, level, kind);
+	buffer_init(&in);
+	buffer_init(&out);
+	for (j = 0; j < nsizes; j++) {
+#ifdef WITH_ZSTD
+		if (strcmp(method, "zstd") == 0)
+			buffer_compress_init_send_zstd(level);
+		else
+#endif
+			buffer_compress_init_send(level);
+		n = iterations(sizes[j]);
+		produced = 0;
+		start = now();
+		cyc = cycles();
+		for (i = 0; i < n; i++) {
+			buffer_clear(&in);
+			buffer_clear(&out);
+			/* Slide the window so the stream does not repeat */
+			buffer_append(&in, data + (i % 251), sizes[j]);
+			buffer_compress(&in, &out);
+			produced += buffer_len(&out);
+		}
+		cyc = cycles() - cyc;
+		snprintf(ratio, sizeof(ratio), "  ratio %.3f",
+		    (double)produced / (n * sizes[j]));
+		report("comp", name, sizes[j], n * sizes[j], now() - start, cyc,
+		    ratio);
+	}
+	buffer_free(&in);
+	buffer_free(&out);
+}
+
+static void
+report_kex(const char *name, u_int n, double secs)
+{
+	printf("%-8s %-40s %10.3f %12.1f\n", "kex", name,
+	    secs * 1000 / n, n / secs);
+	fflush(stdout);
+}
+
+static void
+bench_kex_dh(const char *name, DH *params)
+{
+	DH *client, *server;
+	u_char *kbuf;
+	u_int n = 0, klen;
+	double start, secs;
+
+	klen = DH_size(params);
+	kbuf = xmalloc(klen);
+	start = now();
+	do {
+		client = dh_new_group(BN_dup(params->g), BN_dup(params->p));
+		server = dh_new_group(BN_dup(params->g), BN_dup(params->p));
+		dh_gen_key(client, KEX_NEED);
+		dh_gen_key(server, KEX_NEED);
+		if (!dh_pub_is_valid(server, client->pub_key) ||
+		    !dh_pub_is_valid(client, server->pub_key))
+			fatal("%s: bad public value", name);
+		if (DH_compute_key(kbuf, server->pub_key, client) < 0 ||
+		    DH_compute_key(kbuf, client->pub_key, server) < 0)
+			fatal("%s: DH_compute_key failed", name);
+		DH_free(client);
+		DH_free(server);
+		n++;
+	} while ((secs = now() - start) < KEX_SECS);
+	report_kex(name, n, secs);
+	xfree(kbuf);
+	DH_free(params);
+}
+
+#ifdef OPENSSL_HAS_ECC
+static void
+bench_kex_ecdh(const char *name, int nid)
+{
+	EC_KEY *client, *server;
+	EC_POINT *peer;
+	BIGNUM *shared;
+	u_char *blob;
+	u_int n = 0, len;
+	double start, secs;
+
+	if ((shared = BN_new()) == NULL)
+		fatal("%s: BN_new failed", __func__);
+	start = now();
+	do {
+		if ((client = EC_KEY_new_by_curve_name(nid)) == NULL ||
+		    (server = EC_KEY_new_by_curve_name(nid)) == NULL ||
+		    EC_KEY_generate_key(client) != 1 ||
+		    EC_KEY_generate_key(server) != 1)
+			fatal("%s: key generation failed", name);
+		/* Both sides decode and validate the peer's point */
+		blob = kex_ecdh_pub_to_blob(client, &len);
+		if ((peer = kex_ecdh_blob_to_pub(EC_KEY_get0_group(server),
+		    blob, len)) == NULL)
+			fatal("%s: bad public value", name);
+		kex_ecdh_shared_secret(server, peer, shared);
+		EC_POINT_free(peer);
+		xfree(blob);
+		blob = kex_ecdh_pub_to_blob(server, &len);
+		if ((peer = kex_ecdh_blob_to_pub(EC_KEY_get0_group(client),
+		    blob, len)) == NULL)
+			fatal("%s: bad public value", name);
+		kex_ecdh_shared_secret(client, peer, shared);
+		EC_POINT_free(peer);
+		xfree(blob);
+		EC_KEY_free(client);
+		EC_KEY_free(server);
+		n++;
+	} while ((secs = now() - start) < KEX_SECS);
+	report_kex(name, n, secs);
+	BN_clear_free(shared);
+}
+#endif
+
+static void
+bench_kex_c25519(const char *name)
+{
+	u_char ckey[CURVE25519_SIZE], cpub[CURVE25519_SIZE];
+	u_char skey[CURVE25519_SIZE], spub[CURVE25519_SIZE];
+	BIGNUM *shared;
+	u_int n = 0;
+	double start, secs;
+
+	if ((shared = BN_new()) == NULL)
+		fatal("%s: BN_new failed", __func__);
+	start = now();
+	do {
+		kexc25519_keygen(ckey, cpub);
+		kexc25519_keygen(skey, spub);
+		if (kexc25519_shared_secret(skey, cpub, shared) != 0 ||
+		    kexc25519_shared_secret(ckey, spub, shared) != 0)
+			fatal("%s: bad public value", name);
+		n++;
+	} while ((secs = now() - start) < KEX_SECS);
+	report_kex(name, n, secs);
+	BN_clear_free(shared);
+}
+
+static void
+bench_kex(void)
+{
+	static const int gex_bits[] = { 2048, 3072, 4096 };
+	char name[64];
+	u_int i;
+
+	printf("\n%-8s %-40s %10s %12s\n", "type", "method", "ms",
+	    "handshakes/s");
+	bench_kex_c25519(KEX_CURVE25519_SHA256);
+#ifdef OPENSSL_HAS_ECC
+	bench_kex_ecdh(KEX_ECDH_SHA2_NISTP256, NID_X9_62_prime256v1);
+	bench_kex_ecdh(KEX_ECDH_SHA2_NISTP384, NID_secp384r1);
+	bench_kex_ecdh(KEX_ECDH_SHA2_NISTP521, NID_secp521r1);
+#endif
+	bench_kex_dh(KEX_DH1, dh_new_group1());
+	bench_kex_dh(KEX_DH14, dh_new_group14());
+	for (i = 0; i < sizeof(gex_bits) / sizeof(gex_bits[0]); i++) {
+		/* Groups come from the moduli file, as in sshd */
+		snprintf(name, sizeof(name), "%s/%d", KEX_DHGEX_SHA256,
+		    gex_bits[i]);
+		bench_kex_dh(name, choose_dh(DH_GRP_MIN, gex_bits[i],
+		    DH_GRP_MAX));
+	}
+}
+
+static void
+bench_sig_key(const char *name, int type, u_int bits)
+{
+	Key *key;
+	u_char data[32], *sig;
+	u_int n, slen;
+	double start, secs;
+
+	key = key_generate(type, bits);
+	/* Stands in for an exchange hash or a userauth request */
+	arc4random_buf(data, sizeof(data));
+
+	n = 0;
+	start = now();
+	do {
+		if (key_sign(key, &sig, &slen, data, sizeof(data)) != 0)
+			fatal("%s: key_sign failed", name);
+		xfree(sig);
+		n++;
+	} while ((secs = now() - start) < SIG_SECS);
+	printf("%-8s %-40s %10.3f %12.1f\n", "sign", name,
+	    secs * 1000 / n, n / secs);
+
+	if (key_sign(key, &sig, &slen, data, sizeof(data)) != 0)
+		fatal("%s: key_sign failed", name);
+	n = 0;
+	start = now();
+	do {
+		if (key_verify(key, sig, slen, data, sizeof(data)) != 1)
+			fatal("%s: key_verify failed", name);
+		n++;
+	} while ((secs = now() - start) < SIG_SECS);
+	printf("%-8s %-40s %10.3f %12.1f\n", "verify", name,
+	    secs * 1000 / n, n / secs);
+	fflush(stdout);
+	xfree(sig);
+	key_free(key);
+}
+
+static void
+bench_sig(void)
+{
+	printf("\n%-8s %-40s %10s %12s\n", "type", "key", "ms", "ops/s");
+	bench_sig_key("ssh-ed25519", KEY_ED25519, 256);
+#ifdef OPENSSL_HAS_ECC
+	bench_sig_key("ecdsa-sha2-nistp256", KEY_ECDSA, 256);
+	bench_sig_key("ecdsa-sha2-nistp384", KEY_ECDSA, 384);
+	bench_sig_key("ecdsa-sha2-nistp521", KEY_ECDSA, 521);
+#endif
+	bench_sig_key("ssh-rsa/2048", KEY_RSA, 2048);
+	bench_sig_key("ssh-rsa/3072", KEY_RSA, 3072);
+	bench_sig_key("ssh-dss/1024", KEY_DSA, 1024);
+}
+
+/* Fill with line-oriented text, roughly like logs or JSON */
+static void
+fill_text(u_char *p, size_t len)
+{
+	static const char *words[] = {
+		"\"timestamp\"", "\"level\"", "\"info\"", "\"debug\"",
+		"\"message\"", "connection", "forwarded", "channel", "bytes",
+		"window", "{", "}", ":", ",", " ", "\n", "0", "42", "1024",
+	};
+	const char *word;
+	size_t i = 0, w;
+
+	while (i < len) {
+		word = words[arc4random() % (sizeof(words) / sizeof(words[0]))];
+		w = MIN(strlen(word), len - i);
+		memcpy(p + i, word, w);
+		i += w;
+	}
+}
+
+static void
+fill_random(u_char *p, size_t len)
+{
+	u_int32_t r = 0;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if (i % 4 == 0)
+			r = arc4random();
+		p[i] = r & 0xff;
+		r >>= 8;
+	}
+}
+
+static void
+parse_sizes(const char *list)
+{
+	char *cp, *p, *s;
+	const char *errstr;
+
+	nsizes = 0;
+	s = cp = xstrdup(list);
+	while ((p = strsep(&cp, ",")) != NULL && *p != '\0') {
+		if (nsizes >= sizeof(sizes) / sizeof(sizes[0]))
+			fatal("too many packet sizes");
+		sizes[nsizes++] = strtonum(p, 1, MAX_PACKET, &errstr);
+		if (errstr != NULL)
+			fatal("packet size %s is %s", p, errstr);
+	}
+	xfree(s);
+	if (nsizes == 0)
+		fatal("no packet sizes specified");
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: %s [-CKMS] [-b bytes] [-c cipher_spec] [-l level]\n"
+	    "           [-m mac_spec] [-s size,...]\n", __progname);
+	exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+	char *cipher_list = NULL, *mac_list = NULL, *cp, *p;
+	int ch, level = 6, do_ciphers = 1, do_macs = 1, do_comp = 1;
+	int do_kex = 1, do_sig = 1;
+	const char *errstr;
+	u_char *data;
+
+	/* Ensure that fds 0, 1 and 2 are open or directed to /dev/null */
+	sanitise_stdfd();
+
+	__progname = ssh_get_progname(argv[0]);
+	init_rng();
+	seed_rng();
+	log_init(__progname, SYSLOG_LEVEL_INFO, SYSLOG_FACILITY_USER, 1);
+
+	parse_sizes(DEFAULT_SIZES);
+	while ((ch = getopt(argc, argv, "CKMSb:c:l:m:s:")) != -1) {
+		switch (ch) {
+		case 'C':
+			do_ciphers = 0;
+			break;
+		case 'K':
+			do_kex = 0;
+			break;
+		case 'M':
+			do_macs = 0;
+			break;
+		case 'S':
+			do_sig = 0;
+			break;
+		case 'b':
+			total_bytes = strtonum(optarg, 1, LLONG_MAX, &errstr);
+			if (errstr != NULL)
+				fatal("byte count %s is %s", optarg, errstr);
+			break;
+		case 'c':
+			cipher_list = xstrdup(optarg);
+			break;
+		case 'l':
+			level = strtonum(optarg, 0, 9, &errstr);
+			if (errstr != NULL)
+				fatal("compression level %s is %s",
+				    optarg, errstr);
+			if (level == 0)
+				do_comp = 0;
+			break;
+		case 'm':
+			mac_list = xstrdup(optarg);
+			break;
+		case 's':
+			parse_sizes(optarg);
+			break;
+		default:
+			usage();
+		}
+	}
+	if (optind != argc)
+		usage();
+	if (cipher_list == NULL)
+		cipher_list = cipher_alg_list();
+	if (mac_list == NULL)
+		mac_list = mac_alg_list();
+
+	data = xmalloc(MAX_PACKET + 256);
+	fill_random(data, MAX_PACKET + 256);
+
+	printf("%-8s %-28s %6s %10s %9s\n", "type", "algorithm", "size",
+	    "MB/s", "cycles/B");
+	if (do_ciphers) {
+		for (cp = cipher_list; (p = strsep(&cp, ",")) != NULL; )
+			if (*p != '\0')
+				bench_cipher(p, data);
+	}
+	if (do_macs) {
+		for (cp = mac_list; (p = strsep(&cp, ",")) != NULL; )
+			if (*p != '\0')
+				bench_mac(p, data);
+	}
+	if (do_comp) {
+		fill_text(data, MAX_PACKET + 256);
+		bench_compress("zlib", level, "text", data);
+#ifdef WITH_ZSTD
+		bench_compress("zstd", level, "text", data);
+#endif
+		fill_random(data, MAX_PACKET + 256);
+		bench_compress("zlib", level, "random", data);
+#ifdef WITH_ZSTD
+		bench_compress("zstd", level, "random", data);
+#endif
+	}
+	buffer_compress_uninit();
+	if (do_kex)
+		bench_kex();
+	if (do_sig)
+		bench_sig();
+
+	xfree(data);
+	return 0;
+}
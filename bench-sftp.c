@@ -0,0 +1,623 @@
+/*
+ * Placed in the public domain.
+ *
+ * bench-sftp: measure sftp-client against sftp-server over a local
+ * socketpair, without ssh or the network in the way.  The server is
+ * started as a child process and driven through the sftp-client API, so
+ * the numbers cover the protocol, the request pipelining on both sides
+ * and the file I/O, and nothing else.  The workloads are a large
+ * sequential upload and download, many small files transferred one at
+ * a time and as a batch, reading a directory with many entries, and
+ * single STAT round trips, serially and pipelined.  Each is reported in
+ * MB/s, requests/s and operations (files, entries or requests) per
+ * second; where operations are timed one by one, the 50th, 90th and
+ * 99th percentile latencies are given as well.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+#include <sys/param.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "xmalloc.h"
+#include "atomicio.h"
+#include "log.h"
+#include "buffer.h"
+#include "misc.h"
+#include "entropy.h"
+
+#include "sftp.h"
+#include "sftp-common.h"
+#include "sftp-client.h"
+
+extern char *__progname;
+
+/* used by sftp-client.c */
+volatile sig_atomic_t interrupted = 0;
+int showprogress = 0;
+
+#define DEFAULT_SERVER	"./sftp-server"
+#define DEFAULT_TESTS	"large,small,dir,stat"
+#define DEFAULT_BYTES	(64 * 1024 * 1024)
+#define DEFAULT_FILES	1000
+#define DEFAULT_FSIZE	4096
+#define DEFAULT_ENTRIES	20000
+#define DEFAULT_STATS	2000
+#define FILL_CHUNK	(1024 * 1024)
+
+static char *server_path = DEFAULT_SERVER;
+static u_int64_t total_bytes = DEFAULT_BYTES;
+static u_int nfiles = DEFAULT_FILES;
+static u_int file_size = DEFAULT_FSIZE;
+static u_int nentries = DEFAULT_ENTRIES;
+static u_int nstats = DEFAULT_STATS;
+
+static char workdir[MAXPATHLEN];
+static pid_t server_pid = -1;
+
+static void remove_tree(const char *);
+
+/* snprintf for paths under the work directory; truncation is fatal */
+static void
+path_printf(char *path, size_t len, const char *fmt, ...)
+    __attribute__((format(printf, 3, 4)));
+
+static void
+path_printf(char *path, size_t len, const char *fmt, ...)
+{
+	va_list ap;
+	int r;
+
+	va_start(ap, fmt);
+	r = vsnprintf(path, len, fmt, ap);
+	va_end(ap);
+	if (r < 0 || (size_t)r >= len)
+		fatal("path too long: %.100s...", path);
+}
+
+/* fatal() ends up here: do not leave the work directory behind */
+void
+cleanup_exit(int i)
+{
+	if (workdir[0] != '\0')
+		remove_tree(workdir);
+	_exit(i);
+}
+
+static double
+now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1000000.0);
+}
+
+static int
+cmp_double(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return (x < y ? -1 : (x > y ? 1 : 0));
+}
+
+/* The p'th percentile of n sorted samples, nearest rank */
+static double
+percentile(double *lat, u_int n, u_int p)
+{
+	u_int i = (n * p + 99) / 100;
+
+	return (lat[i == 0 ? 0 : i - 1]);
+}
+
+/*
+ * Print one result.  'bytes' is zero where no data was moved, and 'lat'
+ * holds 'nlat' per operation times in seconds if they were taken.
+ */
+static void
+report(const char *test, const char *what, u_int64_t bytes, u_int reqs,
+    u_int ops, double secs, double *lat, u_int nlat)
+{
+	char mbs[32], pct[64];
+
+	if (secs <= 0)
+		secs = 1e-9;
+	if (bytes != 0)
+		snprintf(mbs, sizeof(mbs), "%10.2f",
+		    bytes / secs / (1024 * 1024));
+	else
+		strlcpy(mbs, "         -", sizeof(mbs));
+	if (lat != NULL && nlat > 0) {
+		qsort(lat, nlat, sizeof(*lat), cmp_double);
+		snprintf(pct, sizeof(pct), " %8.3f %8.3f %8.3f",
+		    percentile(lat, nlat, 50) * 1000,
+		    percentile(lat, nlat, 90) * 1000,
+		    percentile(lat, nlat, 99) * 1000);
+	} else
+		strlcpy(pct, "        -        -        -", sizeof(pct));
+	printf("%-8s %-22s %s %10.0f %10.0f%s\n", test, what, mbs,
+	    reqs / secs, ops / secs, pct);
+	fflush(stdout);
+}
+
+static void
+connect_to_server(int *in, int *out)
+{
+	char *args[2];
+	int c_in, c_out;
+
+#ifdef USE_PIPES
+	int pin[2], pout[2];
+
+	if ((pipe(pin) == -1) || (pipe(pout) == -1))
+		fatal("pipe: %s", strerror(errno));
+	*in = pin[0];
+	*out = pout[1];
+	c_in = pout[0];
+	c_out = pin[1];
+#else /* USE_PIPES */
+	int inout[2];
+
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, inout) == -1)
+		fatal("socketpair: %s", strerror(errno));
+	*in = *out = inout[0];
+	c_in = c_out = inout[1];
+#endif /* USE_PIPES */
+
+	if ((server_pid = fork()) == -1)
+		fatal("fork: %s", strerror(errno));
+	else if (server_pid == 0) {
+		if ((dup2(c_in, STDIN_FILENO) == -1) ||
+		    (dup2(c_out, STDOUT_FILENO) == -1)) {
+			fprintf(stderr, "dup2: %s\n", strerror(errno));
+			_exit(1);
+		}
+		close(*in);
+		close(*out);
+		close(c_in);
+		close(c_out);
+		args[0] = server_path;
+		args[1] = NULL;
+		execv(server_path, args);
+		fprintf(stderr, "exec: %s: %s\n", server_path,
+		    strerror(errno));
+		_exit(1);
+	}
+	close(c_in);
+	close(c_out);
+}
+
+static void
+make_dir(const char *path)
+{
+	if (mkdir(path, 0700) == -1)
+		fatal("mkdir %s: %s", path, strerror(errno));
+}
+
+/* Create a local file of 'size' bytes from 'data' (FILL_CHUNK long) */
+static void
+make_file(const char *path, u_int64_t size, const u_char *data)
+{
+	u_int64_t done;
+	size_t len;
+	int fd;
+
+	if ((fd = open(path, O_WRONLY|O_CREAT|O_TRUNC, 0600)) == -1)
+		fatal("open %s: %s", path, strerror(errno));
+	for (done = 0; done < size; done += len) {
+		len = MIN(size - done, FILL_CHUNK);
+		if (atomicio(vwrite, fd, (u_char *)data, len) != len)
+			fatal("write %s: %s", path, strerror(errno));
+	}
+	if (close(fd) == -1)
+		fatal("close %s: %s", path, strerror(errno));
+}
+
+static void
+check_size(const char *path, u_int64_t size)
+{
+	struct stat st;
+
+	if (stat(path, &st) == -1)
+		fatal("stat %s: %s", path, strerror(errno));
+	if ((u_int64_t)st.st_size != size)
+		fatal("%s: size %llu, expected %llu", path,
+		    (unsigned long long)st.st_size, (unsigned long long)size);
+}
+
+/* Remove everything below 'path' and then 'path' itself */
+static void
+remove_tree(const char *path)
+{
+	char sub[MAXPATHLEN];
+	struct dirent *dp;
+	struct stat st;
+	DIR *dirp;
+
+	if (lstat(path, &st) == -1)
+		return;
+	if (!S_ISDIR(st.st_mode)) {
+		if (unlink(path) == -1)
+			error("unlink %s: %s", path, strerror(errno));
+		return;
+	}
+	if ((dirp = opendir(path)) == NULL) {
+		error("opendir %s: %s", path, strerror(errno));
+		return;
+	}
+	while ((dp = readdir(dirp)) != NULL) {
+		if (strcmp(dp->d_name, ".") == 0 ||
+		    strcmp(dp->d_name, "..") == 0)
+			continue;
+		if (snprintf(sub, sizeof(sub), "%s/%s", path,
+		    dp->d_name) >= (int)sizeof(sub)) {
+			error("%s/%s: path too long", path, dp->d_name);
+			continue;
+		}
+		remove_tree(sub);
+	}
+	closedir(dirp);
+	if (rmdir(path) == -1)
+		error("rmdir %s: %s", path, strerror(errno));
+}
+
+static void
+bench_large(struct sftp_conn *conn, const u_char *data)
+{
+	char src[MAXPATHLEN], up[MAXPATHLEN], down[MAXPATHLEN], what[32];
+	u_int reqs;
+	double start, secs;
+
+	path_printf(src, sizeof(src), "%s/large.src", workdir);
+	path_printf(up, sizeof(up), "%s/large.up", workdir);
+	path_printf(down, sizeof(down), "%s/large.down", workdir);
+	snprintf(what, sizeof(what), "%llu KB file",
+	    (unsigned long long)(total_bytes / 1024));
+	make_file(src, total_bytes, data);
+
+	reqs = sftp_request_count(conn);
+	start = now();
+	if (do_upload(conn, src, up, 0, 0, 0) != 0)
+		fatal("upload of %s failed", src);
+	secs = now() - start;
+	check_size(up, total_bytes);
+	report("upload", what, total_bytes, sftp_request_count(conn) - reqs,
+	    1, secs, NULL, 0);
+
+	reqs = sftp_request_count(conn);
+	start = now();
+	if (do_download(conn, up, down, 0, 0, 0) != 0)
+		fatal("download of %s failed", up);
+	secs = now() - start;
+	check_size(down, total_bytes);
+	report("download", what, total_bytes,
+	    sftp_request_count(conn) - reqs, 1, secs, NULL, 0);
+
+	unlink(src);
+	unlink(up);
+	unlink(down);
+}
+
+/*
+ * Transfer every file in 'from' to 'to', one at a time if 'lat' is set
+ * (recording the time each took), otherwise as a single batch.
+ */
+static double
+small_files(struct sftp_conn *conn, int upload, const char *from,
+    const char *to, double *lat)
+{
+	char src[MAXPATHLEN], dst[MAXPATHLEN];
+	struct sftp_batch *b = NULL;
+	double start, t;
+	u_int i;
+	int r;
+
+	start = now();
+	if (lat == NULL)
+		b = do_batch_init(conn, 0, 0);
+	for (i = 0; i < nfiles; i++) {
+		path_printf(src, sizeof(src), "%s/%u", from, i);
+		path_printf(dst, sizeof(dst), "%s/%u", to, i);
+		if (b != NULL) {
+			if (upload)
+				do_batch_upload(b, src, dst);
+			else
+				do_batch_download(b, src, dst);
+			continue;
+		}
+		t = now();
+		if (upload)
+			r = do_upload(conn, src, dst, 0, 0, 0);
+		else
+			r = do_download(conn, src, dst, 0, 0, 0);
+		if (r != 0)
+			fatal("transfer of %s failed", src);
+		lat[i] = now() - t;
+	}
+	if (b != NULL && do_batch_run(b) != 0)
+		fatal("batch transfer from %s failed", from);
+	return now() - start;
+}
+
+static void
+bench_small(struct sftp_conn *conn, const u_char *data)
+{
+	static const struct {
+		const char *test, *from, *to;
+		int upload, serial;
+	} runs[] = {
+		{ "put",	"small.src",	"small.put",	1, 1 },
+		{ "put -b",	"small.src",	"small.putb",	1, 0 },
+		{ "get",	"small.put",	"small.get",	0, 1 },
+		{ "get -b",	"small.put",	"small.getb",	0, 0 },
+	};
+	char path[MAXPATHLEN], from[MAXPATHLEN], to[MAXPATHLEN], what[32];
+	double *lat, secs;
+	u_int i, j, reqs;
+
+	lat = xcalloc(nfiles, sizeof(*lat));
+	snprintf(what, sizeof(what), "%u x %u B files", nfiles, file_size);
+	path_printf(path, sizeof(path), "%s/small.src", workdir);
+	make_dir(path);
+	for (i = 0; i < nfiles; i++) {
+		path_printf(path, sizeof(path), "%s/small.src/%u", workdir, i);
+		make_file(path, file_size, data);
+	}
+
+	for (j = 0; j < sizeof(runs) / sizeof(runs[0]); j++) {
+		path_printf(from, sizeof(from), "%s/%s", workdir, runs[j].from);
+		path_printf(to, sizeof(to), "%s/%s", workdir, runs[j].to);
+		make_dir(to);
+		reqs = sftp_request_count(conn);
+		secs = small_files(conn, runs[j].upload, from, to,
+		    runs[j].serial ? lat : NULL);
+		report(runs[j].test, what, (u_int64_t)nfiles * file_size,
+		    sftp_request_count(conn) - reqs, nfiles, secs,
+		    runs[j].serial ? lat : NULL, nfiles);
+	}
+
+	for (j = 0; j < sizeof(runs) / sizeof(runs[0]); j++) {
+		path_printf(path, sizeof(path), "%s/%s", workdir, runs[j].to);
+		remove_tree(path);
+	}
+	path_printf(path, sizeof(path), "%s/small.src", workdir);
+	remove_tree(path);
+	xfree(lat);
+}
+
+static void
+bench_dir(struct sftp_conn *conn)
+{
+	char path[MAXPATHLEN], dir[MAXPATHLEN], what[32];
+	SFTP_DIRENT **d;
+	u_int i, n, reqs;
+	double start, secs;
+	int fd;
+
+	path_printf(dir, sizeof(dir), "%s/dir", workdir);
+	snprintf(what, sizeof(what), "%u entries", nentries);
+	make_dir(dir);
+	for (i = 0; i < nentries; i++) {
+		path_printf(path, sizeof(path), "%s/entry-%08u", dir, i);
+		if ((fd = open(path, O_WRONLY|O_CREAT, 0600)) == -1)
+			fatal("open %s: %s", path, strerror(errno));
+		close(fd);
+	}
+
+	reqs = sftp_request_count(conn);
+	start = now();
+	if (do_readdir(conn, dir, &d) != 0)
+		fatal("readdir of %s failed", dir);
+	secs = now() - start;
+	for (n = 0; d[n] != NULL; n++)
+		;
+	free_sftp_dirents(d);
+	if (n != nentries + 2)
+		fatal("%s: %u entries, expected %u", dir, n, nentries + 2);
+	report("readdir", what, 0, sftp_request_count(conn) - reqs, n, secs,
+	    NULL, 0);
+
+	remove_tree(dir);
+}
+
+static void
+bench_stat(struct sftp_conn *conn)
+{
+	char path[MAXPATHLEN], what[32];
+	struct sftp_pipe *p;
+	Attrib a;
+	double *lat, start, t, secs;
+	u_int i, reqs;
+	int fd, ok;
+
+	lat = xcalloc(nstats, sizeof(*lat));
+	path_printf(path, sizeof(path), "%s/stat", workdir);
+	snprintf(what, sizeof(what), "%u requests", nstats);
+	if ((fd = open(path, O_WRONLY|O_CREAT, 0600)) == -1)
+		fatal("open %s: %s", path, strerror(errno));
+	close(fd);
+
+	reqs = sftp_request_count(conn);
+	start = now();
+	for (i = 0; i < nstats; i++) {
+		t = now();
+		if (do_stat(conn, path, 0) == NULL)
+			fatal("stat of %s failed", path);
+		lat[i] = now() - t;
+	}
+	secs = now() - start;
+	report("stat", what, 0, sftp_request_count(conn) - reqs, nstats,
+	    secs, lat, nstats);
+
+	reqs = sftp_request_count(conn);
+	start = now();
+	p = do_pipe_init(conn);
+	for (i = 0; i < nstats; i++)
+		do_pipe_stat(p, path, &a, &ok);
+	if (do_pipe_wait(p) != 0)
+		fatal("pipelined stat of %s failed", path);
+	do_pipe_free(p);
+	secs = now() - start;
+	report("stat -p", what, 0, sftp_request_count(conn) - reqs, nstats,
+	    secs, NULL, 0);
+
+	unlink(path);
+	xfree(lat);
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: %s [-v] [-B buffer_size] [-b bytes] [-d directory]\n"
+	    "           [-e entries] [-f files] [-R num_requests]\n"
+	    "           [-r requests] [-S server_path] [-s file_size]\n"
+	    "           [-t test,...]\n", __progname);
+	exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+	char *tests = DEFAULT_TESTS, *tmpdir = "/tmp", *list, *cp, *p;
+	char tmpl[MAXPATHLEN];
+	int ch, in, out, status, do_large = 0, do_small = 0, do_dir = 0;
+	int do_stats = 0;
+	u_int copy_buffer_len = 32768, num_requests = 64;
+	LogLevel ll = SYSLOG_LEVEL_INFO;
+	struct sftp_conn *conn;
+	const char *errstr;
+	u_char *data;
+
+	/* Ensure that fds 0, 1 and 2 are open or directed to /dev/null */
+	sanitise_stdfd();
+
+	__progname = ssh_get_progname(argv[0]);
+	init_rng();
+	seed_rng();
+
+	while ((ch = getopt(argc, argv, "B:R:S:b:d:e:f:r:s:t:v")) != -1) {
+		switch (ch) {
+		case 'B':
+			copy_buffer_len = strtonum(optarg, 512, 256 * 1024,
+			    &errstr);
+			if (errstr != NULL)
+				fatal("buffer size %s is %s", optarg, errstr);
+			break;
+		case 'R':
+			num_requests = strtonum(optarg, 1, 1024, &errstr);
+			if (errstr != NULL)
+				fatal("number of requests %s is %s",
+				    optarg, errstr);
+			break;
+		case 'S':
+			server_path = optarg;
+			break;
+		case 'b':
+			total_bytes = strtonum(optarg, 1, LLONG_MAX, &errstr);
+			if (errstr != NULL)
+				fatal("byte count %s is %s", optarg, errstr);
+			break;
+		case 'd':
+			tmpdir = optarg;
+			break;
+		case 'e':
+			nentries = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				fatal("entry count %s is %s", optarg, errstr);
+			break;
+		case 'f':
+			nfiles = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				fatal("file count %s is %s", optarg, errstr);
+			break;
+		case 'r':
+			nstats = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				fatal("request count %s is %s", optarg, errstr);
+			break;
+		case 's':
+			file_size = strtonum(optarg, 0, INT_MAX, &errstr);
+			if (errstr != NULL)
+				fatal("file size %s is %s", optarg, errstr);
+			break;
+		case 't':
+			tests = optarg;
+			break;
+		case 'v':
+			if (ll < SYSLOG_LEVEL_DEBUG3)
+				ll++;
+			break;
+		default:
+			usage();
+		}
+	}
+	if (optind != argc)
+		usage();
+	log_init(__progname, ll, SYSLOG_FACILITY_USER, 1);
+
+	list = cp = xstrdup(tests);
+	while ((p = strsep(&cp, ",")) != NULL) {
+		if (strcmp(p, "large") == 0)
+			do_large = 1;
+		else if (strcmp(p, "small") == 0)
+			do_small = 1;
+		else if (strcmp(p, "dir") == 0)
+			do_dir = 1;
+		else if (strcmp(p, "stat") == 0)
+			do_stats = 1;
+		else if (*p != '\0')
+			fatal("unknown test \"%s\"", p);
+	}
+	xfree(list);
+
+	data = xmalloc(FILL_CHUNK);
+	arc4random_buf(data, FILL_CHUNK);
+
+	signal(SIGPIPE, SIG_IGN);
+	connect_to_server(&in, &out);
+	if ((conn = do_init(in, out, copy_buffer_len, num_requests)) == NULL)
+		fatal("Couldn't initialise connection to server");
+
+	/* workdir is only set once there is something to clean up */
+	path_printf(tmpl, sizeof(tmpl), "%s/bench-sftp.XXXXXXXXXX", tmpdir);
+	if (mkdtemp(tmpl) == NULL)
+		fatal("mkdtemp %s: %s", tmpl, strerror(errno));
+	strlcpy(workdir, tmpl, sizeof(workdir));
+
+	printf("%-8s %-22s %10s %10s %10s %8s %8s %8s\n", "test", "workload",
+	    "MB/s", "req/s", "ops/s", "p50 ms", "p90 ms", "p99 ms");
+	if (do_large)
+		bench_large(conn, data);
+	if (do_small)
+		bench_small(conn, data);
+	if (do_dir)
+		bench_dir(conn);
+	if (do_stats)
+		bench_stat(conn);
+
+	close(in);
+	if (out != in)
+		close(out);
+	while (waitpid(server_pid, &status, 0) == -1)
+		if (errno != EINTR)
+			fatal("waitpid: %s", strerror(errno));
+	remove_tree(workdir);
+	workdir[0] = '\0';
+	xfree(data);
+	return 0;
+}
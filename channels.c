@@ -75,6 +75,7 @@
 #include "key.h"
 #include "authfd.h"
 #include "pathnames.h"
+#include "conntrace.h"
 
 /* -- channel core */
 
@@ -625,6 +626,29 @@ channel_open_message(void)
 	return cp;
 }
 
+/* Time the first channel this side opens; the connection is then up. */
+static int open_trace = -1;
+static int open_trace_id = -1;
+
+static void
+channel_trace_open(Channel *c)
+{
+	if (open_trace_id != -1 || !conntrace_active())
+		return;
+	open_trace_id = c->self;
+	open_trace = conntrace_start("channel open %.24s", c->ctype);
+}
+
+static void
+channel_trace_reply(int id)
+{
+	if (open_trace == -1 || id != open_trace_id)
+		return;
+	conntrace_stop(open_trace);
+	open_trace = -1;
+	conntrace_done();
+}
+
 void
 channel_send_open(int id)
 {
@@ -635,6 +659,7 @@ channel_send_open(int id)
 		return;
 	}
 	debug2("channel %d: send open", id);
+	channel_trace_open(c);
 	packet_start(SSH2_MSG_CHANNEL_OPEN);
 	packet_put_cstring(c->ctype);
 	packet_put_int(c->self);
@@ -1218,6 +1243,7 @@ channel_post_x11_listener(Channel *c, fd_set *readset, fd_set *writeset)
 		    SSH_CHANNEL_OPENING, newsock, newsock, -1,
 		    c->local_window_max, c->local_maxpacket, 0, buf, 1);
 		if (compat20) {
+			channel_trace_open(nc);
 			packet_start(SSH2_MSG_CHANNEL_OPEN);
 			packet_put_cstring("x11");
 			packet_put_int(nc->self);
@@ -1263,6 +1289,7 @@ port_open_helper(Channel *c, char *rtype)
 	c->remote_name = xstrdup(buf);
 
 	if (compat20) {
+		channel_trace_open(c);
 		packet_start(SSH2_MSG_CHANNEL_OPEN);
 		packet_put_cstring(rtype);
 		packet_put_int(c->self);
@@ -1405,6 +1432,7 @@ channel_post_auth_listener(Channel *c, fd_set *readset, fd_set *writeset)
 		    c->local_window_max, c->local_maxpacket,
 		    0, "accepted auth socket", 1);
 		if (compat20) {
+			channel_trace_open(nc);
 			packet_start(SSH2_MSG_CHANNEL_OPEN);
 			packet_put_cstring("auth-agent@openssh.com");
 			packet_put_int(nc->self);
@@ -2266,6 +2294,7 @@ channel_input_open_confirmation(int type, u_int32_t seq, void *ctxt)
 	/* Record the remote channel number and mark that the channel is now open. */
 	c->remote_id = remote_id;
 	c->type = SSH_CHANNEL_OPEN;
+	channel_trace_reply(id);
 
 	if (compat20) {
 		c->remote_window = packet_get_int();
@@ -2311,6 +2340,7 @@ channel_input_open_failure(int type, u_int32_t seq, void *ctxt)
 	if (c==NULL || c->type != SSH_CHANNEL_OPENING)
 		packet_disconnect("Received open failure for "
 		    "non-opening channel %d.", id);
+	channel_trace_reply(id);
 	if (compat20) {
 		reason = packet_get_int();
 		if (!(datafellows & SSH_BUG_OPENFAILURE)) {
@@ -3231,7 +3261,6 @@ x11_request_forwarding_with_spoofing(int client_session_id, const char *disp,
 	char *new_data;
 	int screen_number;
 	const char *cp;
-	u_int32_t rnd = 0;
 
 	if (x11_saved_display == NULL)
 		x11_saved_display = xstrdup(disp);
@@ -3258,15 +3287,12 @@ x11_request_forwarding_with_spoofing(int client_session_id, const char *disp,
 		 */
 		x11_saved_data = xmalloc(data_len);
 		x11_fake_data = xmalloc(data_len);
+		arc4random_buf(x11_fake_data, data_len);
 		for (i = 0; i < data_len; i++) {
 			if (sscanf(data + 2 * i, "%2x", &value) != 1)
 				fatal("x11_request_forwarding: bad "
 				    "authentication data: %.100s", data);
-			if (i % 4 == 0)
-				rnd = arc4random();
 			x11_saved_data[i] = value;
-			x11_fake_data[i] = rnd & 0xff;
-			rnd >>= 8;
 		}
 		x11_saved_data_len = data_len;
 		x11_fake_data_len = data_len;
@@ -143,6 +143,26 @@ cipher_by_number(int id)
 }
 
 #define	CIPHER_SEP	","
+
+/* Returns a comma-separated list of every cipher in the table */
+char *
+cipher_alg_list(void)
+{
+	char *ret = NULL;
+	size_t nlen, rlen = 0;
+	Cipher *c;
+
+	for (c = ciphers; c->name != NULL; c++) {
+		if (ret != NULL)
+			ret[rlen++] = *CIPHER_SEP;
+		nlen = strlen(c->name);
+		ret = xrealloc(ret, 1, rlen + nlen + 2);
+		memcpy(ret + rlen, c->name, nlen + 1);
+		rlen += nlen;
+	}
+	return ret;
+}
+
 int
 ciphers_valid(const char *names)
 {
@@ -501,13 +501,13 @@ server_alive_check(void)
  */
 static void
 client_wait_until_can_do_something(fd_set **readsetp, fd_set **writesetp,
-    int *maxfdp, u_int *nallocp, int rekeying)
+    int *maxfdp, u_int *nallocp)
 {
 	struct timeval tv, *tvp;
 	int ret;
 
 	/* Add any selections by the channel mechanism. */
-	channel_prepare_select(readsetp, writesetp, maxfdp, nallocp, rekeying);
+	channel_prepare_select(readsetp, writesetp, maxfdp, nallocp, 0);
 
 	if (!compat20) {
 		/* Read from the connection, unless our buffers are full. */
@@ -1408,7 +1408,8 @@ client_loop(int have_pty, int escape_char_arg, int ssh2_chan_id)
 	fd_set *readset = NULL, *writeset = NULL;
 	double start_time, total_time;
 	int max_fd = 0, max_fd2 = 0, len, rekeying = 0;
-	u_int nalloc = 0;
+	u_int nalloc = 0, nrekey;
+	u_int64_t rekey_total, rekey_max, rekey_bytes;
 	char buf[100];
 
 	debug("Entering interactive session.");
@@ -1503,56 +1504,53 @@ client_loop(int have_pty, int escape_char_arg, int ssh2_chan_id)
 
 		rekeying = (xxx_kex != NULL && !xxx_kex->done);
 
-		if (rekeying) {
-			debug("rekeying in progress");
-		} else {
-			/*
-			 * Make packets of buffered stdin data, and buffer
-			 * them for sending to the server.
-			 */
+		/*
+		 * Make packets of buffered stdin data, and buffer
+		 * them for sending to the server.
+		 */
 #ifndef _TOH_
-			if (!compat20)
-				client_make_packets_from_stdin_data();
+		if (!compat20)
+			client_make_packets_from_stdin_data();
 #endif /* _TOH_ */
 
-			/*
-			 * Make packets from buffered channel data, and
-			 * enqueue them for sending to the server.
-			 */
-			if (packet_not_very_much_data_to_write())
-				channel_output_poll();
+		/*
+		 * Make packets from buffered channel data, and enqueue them
+		 * for sending to the server.  This continues while rekeying:
+		 * the packet layer holds the packets until the new keys are
+		 * in use, and throttles us once its queue is full.
+		 */
+		if (packet_not_very_much_data_to_write())
+			channel_output_poll();
 
-			/*
-			 * Check if the window size has changed, and buffer a
-			 * message about it to the server if so.
-			 */
+		/*
+		 * Check if the window size has changed, and buffer a
+		 * message about it to the server if so.
+		 */
 #ifndef _TOH_
-			client_check_window_change();
+		client_check_window_change();
 #endif /* _TOH_ */
 
-			if (quit_pending)
-				break;
-		}
+		if (quit_pending)
+			break;
+
 		/*
 		 * Wait until we have something to do (something becomes
 		 * available on one of the descriptors).
 		 */
 		max_fd2 = max_fd;
 		client_wait_until_can_do_something(&readset, &writeset,
-		    &max_fd2, &nalloc, rekeying);
+		    &max_fd2, &nalloc);
 
 		if (quit_pending)
 			break;
 
-		/* Do channel operations unless rekeying in progress. */
-		if (!rekeying) {
-			channel_after_select(readset, writeset);
-			if (need_rekeying || packet_need_rekeying()) {
-				debug("need rekeying");
-				xxx_kex->done = 0;
-				kex_send_kexinit(xxx_kex);
-				need_rekeying = 0;
-			}
+		/* Do channel operations, even while rekeying. */
+		channel_after_select(readset, writeset);
+		if (!rekeying && (need_rekeying || packet_need_rekeying())) {
+			debug("need rekeying");
+			xxx_kex->done = 0;
+			kex_send_kexinit(xxx_kex);
+			need_rekeying = 0;
 		}
 
 		/* Buffer input from the connection.  */
@@ -1673,6 +1671,14 @@ client_loop(int have_pty, int escape_char_arg, int ssh2_chan_id)
 		    stdin_bytes / total_time, stdout_bytes / total_time,
 		    stderr_bytes / total_time);
 #endif /* _TOH_ */
+	packet_get_rekey_stats(&nrekey, &rekey_total, &rekey_max,
+	    &rekey_bytes);
+	if (nrekey > 0)
+		debug("Rekeyed %u times: outgoing data held for %llu ms "
+		    "total, %llu ms max, up to %llu bytes queued", nrekey,
+		    (unsigned long long)rekey_total / 1000,
+		    (unsigned long long)rekey_max / 1000,
+		    (unsigned long long)rekey_bytes);
 
 	/* Return the exit status of the program. */
 	debug("Exit status %d", exit_status);
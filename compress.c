@@ -15,9 +15,14 @@
 #include "includes.h"
 
 #include <sys/types.h>
+#include <sys/time.h>
 
 #include <stdarg.h>
+#include <string.h>
 #include <zlib.h>
+#ifdef WITH_ZSTD
+#include <zstd.h>
+#endif
 
 #include "log.h"
 #include "buffer.h"
@@ -30,6 +35,148 @@ static int compress_init_recv_called = 0;
 static int inflate_failed = 0;
 static int deflate_failed = 0;
 
+/*
+ * Adaptive compression.  Outgoing data is judged in windows of
+ * ADAPT_WINDOW input bytes.  If a window saved less than ADAPT_MIN_SAVING
+ * percent, or deflate() took most of the wall-clock time of the window
+ * without at least halving the data (i.e. the link is draining faster than
+ * we compress), the stream is switched to stored blocks with deflateParams().
+ * After a back-off of some windows the configured level is tried again;
+ * the back-off doubles for each failed probe.  The receiver needs no
+ * changes, as stored blocks are valid deflate data.
+ */
+#define ADAPT_WINDOW		(256 * 1024)
+#define ADAPT_MIN_SAVING	5	/* percent */
+#define ADAPT_BACKOFF_MIN	4	/* windows */
+#define ADAPT_BACKOFF_MAX	32
+
+static struct {
+	int		 level;		/* configured level */
+	int		 stored;	/* currently sending stored blocks */
+	int		 pending;	/* switch requested for next packet */
+	u_int		 backoff;	/* windows to stay stored */
+	u_int		 left;		/* windows left before probing */
+	u_int64_t	 win_in, win_out, win_usec;
+	struct timeval	 win_start;
+	/* statistics */
+	u_int64_t	 stored_bytes;
+	u_int		 windows, backoffs, probes;
+	u_int64_t	 deflate_usec;
+} adapt;
+
+static void
+adapt_init(int level)
+{
+	memset(&adapt, 0, sizeof(adapt));
+	adapt.level = level;
+	adapt.backoff = ADAPT_BACKOFF_MIN;
+	gettimeofday(&adapt.win_start, NULL);
+}
+
+/* Account one packet and decide whether to change mode at window end. */
+static void
+adapt_update(u_int64_t in, u_int64_t out, u_int64_t usec)
+{
+	struct timeval now, diff;
+	u_int64_t wall;
+
+	adapt.win_in += in;
+	adapt.win_out += out;
+	adapt.win_usec += usec;
+	adapt.deflate_usec += usec;
+	if (adapt.stored)
+		adapt.stored_bytes += in;
+	if (adapt.win_in < ADAPT_WINDOW)
+		return;
+
+	gettimeofday(&now, NULL);
+	timersub(&now, &adapt.win_start, &diff);
+	wall = (u_int64_t)diff.tv_sec * 1000000 + diff.tv_usec;
+	adapt.windows++;
+	if (adapt.stored) {
+		if (--adapt.left == 0) {
+			debug2("compress: probing level %d", adapt.level);
+			adapt.pending = 1;
+			adapt.probes++;
+		}
+	} else if (adapt.win_out * 100 >
+	    adapt.win_in * (100 - ADAPT_MIN_SAVING) ||
+	    (adapt.win_usec * 2 > wall && adapt.win_out * 2 > adapt.win_in)) {
+		debug2("compress: window %llu -> %llu bytes, deflate %llu of "
+		    "%llu usec; sending stored for %u windows",
+		    (unsigned long long)adapt.win_in,
+		    (unsigned long long)adapt.win_out,
+		    (unsigned long long)adapt.win_usec,
+		    (unsigned long long)wall, adapt.backoff);
+		adapt.pending = 1;
+		adapt.left = adapt.backoff;
+		adapt.backoffs++;
+		/* back off longer if the probe that got us here failed too */
+		adapt.backoff = MIN(adapt.backoff * 2, ADAPT_BACKOFF_MAX);
+	} else
+		adapt.backoff = ADAPT_BACKOFF_MIN;
+	adapt.win_in = adapt.win_out = adapt.win_usec = 0;
+	adapt.win_start = now;
+}
+
+/* Applies a pending mode change; may emit a few bytes of stream data. */
+static void
+adapt_switch(Buffer *output_buffer)
+{
+	u_char buf[64];
+	int status;
+
+	adapt.pending = 0;
+	adapt.stored = !adapt.stored;
+	outgoing_stream.next_in = NULL;
+	outgoing_stream.avail_in = 0;
+	outgoing_stream.next_out = buf;
+	outgoing_stream.avail_out = sizeof(buf);
+	status = deflateParams(&outgoing_stream,
+	    adapt.stored ? Z_NO_COMPRESSION : adapt.level, Z_DEFAULT_STRATEGY);
+	if (status != Z_OK) {
+		deflate_failed = 1;
+		fatal("buffer_compress: deflateParams returned %d", status);
+	}
+	buffer_append(output_buffer, buf,
+	    sizeof(buf) - outgoing_stream.avail_out);
+}
+
+#ifdef WITH_ZSTD
+/*
+ * zstd@openssh.com state.  The streams are only created on first use: under
+ * privilege separation compression is switched on in the unprivileged
+ * child, but only the post-authentication child ever compresses.  The
+ * (large) zstd contexts therefore never cross the monitor; the choice of
+ * codec does, with buffer_compress_put_state().
+ */
+#define ZSTD_WINDOWLOG_RECV	23	/* refuse windows above 8MB */
+static int zstd_send = 0, zstd_recv = 0;
+static int zstd_level = 0;
+static ZSTD_CStream *zstd_cstream = NULL;
+static ZSTD_DStream *zstd_dstream = NULL;
+static u_int64_t zstd_send_raw, zstd_send_comp;
+static u_int64_t zstd_recv_raw, zstd_recv_comp;
+
+static void
+zstd_free_send(void)
+{
+	if (zstd_cstream != NULL)
+		ZSTD_freeCStream(zstd_cstream);
+	zstd_cstream = NULL;
+	zstd_send = 0;
+}
+
+static void
+zstd_free_recv(void)
+{
+	if (zstd_dstream != NULL)
+		ZSTD_freeDStream(zstd_dstream);
+	zstd_dstream = NULL;
+	zstd_recv = 0;
+}
+#endif
+
 /*
  * Initializes compression; level is compression level from 1 to 9
  * (as in gzip).
@@ -41,10 +188,14 @@ buffer_compress_init_send(int level)
 	if (compress_init_send_called == 1)
 		deflateEnd(&outgoing_stream);
 	compress_init_send_called = 1;
+#ifdef WITH_ZSTD
+	zstd_free_send();
+#endif
 	debug("Enabling compression at level %d.", level);
 	if (level < 1 || level > 9)
 		fatal("Bad compression level %d.", level);
 	deflateInit(&outgoing_stream, level);
+	adapt_init(level);
 }
 void
 buffer_compress_init_recv(void)
@@ -52,14 +203,220 @@ buffer_compress_init_recv(void)
 	if (compress_init_recv_called == 1)
 		inflateEnd(&incoming_stream);
 	compress_init_recv_called = 1;
+#ifdef WITH_ZSTD
+	zstd_free_recv();
+#endif
 	inflateInit(&incoming_stream);
 }
 
+#ifdef WITH_ZSTD
+/*
+ * Selects zstd for the outgoing direction; level is 1 to 9 as for zlib and
+ * is passed to zstd unchanged.  The stream is set up by buffer_compress().
+ */
+void
+buffer_compress_init_send_zstd(int level)
+{
+	if (compress_init_send_called == 1) {
+		deflateEnd(&outgoing_stream);
+		compress_init_send_called = 0;
+	}
+	zstd_free_send();
+	debug("Enabling zstd compression at level %d.", level);
+	if (level < 1 || level > 9)
+		fatal("Bad compression level %d.", level);
+	zstd_send = 1;
+	zstd_level = level;
+}
+
+void
+buffer_compress_init_recv_zstd(void)
+{
+	if (compress_init_recv_called == 1) {
+		inflateEnd(&incoming_stream);
+		compress_init_recv_called = 0;
+	}
+	zstd_free_recv();
+	zstd_recv = 1;
+}
+
+static void
+buffer_compress_zstd(Buffer *input_buffer, Buffer *output_buffer)
+{
+	u_char buf[4096];
+	ZSTD_inBuffer in;
+	ZSTD_outBuffer out;
+	size_t r;
+
+	if (zstd_cstream == NULL) {
+		if ((zstd_cstream = ZSTD_createCStream()) == NULL)
+			fatal("%s: ZSTD_createCStream failed", __func__);
+		r = ZSTD_initCStream(zstd_cstream, zstd_level);
+		if (ZSTD_isError(r))
+			fatal("%s: ZSTD_initCStream: %s", __func__,
+			    ZSTD_getErrorName(r));
+	}
+	in.src = buffer_ptr(input_buffer);
+	in.size = buffer_len(input_buffer);
+	in.pos = 0;
+	zstd_send_raw += in.size;
+
+	/* Consume all input, then flush so the packet decodes on its own. */
+	do {
+		out.dst = buf;
+		out.size = sizeof(buf);
+		out.pos = 0;
+		r = ZSTD_compressStream(zstd_cstream, &out, &in);
+		if (ZSTD_isError(r))
+			fatal("%s: ZSTD_compressStream: %s", __func__,
+			    ZSTD_getErrorName(r));
+		buffer_append(output_buffer, buf, out.pos);
+		zstd_send_comp += out.pos;
+	} while (in.pos < in.size);
+	do {
+		out.dst = buf;
+		out.size = sizeof(buf);
+		out.pos = 0;
+		r = ZSTD_flushStream(zstd_cstream, &out);
+		if (ZSTD_isError(r))
+			fatal("%s: ZSTD_flushStream: %s", __func__,
+			    ZSTD_getErrorName(r));
+		buffer_append(output_buffer, buf, out.pos);
+		zstd_send_comp += out.pos;
+	} while (r != 0);
+}
+
+static void
+buffer_uncompress_zstd(Buffer *input_buffer, Buffer *output_buffer)
+{
+	u_char buf[4096];
+	ZSTD_inBuffer in;
+	ZSTD_outBuffer out;
+	size_t r;
+
+	if (zstd_dstream == NULL) {
+		if ((zstd_dstream = ZSTD_createDStream()) == NULL)
+			fatal("%s: ZSTD_createDStream failed", __func__);
+		r = ZSTD_initDStream(zstd_dstream);
+		if (ZSTD_isError(r))
+			fatal("%s: ZSTD_initDStream: %s", __func__,
+			    ZSTD_getErrorName(r));
+		r = ZSTD_DCtx_setParameter(zstd_dstream, ZSTD_d_windowLogMax,
+		    ZSTD_WINDOWLOG_RECV);
+		if (ZSTD_isError(r))
+			fatal("%s: ZSTD_DCtx_setParameter: %s", __func__,
+			    ZSTD_getErrorName(r));
+	}
+	in.src = buffer_ptr(input_buffer);
+	in.size = buffer_len(input_buffer);
+	in.pos = 0;
+	zstd_recv_comp += in.size;
+
+	/* Done once all input is consumed and the output was not filled. */
+	for (;;) {
+		out.dst = buf;
+		out.size = sizeof(buf);
+		out.pos = 0;
+		r = ZSTD_decompressStream(zstd_dstream, &out, &in);
+		if (ZSTD_isError(r))
+			fatal("%s: ZSTD_decompressStream: %s", __func__,
+			    ZSTD_getErrorName(r));
+		buffer_append(output_buffer, buf, out.pos);
+		zstd_recv_raw += out.pos;
+		if (in.pos == in.size && out.pos < out.size)
+			break;
+	}
+}
+#endif /* WITH_ZSTD */
+
+/*
+ * Under privilege separation the monitor copies the z_streams from the
+ * unprivileged child to the post-authentication child.  These carry the
+ * rest of the state: which codec is in use in each direction, and the
+ * adaptive compression state that goes with the outgoing z_stream.
+ */
+void
+buffer_compress_put_state(Buffer *m)
+{
+#ifdef WITH_ZSTD
+	if (zstd_cstream != NULL || zstd_dstream != NULL)
+		fatal("%s: zstd stream already in use", __func__);
+	buffer_put_int(m, zstd_send);
+	buffer_put_int(m, zstd_recv);
+	buffer_put_int(m, zstd_level);
+#else
+	buffer_put_int(m, 0);
+	buffer_put_int(m, 0);
+	buffer_put_int(m, 0);
+#endif
+	buffer_put_int(m, adapt.level);
+	buffer_put_int(m, adapt.stored);
+	buffer_put_int(m, adapt.pending);
+	buffer_put_int(m, adapt.backoff);
+	buffer_put_int(m, adapt.left);
+	buffer_put_int64(m, adapt.win_in);
+	buffer_put_int64(m, adapt.win_out);
+	buffer_put_int64(m, adapt.win_usec);
+	buffer_put_int64(m, adapt.stored_bytes);
+	buffer_put_int(m, adapt.windows);
+	buffer_put_int(m, adapt.backoffs);
+	buffer_put_int(m, adapt.probes);
+	buffer_put_int64(m, adapt.deflate_usec);
+}
+
+void
+buffer_compress_get_state(Buffer *m)
+{
+#ifdef WITH_ZSTD
+	zstd_free_send();
+	zstd_free_recv();
+	zstd_send = buffer_get_int(m);
+	zstd_recv = buffer_get_int(m);
+	zstd_level = buffer_get_int(m);
+#else
+	int send, recv;
+
+	send = buffer_get_int(m);
+	recv = buffer_get_int(m);
+	(void)buffer_get_int(m);
+	if (send || recv)
+		fatal("%s: zstd compression not supported", __func__);
+#endif
+	adapt.level = buffer_get_int(m);
+	adapt.stored = buffer_get_int(m);
+	adapt.pending = buffer_get_int(m);
+	adapt.backoff = buffer_get_int(m);
+	adapt.left = buffer_get_int(m);
+	adapt.win_in = buffer_get_int64(m);
+	adapt.win_out = buffer_get_int64(m);
+	adapt.win_usec = buffer_get_int64(m);
+	adapt.stored_bytes = buffer_get_int64(m);
+	adapt.windows = buffer_get_int(m);
+	adapt.backoffs = buffer_get_int(m);
+	adapt.probes = buffer_get_int(m);
+	adapt.deflate_usec = buffer_get_int64(m);
+	gettimeofday(&adapt.win_start, NULL);
+}
+
 /* Frees any data structures allocated for compression. */
 
 void
 buffer_compress_uninit(void)
 {
+#ifdef WITH_ZSTD
+	if (zstd_send || zstd_recv) {
+		debug("zstd outgoing: raw data %llu, compressed %llu, "
+		    "factor %.2f", (unsigned long long)zstd_send_raw,
+		    (unsigned long long)zstd_send_comp, zstd_send_raw == 0 ?
+		    0.0 : (double)zstd_send_comp / zstd_send_raw);
+		debug("zstd incoming: raw data %llu, compressed %llu, "
+		    "factor %.2f", (unsigned long long)zstd_recv_raw,
+		    (unsigned long long)zstd_recv_comp, zstd_recv_raw == 0 ?
+		    0.0 : (double)zstd_recv_comp / zstd_recv_raw);
+		zstd_free_send();
+		zstd_free_recv();
+	}
+#endif
 	debug("compress outgoing: raw data %llu, compressed %llu, factor %.2f",
 #ifndef _TOH_
 	    (unsigned long long)outgoing_stream.total_in,
@@ -70,6 +427,12 @@ buffer_compress_uninit(void)
 #endif /* _TOH_ */
 	    outgoing_stream.total_in == 0 ? 0.0 :
 	    (double) outgoing_stream.total_out / outgoing_stream.total_in);
+	if (adapt.level != 0)
+		debug("compress outgoing: %u windows, %u back-offs, %u probes, "
+		    "%llu bytes stored, %llu usec in deflate",
+		    adapt.windows, adapt.backoffs, adapt.probes,
+		    (unsigned long long)adapt.stored_bytes,
+		    (unsigned long long)adapt.deflate_usec);
 	debug("compress incoming: raw data %llu, compressed %llu, factor %.2f",
 #ifndef _TOH_
 	    (unsigned long long)incoming_stream.total_out,
@@ -100,11 +463,25 @@ buffer_compress(Buffer * input_buffer, Buffer * output_buffer)
 {
 	u_char buf[4096];
 	int status;
+	uLong total_out;
+	struct timeval start, end, diff;
 
 	/* This case is not handled below. */
 	if (buffer_len(input_buffer) == 0)
 		return;
 
+#ifdef WITH_ZSTD
+	if (zstd_send) {
+		buffer_compress_zstd(input_buffer, output_buffer);
+		return;
+	}
+#endif
+
+	total_out = outgoing_stream.total_out;
+	gettimeofday(&start, NULL);
+	if (adapt.pending)
+		adapt_switch(output_buffer);
+
 	/* Input is the contents of the input buffer. */
 	outgoing_stream.next_in = buffer_ptr(input_buffer);
 	outgoing_stream.avail_in = buffer_len(input_buffer);
@@ -129,6 +506,12 @@ buffer_compress(Buffer * input_buffer, Buffer * output_buffer)
 			/* NOTREACHED */
 		}
 	} while (outgoing_stream.avail_out == 0);
+
+	gettimeofday(&end, NULL);
+	timersub(&end, &start, &diff);
+	adapt_update(buffer_len(input_buffer),
+	    outgoing_stream.total_out - total_out,
+	    (u_int64_t)diff.tv_sec * 1000000 + diff.tv_usec);
 }
 
 /*
@@ -146,6 +529,13 @@ buffer_uncompress(Buffer * input_buffer, Buffer * output_buffer)
 	u_char buf[4096];
 	int status;
 
+#ifdef WITH_ZSTD
+	if (zstd_recv) {
+		buffer_uncompress_zstd(input_buffer, output_buffer);
+		return;
+	}
+#endif
+
 	incoming_stream.next_in = buffer_ptr(input_buffer);
 	incoming_stream.avail_in = buffer_len(input_buffer);
 
@@ -18,7 +18,13 @@
 
 void	 buffer_compress_init_send(int);
 void	 buffer_compress_init_recv(void);
+#ifdef WITH_ZSTD
+void	 buffer_compress_init_send_zstd(int);
+void	 buffer_compress_init_recv_zstd(void);
+#endif
 void     buffer_compress_uninit(void);
+void	 buffer_compress_put_state(Buffer *);
+void	 buffer_compress_get_state(Buffer *);
 void     buffer_compress(Buffer *, Buffer *);
 void     buffer_uncompress(Buffer *, Buffer *);
 
@@ -0,0 +1,134 @@
+/*
+ * Placed in the public domain.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+#include <sys/time.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "log.h"
+#include "conntrace.h"
+
+struct phase {
+	char	name[48];
+	double	start;		/* ms since conntrace_init() */
+	double	duration;	/* ms, -1 while the phase is running */
+};
+
+static struct phase trace[CONNTRACE_MAX];
+static u_int ntrace = 0;
+static int tracing = 0;
+static double origin;
+
+/* milliseconds from a clock that does not jump with the wall time */
+static double
+trace_now(void)
+{
+#if defined(_TOH_)
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER count;
+
+	if (freq.QuadPart == 0)
+		QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (double)count.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+	struct timeval tv;
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+		return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+#endif
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#endif /* _TOH_ */
+}
+
+void
+conntrace_init(int enable)
+{
+	tracing = enable;
+	ntrace = 0;
+	origin = trace_now();
+}
+
+int
+conntrace_active(void)
+{
+	return tracing;
+}
+
+/* Returns a handle for conntrace_stop(), or -1 if not tracing. */
+int
+conntrace_start(const char *fmt, ...)
+{
+	struct phase *p;
+	va_list args;
+
+	if (!tracing || ntrace >= CONNTRACE_MAX)
+		return -1;
+	p = &trace[ntrace];
+	va_start(args, fmt);
+	vsnprintf(p->name, sizeof(p->name), fmt, args);
+	va_end(args);
+	p->start = trace_now() - origin;
+	p->duration = -1;
+	return ntrace++;
+}
+
+void
+conntrace_stop(int handle)
+{
+	struct phase *p;
+
+	if (handle < 0 || (u_int)handle >= ntrace)
+		return;
+	p = &trace[handle];
+	if (p->duration >= 0)
+		return;
+	p->duration = trace_now() - origin - p->start;
+	logit("Trace: %-32s at %9.3f ms, took %9.3f ms",
+	    p->name, p->start, p->duration);
+}
+
+/* Connection is up; later rekeying and channels are not traced. */
+void
+conntrace_done(void)
+{
+	if (!tracing)
+		return;
+	tracing = 0;
+	logit("Trace: %-32s at %9.3f ms", "connection ready",
+	    trace_now() - origin);
+}
+
+u_int
+conntrace_count(void)
+{
+	return ntrace;
+}
+
+/*
+ * Fetch a recorded phase: its name, start and duration in milliseconds.
+ * The duration is -1 for a phase that has not finished.
+ */
+int
+conntrace_get(u_int i, const char **name, double *start, double *duration)
+{
+	if (i >= ntrace)
+		return -1;
+	if (name != NULL)
+		*name = trace[i].name;
+	if (start != NULL)
+		*start = trace[i].start;
+	if (duration != NULL)
+		*duration = trace[i].duration;
+	return 0;
+}
@@ -0,0 +1,25 @@
+/*
+ * Placed in the public domain.
+ */
+
+#ifndef CONNTRACE_H
+#define CONNTRACE_H
+
+/*
+ * Timing trace of connection setup, from name lookup to the first
+ * channel.  Phases are logged as they finish and kept so an embedding
+ * application can read them back with conntrace_get().
+ */
+
+#define CONNTRACE_MAX		64
+
+void	 conntrace_init(int);
+int	 conntrace_start(const char *, ...)
+	    __attribute__((format(printf, 1, 2)));
+void	 conntrace_stop(int);
+void	 conntrace_done(void);
+int	 conntrace_active(void);
+u_int	 conntrace_count(void);
+int	 conntrace_get(u_int, const char **, double *, double *);
+
+#endif				/* CONNTRACE_H */
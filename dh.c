@@ -30,15 +30,20 @@
 #include <openssl/bn.h>
 #include <openssl/dh.h>
 
+#include <errno.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
+#include "xmalloc.h"
+#include "buffer.h"
 #include "dh.h"
 #include "pathnames.h"
 #include "log.h"
 #include "misc.h"
+#include "atomicio.h"
 
 static int
 parse_prime(int linenum, char *line, struct dhgroup *dhg)
@@ -108,70 +113,147 @@ parse_prime(int linenum, char *line, struct dhgroup *dhg)
 	return (0);
 }
 
-DH *
-choose_dh(int min, int wantbits, int max)
+/*
+ * The moduli file is parsed once into a table sorted by size.  In sshd this
+ * happens in the listener, so forked children inherit it and re-exec
+ * children receive it with the rest of the rexec state; SIGHUP re-execs
+ * the daemon, which reloads it.
+ */
+static struct dhgroup *moduli;
+static u_int nmoduli;
+static int moduli_loaded;
+
+static int
+dhgroup_cmp(const void *a, const void *b)
+{
+	const struct dhgroup *x = a, *y = b;
+
+	return (x->size - y->size);
+}
+
+static void
+dh_free_moduli(void)
+{
+	u_int i;
+
+	for (i = 0; i < nmoduli; i++) {
+		BN_clear_free(moduli[i].g);
+		BN_clear_free(moduli[i].p);
+	}
+	if (moduli != NULL)
+		xfree(moduli);
+	moduli = NULL;
+	nmoduli = 0;
+	moduli_loaded = 0;
+}
+
+void
+dh_load_moduli(void)
 {
 	FILE *f;
 	char line[4096];
-	int best, bestcount, which;
-	int linenum;
+	int linenum = 0;
 	struct dhgroup dhg;
 
+	dh_free_moduli();
+	moduli_loaded = 1;
+
 	if ((f = fopen(_PATH_DH_MODULI, "r")) == NULL &&
 	    (f = fopen(_PATH_DH_PRIMES, "r")) == NULL) {
 		logit("WARNING: %s does not exist, using fixed modulus",
 		    _PATH_DH_MODULI);
-		return (dh_new_group14());
+		return;
 	}
-
-	linenum = 0;
-	best = bestcount = 0;
 	while (fgets(line, sizeof(line), f)) {
 		linenum++;
 		if (!parse_prime(linenum, line, &dhg))
 			continue;
-		BN_clear_free(dhg.g);
-		BN_clear_free(dhg.p);
-
-		if (dhg.size > max || dhg.size < min)
-			continue;
+		moduli = xrealloc(moduli, nmoduli + 1, sizeof(*moduli));
+		moduli[nmoduli++] = dhg;
+	}
+	fclose(f);
+	if (nmoduli == 0)
+		logit("WARNING: no suitable primes in %s", _PATH_DH_PRIMES);
+	qsort(moduli, nmoduli, sizeof(*moduli), dhgroup_cmp);
+	debug("%s: %u groups", __func__, nmoduli);
+}
 
-		if ((dhg.size > wantbits && dhg.size < best) ||
-		    (dhg.size > best && best < wantbits)) {
-			best = dhg.size;
-			bestcount = 0;
-		}
-		if (dhg.size == best)
-			bestcount++;
+/* Serialises the moduli table, if loaded, for the re-exec protocol. */
+void
+dh_moduli_put(Buffer *m)
+{
+	u_int i;
+
+	buffer_put_int(m, moduli_loaded);
+	if (!moduli_loaded)
+		return;
+	buffer_put_int(m, nmoduli);
+	for (i = 0; i < nmoduli; i++) {
+		buffer_put_int(m, moduli[i].size);
+		buffer_put_bignum2(m, moduli[i].g);
+		buffer_put_bignum2(m, moduli[i].p);
 	}
-	rewind(f);
+}
 
-	if (bestcount == 0) {
-		fclose(f);
-		logit("WARNING: no suitable primes in %s", _PATH_DH_PRIMES);
-		return (dh_new_group14());
+/* Replaces the moduli table with the one sent by dh_moduli_put(). */
+void
+dh_moduli_get(Buffer *m)
+{
+	u_int i, n;
+
+	dh_free_moduli();
+	if (!buffer_get_int(m))
+		return;		/* parsed on first use */
+	if ((n = buffer_get_int(m)) > 64 * 1024)
+		fatal("%s: too many groups: %u", __func__, n);
+	moduli = xcalloc(MAX(n, 1), sizeof(*moduli));
+	for (i = 0; i < n; i++) {
+		moduli[i].size = buffer_get_int(m);
+		if ((moduli[i].g = BN_new()) == NULL ||
+		    (moduli[i].p = BN_new()) == NULL)
+			fatal("%s: BN_new failed", __func__);
+		buffer_get_bignum2(m, moduli[i].g);
+		buffer_get_bignum2(m, moduli[i].p);
 	}
+	nmoduli = n;
+	moduli_loaded = 1;
+	debug3("%s: %u groups", __func__, nmoduli);
+}
 
-	linenum = 0;
-	which = arc4random() % bestcount;
-	while (fgets(line, sizeof(line), f)) {
-		if (!parse_prime(linenum, line, &dhg))
-			continue;
-		if ((dhg.size > max || dhg.size < min) ||
-		    dhg.size != best ||
-		    linenum++ != which) {
-			BN_clear_free(dhg.g);
-			BN_clear_free(dhg.p);
+static int dh_pool_hint(int);
+
+DH *
+choose_dh(int min, int wantbits, int max)
+{
+	int best, bestcount, which;
+	u_int i, first = 0;
+
+	if (!moduli_loaded)
+		dh_load_moduli();
+
+	best = bestcount = 0;
+	for (i = 0; i < nmoduli; i++) {
+		if (moduli[i].size > max || moduli[i].size < min)
 			continue;
+		if ((moduli[i].size > wantbits && moduli[i].size < best) ||
+		    (moduli[i].size > best && best < wantbits)) {
+			best = moduli[i].size;
+			bestcount = 0;
+			first = i;
 		}
-		break;
+		if (moduli[i].size == best)
+			bestcount++;
 	}
-	fclose(f);
-	if (linenum != which+1)
-		fatal("WARNING: line %d disappeared in %s, giving up",
-		    which, _PATH_DH_PRIMES);
+	if (bestcount == 0)
+		return (dh_new_group14());
 
-	return (dh_new_group(dhg.g, dhg.p));
+	/* Prefer a group that already has a precomputed keypair */
+	if ((which = dh_pool_hint(best)) == -1 ||
+	    (u_int)which < first || (u_int)which >= first + bestcount)
+		which = first + arc4random() % bestcount;
+
+	return (dh_new_group(BN_dup(moduli[which].g),
+	    BN_dup(moduli[which].p)));
 }
 
 /* diffie-hellman-groupN-sha1 */
@@ -216,16 +298,13 @@ dh_pub_is_valid(DH *dh, BIGNUM *dh_pub)
 	return 0;
 }
 
-void
-dh_gen_key(DH *dh, int need)
+static int dh_pool_take(DH *, int);
+
+static void
+dh_gen_key_fresh(DH *dh, int need)
 {
 	int i, bits_set, tries = 0;
 
-	if (dh->p == NULL)
-		fatal("dh_gen_key: dh->p == NULL");
-	if (need > INT_MAX / 2 || 2 * need >= BN_num_bits(dh->p))
-		fatal("dh_gen_key: group too small: %d (2*need %d)",
-		    BN_num_bits(dh->p), 2*need);
 	do {
 		if (dh->priv_key != NULL)
 			BN_clear_free(dh->priv_key);
@@ -246,6 +325,18 @@ dh_gen_key(DH *dh, int need)
 	} while (!dh_pub_is_valid(dh, dh->pub_key));
 }
 
+void
+dh_gen_key(DH *dh, int need)
+{
+	if (dh->p == NULL)
+		fatal("dh_gen_key: dh->p == NULL");
+	if (need > INT_MAX / 2 || 2 * need >= BN_num_bits(dh->p))
+		fatal("dh_gen_key: group too small: %d (2*need %d)",
+		    BN_num_bits(dh->p), 2*need);
+	if (!dh_pool_take(dh, need))
+		dh_gen_key_fresh(dh, need);
+}
+
 DH *
 dh_new_group_asc(const char *gen, const char *modulus)
 {
@@ -329,3 +420,369 @@ dh_estimate(int bits)
 		return (2048);	/* O(2**116) */
 	return (4096);		/* O(2**156) */
 }
+
+/*
+ * Pool of precomputed DH keypairs for sshd.  The listener fills it while
+ * idle (dh_pool_fill()), never on the accept path.  Connection
+ * children only keep the groups (dh_pool_forget()); when dh_gen_key() needs
+ * a keypair for one of them, the child asks the listener for it over its
+ * startup pipe (dh_pool_set_fd()) and the listener hands over and removes
+ * exactly that one (dh_pool_serve()), so no keypair is ever used by more
+ * than one session and none is thrown away unused.
+ */
+#define DH_POOL_DEPTH	32
+
+/*
+ * The fixed groups are pooled for the two common 'need' values in bits:
+ * 160 covers AES-128 and anything else with a key or block of at most 20
+ * bytes (hmac-sha1 sets the floor), 256 covers AES-256.  A keypair for a
+ * larger need costs a longer exponentiation in DH_compute_key(), so
+ * dh_pool_take() picks the smallest that will do.
+ */
+struct dhpool_slot {
+	int	 group;		/* 1 or 14 for a fixed group, 0 for DH-GEX */
+	int	 want;		/* DH-GEX requested size */
+	int	 need;		/* keypairs are good up to this 'need' */
+};
+static const struct dhpool_slot dh_pool_slots[] = {
+	{ 1, 0, 160 },		/* diffie-hellman-group1-sha1 */
+	{ 1, 0, 256 },
+	{ 14, 0, 160 },		/* diffie-hellman-group14-sha1 */
+	{ 14, 0, 256 },
+	{ 0, 1024, 128 },	/* DH-GEX, see dh_estimate() */
+	{ 0, 2048, 192 },
+	{ 0, 4096, 256 },
+};
+#define DH_POOL_NSLOTS	(sizeof(dh_pool_slots) / sizeof(dh_pool_slots[0]))
+
+struct dhpool_key {
+	u_int	 slot;
+	int	 need;
+	BIGNUM	*p, *g;
+	BIGNUM	*priv, *pub;	/* NULL once handed away: hint only */
+};
+static struct dhpool_key *dh_pool;
+static u_int dh_pool_len;
+static int dh_pool_dead[DH_POOL_NSLOTS];	/* slot cannot be filled */
+static int dh_pool_fd = -1;	/* child: socket to the listener's pool */
+
+static void
+dh_pool_free_key(struct dhpool_key *k)
+{
+	if (k->priv != NULL)
+		BN_clear_free(k->priv);
+	if (k->pub != NULL)
+		BN_clear_free(k->pub);
+	k->priv = k->pub = NULL;
+}
+
+static void
+dh_pool_remove(u_int i)
+{
+	dh_pool_free_key(&dh_pool[i]);
+	BN_clear_free(dh_pool[i].p);
+	BN_clear_free(dh_pool[i].g);
+	if (i + 1 < dh_pool_len)
+		memmove(&dh_pool[i], &dh_pool[i + 1],
+		    (dh_pool_len - i - 1) * sizeof(*dh_pool));
+	dh_pool_len--;
+}
+
+static void
+dh_pool_add(u_int slot, int need, BIGNUM *p, BIGNUM *g, BIGNUM *priv,
+    BIGNUM *pub)
+{
+	dh_pool = xrealloc(dh_pool, dh_pool_len + 1, sizeof(*dh_pool));
+	dh_pool[dh_pool_len].slot = slot;
+	dh_pool[dh_pool_len].need = need;
+	dh_pool[dh_pool_len].p = p;
+	dh_pool[dh_pool_len].g = g;
+	dh_pool[dh_pool_len].priv = priv;
+	dh_pool[dh_pool_len].pub = pub;
+	dh_pool_len++;
+}
+
+/* Index of the newest usable keypair in 'slot', or -1 */
+static int
+dh_pool_last(u_int slot)
+{
+	int i;
+
+	for (i = (int)dh_pool_len - 1; i >= 0; i--)
+		if (dh_pool[i].slot == slot && dh_pool[i].priv != NULL)
+			return (i);
+	return (-1);
+}
+
+static u_int
+dh_pool_count(u_int slot)
+{
+	u_int i, n = 0;
+
+	for (i = 0; i < dh_pool_len; i++)
+		if (dh_pool[i].slot == slot && dh_pool[i].priv != NULL)
+			n++;
+	return (n);
+}
+
+/*
+ * Asks the listener for the keypair of 'slot'.  Only one is requested per
+ * connection: rekeying is rare enough to pay for a fresh one.
+ */
+static int
+dh_pool_request(DH *dh, u_int slot)
+{
+	Buffer m;
+	BIGNUM *p, *priv, *pub;
+	u_char buf[4], req = slot;
+	u_int len;
+	int fd = dh_pool_fd, ok = 0;
+
+	dh_pool_fd = -1;
+	if (atomicio(vwrite, fd, &req, 1) != 1 ||
+	    atomicio(read, fd, buf, 4) != 4) {
+		error("%s: listener: %s", __func__, strerror(errno));
+		return (0);
+	}
+	if ((len = get_u32(buf)) == 0)
+		return (0);
+	if (len > 256 * 1024)
+		fatal("%s: reply too long: %u", __func__, len);
+	buffer_init(&m);
+	if (atomicio(read, fd, buffer_append_space(&m, len), len) != len)
+		fatal("%s: short read from listener", __func__);
+	if ((p = BN_new()) == NULL || (priv = BN_new()) == NULL ||
+	    (pub = BN_new()) == NULL)
+		fatal("%s: BN_new failed", __func__);
+	buffer_get_bignum2(&m, p);
+	buffer_get_bignum2(&m, priv);
+	buffer_get_bignum2(&m, pub);
+	buffer_free(&m);
+	/* The listener may have moved the slot to another prime meanwhile */
+	if (BN_cmp(p, dh->p) == 0) {
+		if (dh->priv_key != NULL)
+			BN_clear_free(dh->priv_key);
+		if (dh->pub_key != NULL)
+			BN_clear_free(dh->pub_key);
+		dh->priv_key = priv;
+		dh->pub_key = pub;
+		ok = 1;
+	} else {
+		BN_clear_free(priv);
+		BN_clear_free(pub);
+	}
+	BN_clear_free(p);
+	return (ok);
+}
+
+/*
+ * Uses the pooled keypair for dh's group with the smallest sufficient
+ * 'need': one of our own, or else one asked from the listener.
+ */
+static int
+dh_pool_take(DH *dh, int need)
+{
+	u_int i;
+	int best = -1, local;
+
+	/* a keypair at hand beats a request to the listener */
+	for (local = 1; local >= 0 && best == -1; local--) {
+		for (i = 0; i < dh_pool_len; i++) {
+			if ((dh_pool[i].priv != NULL) != local ||
+			    dh_pool[i].need < need ||
+			    BN_cmp(dh_pool[i].p, dh->p) != 0 ||
+			    BN_cmp(dh_pool[i].g, dh->g) != 0)
+				continue;
+			if (best == -1 || dh_pool[i].need < dh_pool[best].need)
+				best = i;
+		}
+	}
+	if (best == -1)
+		return (0);
+	if (dh_pool[best].priv == NULL) {
+		if (dh_pool_fd == -1 ||
+		    !dh_pool_request(dh, dh_pool[best].slot))
+			return (0);
+		debug2("dh_gen_key: using listener's keypair");
+		return (1);
+	}
+	if (dh->priv_key != NULL)
+		BN_clear_free(dh->priv_key);
+	if (dh->pub_key != NULL)
+		BN_clear_free(dh->pub_key);
+	dh->priv_key = dh_pool[best].priv;
+	dh->pub_key = dh_pool[best].pub;
+	dh_pool[best].priv = dh_pool[best].pub = NULL;
+	dh_pool_remove(best);
+	debug2("dh_gen_key: using precomputed keypair");
+	return (1);
+}
+
+/* Moduli table index of a group of 'size' bits that has a keypair ready */
+static int
+dh_pool_hint(int size)
+{
+	u_int i, j;
+
+	for (i = 0; i < dh_pool_len; i++) {
+		if (dh_pool_slots[dh_pool[i].slot].group != 0 ||
+		    BN_num_bits(dh_pool[i].p) != size)
+			continue;
+		for (j = 0; j < nmoduli; j++)
+			if (moduli[j].size == size &&
+			    BN_cmp(moduli[j].p, dh_pool[i].p) == 0)
+				return (j);
+	}
+	return (-1);
+}
+
+/* Returns 1 if every slot that can be filled holds DH_POOL_DEPTH keypairs. */
+int
+dh_pool_full(void)
+{
+	u_int slot;
+
+	for (slot = 0; slot < DH_POOL_NSLOTS; slot++)
+		if (!dh_pool_dead[slot] && dh_pool_count(slot) < DH_POOL_DEPTH)
+			return (0);
+	return (1);
+}
+
+/*
+ * Generates one keypair for the emptiest slot; called by the sshd listener
+ * while it has nothing else to do, so each call should stay short.  A slot
+ * that cannot be filled (no suitable group) is given up on, so the
+ * listener does not keep polling for it.
+ */
+void
+dh_pool_fill(void)
+{
+	const struct dhpool_slot *s;
+	u_int slot, n, best = 0, bestn = DH_POOL_DEPTH;
+	DH *dh;
+	int i;
+
+	for (slot = 0; slot < DH_POOL_NSLOTS; slot++)
+		if (!dh_pool_dead[slot] && (n = dh_pool_count(slot)) < bestn) {
+			best = slot;
+			bestn = n;
+		}
+	if (bestn >= DH_POOL_DEPTH)
+		return;
+	s = &dh_pool_slots[best];
+	if (s->group == 0) {
+		/* stick to one prime per slot, so the hint is useful */
+		if ((i = dh_pool_last(best)) != -1)
+			dh = dh_new_group(BN_dup(dh_pool[i].g),
+			    BN_dup(dh_pool[i].p));
+		else
+			dh = choose_dh(DH_GRP_MIN, s->want, DH_GRP_MAX);
+	} else
+		dh = s->group == 1 ? dh_new_group1() : dh_new_group14();
+	if (2 * s->need >= BN_num_bits(dh->p)) {
+		debug("%s: no group for slot %u", __func__, best);
+		dh_pool_dead[best] = 1;
+		DH_free(dh);
+		return;
+	}
+	dh_gen_key_fresh(dh, s->need);
+	dh_pool_add(best, s->need, dh->p, dh->g, dh->priv_key, dh->pub_key);
+	dh->p = dh->g = dh->priv_key = dh->pub_key = NULL;
+	DH_free(dh);
+}
+
+/*
+ * Listener side of dh_pool_request(): reads one request from a connection
+ * child and hands it the newest keypair of the slot, which is removed from
+ * the pool.  'fd' is non-blocking.  Returns -1 if the child has gone away
+ * or misbehaves, so the caller closes its startup pipe.
+ */
+int
+dh_pool_serve(int fd)
+{
+	Buffer m;
+	u_char req, buf[4];
+	ssize_t len;
+	int i;
+
+	if ((len = read(fd, &req, 1)) == -1 &&
+	    (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+		return (0);
+	if (len != 1)
+		return (-1);	/* EOF: authenticated or exited */
+	buffer_init(&m);
+	buffer_append_space(&m, 4);
+	if (req < DH_POOL_NSLOTS && (i = dh_pool_last(req)) != -1) {
+		buffer_put_bignum2(&m, dh_pool[i].p);
+		buffer_put_bignum2(&m, dh_pool[i].priv);
+		buffer_put_bignum2(&m, dh_pool[i].pub);
+		dh_pool_remove(i);
+	}
+	put_u32(buf, buffer_len(&m) - 4);
+	memcpy(buffer_ptr(&m), buf, 4);
+	/* A well-behaved child waits for the reply, so this never blocks */
+	len = write(fd, buffer_ptr(&m), buffer_len(&m));
+	i = len == (ssize_t)buffer_len(&m) ? 0 : -1;
+	buffer_free(&m);
+	return (i);
+}
+
+/* Connection child: where dh_gen_key() asks for a pooled keypair. */
+void
+dh_pool_set_fd(int fd)
+{
+	dh_pool_fd = fd;
+}
+
+/*
+ * Drops all private keys but remembers the groups, so a connection child
+ * (and its privsep monitor's choose_dh()) still prefers the groups the
+ * listener has keypairs for.
+ */
+void
+dh_pool_forget(void)
+{
+	u_int i;
+
+	for (i = 0; i < dh_pool_len; i++)
+		dh_pool_free_key(&dh_pool[i]);
+}
+
+/* Serialises the newest group of each slot, for the re-exec protocol. */
+void
+dh_pool_put(Buffer *m)
+{
+	u_int slot;
+	int i;
+
+	for (slot = 0; slot < DH_POOL_NSLOTS; slot++) {
+		if ((i = dh_pool_last(slot)) == -1)
+			continue;
+		buffer_put_int(m, slot);
+		buffer_put_int(m, dh_pool[i].need);
+		buffer_put_bignum2(m, dh_pool[i].p);
+		buffer_put_bignum2(m, dh_pool[i].g);
+	}
+	buffer_put_int(m, DH_POOL_NSLOTS);	/* end marker */
+}
+
+/* Replaces the pool with the groups sent by dh_pool_put(). */
+void
+dh_pool_get(Buffer *m)
+{
+	BIGNUM *p, *g;
+	u_int slot;
+	int need;
+
+	while (dh_pool_len > 0)
+		dh_pool_remove(dh_pool_len - 1);
+	while ((slot = buffer_get_int(m)) < DH_POOL_NSLOTS) {
+		need = buffer_get_int(m);
+		if ((p = BN_new()) == NULL || (g = BN_new()) == NULL)
+			fatal("%s: BN_new failed", __func__);
+		buffer_get_bignum2(m, p);
+		buffer_get_bignum2(m, g);
+		dh_pool_add(slot, need, p, g, NULL, NULL);
+	}
+	debug3("%s: %u groups", __func__, dh_pool_len);
+}
@@ -32,6 +32,9 @@ struct dhgroup {
 	BIGNUM *p;
 };
 
+void	 dh_load_moduli(void);
+void	 dh_moduli_put(Buffer *);
+void	 dh_moduli_get(Buffer *);
 DH	*choose_dh(int, int, int);
 DH	*dh_new_group_asc(const char *, const char *);
 DH	*dh_new_group(BIGNUM *, BIGNUM *);
@@ -43,6 +46,14 @@ int	 dh_pub_is_valid(DH *, BIGNUM *);
 
 int	 dh_estimate(int);
 
+int	 dh_pool_full(void);
+void	 dh_pool_fill(void);
+int	 dh_pool_serve(int);
+void	 dh_pool_set_fd(int);
+void	 dh_pool_forget(void);
+void	 dh_pool_put(Buffer *);
+void	 dh_pool_get(Buffer *);
+
 #define DH_GRP_MIN	1024
 #define DH_GRP_MAX	8192
 
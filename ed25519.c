@@ -0,0 +1,609 @@
+/*
+ * Placed in the public domain.
+ *
+ * Ed25519 signatures (RFC 8032).  The field arithmetic and scalar
+ * reduction follow TweetNaCl (Bernstein, van Gastel, Janssen, Lange,
+ * Schwabe, Smetsers; public domain).  Signing uses a precomputed table
+ * for the fixed-base multiplication (ed25519_base.h, signed radix 16, as
+ * in the ref10 implementation) so that a signature costs a few hundred
+ * field multiplications instead of two full scalar multiplications.
+ * SHA-512 comes from libcrypto.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <string.h>
+
+#include <openssl/evp.h>
+
+#include "log.h"
+#include "ed25519.h"
+
+typedef int64_t gf[16];
+
+#include "ed25519_base.h"
+
+static const gf gf0;
+static const gf gf1 = { 1 };
+
+static const u_char L[32] = {
+	0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+	0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+static void
+sha512(u_char out[64], const u_char *in, size_t len)
+{
+	if (!EVP_Digest(in, len, out, NULL, EVP_sha512(), NULL))
+		fatal("%s: EVP_Digest failed", __func__);
+}
+
+/* Field arithmetic mod 2^255 - 19, 16 limbs of 16 bits */
+
+static void
+fe_copy(gf r, const gf a)
+{
+	int i;
+
+	for (i = 0; i < 16; i++)
+		r[i] = a[i];
+}
+
+static void
+fe_carry(gf o)
+{
+	int64_t c;
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		o[i] += (1LL << 16);
+		c = o[i] >> 16;
+		o[(i + 1) * (i < 15)] += c - 1 + 37 * (c - 1) * (i == 15);
+		o[i] -= c * 65536;
+	}
+}
+
+/* Swaps p and q if b is 1, in constant time */
+static void
+fe_cswap(gf p, gf q, int b)
+{
+	int64_t t, c = ~(b - 1);
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		t = c & (p[i] ^ q[i]);
+		p[i] ^= t;
+		q[i] ^= t;
+	}
+}
+
+/* Sets p to q if b is 1, in constant time */
+static void
+fe_cmov(gf p, const gf q, int b)
+{
+	int64_t c = ~(b - 1);
+	int i;
+
+	for (i = 0; i < 16; i++)
+		p[i] ^= c & (p[i] ^ q[i]);
+}
+
+static void
+fe_pack(u_char *o, const gf n)
+{
+	int i, j, b;
+	gf m, t;
+
+	fe_copy(t, n);
+	fe_carry(t);
+	fe_carry(t);
+	fe_carry(t);
+	for (j = 0; j < 2; j++) {
+		m[0] = t[0] - 0xffed;
+		for (i = 1; i < 15; i++) {
+			m[i] = t[i] - 0xffff - ((m[i - 1] >> 16) & 1);
+			m[i - 1] &= 0xffff;
+		}
+		m[15] = t[15] - 0x7fff - ((m[14] >> 16) & 1);
+		b = (m[15] >> 16) & 1;
+		m[14] &= 0xffff;
+		fe_cswap(t, m, 1 - b);
+	}
+	for (i = 0; i < 16; i++) {
+		o[2 * i] = t[i] & 0xff;
+		o[2 * i + 1] = t[i] >> 8;
+	}
+}
+
+static void
+fe_unpack(gf o, const u_char *n)
+{
+	int i;
+
+	for (i = 0; i < 16; i++)
+		o[i] = n[2 * i] + ((int64_t)n[2 * i + 1] << 8);
+	o[15] &= 0x7fff;
+}
+
+static int
+fe_neq(const gf a, const gf b)
+{
+	u_char c[32], d[32];
+
+	fe_pack(c, a);
+	fe_pack(d, b);
+	return memcmp(c, d, 32) != 0;
+}
+
+static int
+fe_parity(const gf a)
+{
+	u_char d[32];
+
+	fe_pack(d, a);
+	return d[0] & 1;
+}
+
+static void
+fe_add(gf o, const gf a, const gf b)
+{
+	int i;
+
+	for (i = 0; i < 16; i++)
+		o[i] = a[i] + b[i];
+}
+
+static void
+fe_sub(gf o, const gf a, const gf b)
+{
+	int i;
+
+	for (i = 0; i < 16; i++)
+		o[i] = a[i] - b[i];
+}
+
+static void
+fe_mul(gf o, const gf a, const gf b)
+{
+	int64_t t[31];
+	int i, j;
+
+	for (i = 0; i < 31; i++)
+		t[i] = 0;
+	for (i = 0; i < 16; i++)
+		for (j = 0; j < 16; j++)
+			t[i + j] += a[i] * b[j];
+	for (i = 0; i < 15; i++)
+		t[i] += 38 * t[i + 16];
+	for (i = 0; i < 16; i++)
+		o[i] = t[i];
+	fe_carry(o);
+	fe_carry(o);
+}
+
+static void
+fe_sq(gf o, const gf a)
+{
+	fe_mul(o, a, a);
+}
+
+static void
+fe_invert(gf o, const gf i)
+{
+	gf c;
+	int a;
+
+	fe_copy(c, i);
+	for (a = 253; a >= 0; a--) {
+		fe_sq(c, c);
+		if (a != 2 && a != 4)
+			fe_mul(c, c, i);
+	}
+	fe_copy(o, c);
+}
+
+static void
+fe_pow2523(gf o, const gf i)
+{
+	gf c;
+	int a;
+
+	fe_copy(c, i);
+	for (a = 250; a >= 0; a--) {
+		fe_sq(c, c);
+		if (a != 1)
+			fe_mul(c, c, i);
+	}
+	fe_copy(o, c);
+}
+
+/* Group arithmetic in extended coordinates (X:Y:Z:T), x = X/Z, y = Y/Z */
+
+static void
+ge_zero(gf p[4])
+{
+	fe_copy(p[0], gf0);
+	fe_copy(p[1], gf1);
+	fe_copy(p[2], gf1);
+	fe_copy(p[3], gf0);
+}
+
+static void
+ge_add(gf p[4], gf q[4])
+{
+	gf a, b, c, d, t, e, f, g, h;
+
+	fe_sub(a, p[1], p[0]);
+	fe_sub(t, q[1], q[0]);
+	fe_mul(a, a, t);
+	fe_add(b, p[0], p[1]);
+	fe_add(t, q[0], q[1]);
+	fe_mul(b, b, t);
+	fe_mul(c, p[3], q[3]);
+	fe_mul(c, c, D2);
+	fe_mul(d, p[2], q[2]);
+	fe_add(d, d, d);
+	fe_sub(e, b, a);
+	fe_sub(f, d, c);
+	fe_add(g, d, c);
+	fe_add(h, b, a);
+
+	fe_mul(p[0], e, f);
+	fe_mul(p[1], h, g);
+	fe_mul(p[2], g, f);
+	fe_mul(p[3], e, h);
+}
+
+static void
+ge_double(gf p[4])
+{
+	gf a, b, c, e, f, g, h;
+
+	fe_sq(a, p[0]);
+	fe_sq(b, p[1]);
+	fe_sq(c, p[2]);
+	fe_add(c, c, c);
+	fe_add(h, a, b);
+	fe_add(e, p[0], p[1]);
+	fe_sq(e, e);
+	fe_sub(e, h, e);
+	fe_sub(g, a, b);
+	fe_add(f, c, g);
+
+	fe_mul(p[0], e, f);
+	fe_mul(p[1], g, h);
+	fe_mul(p[2], f, g);
+	fe_mul(p[3], e, h);
+}
+
+/* Adds an affine point given as (y + x, y - x, 2dxy) */
+static void
+ge_madd(gf p[4], gf q[3])
+{
+	gf a, b, c, d, e, f, g, h;
+
+	fe_sub(a, p[1], p[0]);
+	fe_mul(a, a, q[1]);
+	fe_add(b, p[1], p[0]);
+	fe_mul(b, b, q[0]);
+	fe_mul(c, p[3], q[2]);
+	fe_add(d, p[2], p[2]);
+	fe_sub(e, b, a);
+	fe_sub(f, d, c);
+	fe_add(g, d, c);
+	fe_add(h, b, a);
+
+	fe_mul(p[0], e, f);
+	fe_mul(p[1], h, g);
+	fe_mul(p[2], g, f);
+	fe_mul(p[3], e, h);
+}
+
+static void
+ge_pack(u_char *r, gf p[4])
+{
+	gf tx, ty, zi;
+
+	fe_invert(zi, p[2]);
+	fe_mul(tx, p[0], zi);
+	fe_mul(ty, p[1], zi);
+	fe_pack(r, ty);
+	r[31] ^= fe_parity(tx) << 7;
+}
+
+/* Loads -P from its encoding; returns -1 if it is not a valid point */
+static int
+ge_unpack_neg(gf r[4], const u_char p[32])
+{
+	gf t, chk, num, den, den2, den4, den6;
+
+	fe_copy(r[2], gf1);
+	fe_unpack(r[1], p);
+	fe_sq(num, r[1]);
+	fe_mul(den, num, D);
+	fe_sub(num, num, r[2]);
+	fe_add(den, r[2], den);
+
+	fe_sq(den2, den);
+	fe_sq(den4, den2);
+	fe_mul(den6, den4, den2);
+	fe_mul(t, den6, num);
+	fe_mul(t, t, den);
+
+	fe_pow2523(t, t);
+	fe_mul(t, t, num);
+	fe_mul(t, t, den);
+	fe_mul(t, t, den);
+	fe_mul(r[0], t, den);
+
+	fe_sq(chk, r[0]);
+	fe_mul(chk, chk, den);
+	if (fe_neq(chk, num))
+		fe_mul(r[0], r[0], I);
+
+	fe_sq(chk, r[0]);
+	fe_mul(chk, chk, den);
+	if (fe_neq(chk, num))
+		return -1;
+
+	if (fe_parity(r[0]) == (p[31] >> 7))
+		fe_sub(r[0], gf0, r[0]);
+
+	fe_mul(r[3], r[0], r[1]);
+	return 0;
+}
+
+/* Constant time lookup of b * 16^(2 * pos) * B, -8 <= b <= 8 */
+static void
+ge_select(gf t[3], int pos, int b)
+{
+	int bneg = (b >> 8) & 1;	/* b is at least -8 */
+	int babs = b - 2 * (-bneg & b);
+	gf minus;
+	int i;
+
+	fe_copy(t[0], gf1);
+	fe_copy(t[1], gf1);
+	fe_copy(t[2], gf0);
+	for (i = 0; i < 8; i++) {
+		fe_cmov(t[0], base[pos][i][0], babs == i + 1);
+		fe_cmov(t[1], base[pos][i][1], babs == i + 1);
+		fe_cmov(t[2], base[pos][i][2], babs == i + 1);
+	}
+	/* -(x, y) = (-x, y): swap y+x and y-x, negate 2dxy */
+	fe_cswap(t[0], t[1], bneg);
+	fe_sub(minus, gf0, t[2]);
+	fe_cmov(t[2], minus, bneg);
+}
+
+/* p = a * B, where a is a 256-bit little-endian scalar */
+static void
+ge_scalarmult_base(gf p[4], const u_char a[32])
+{
+	signed char e[64];
+	int carry, i;
+	gf t[3];
+
+	for (i = 0; i < 32; i++) {
+		e[2 * i] = a[i] & 15;
+		e[2 * i + 1] = (a[i] >> 4) & 15;
+	}
+	/* recode to digits in [-8, 8) except the last, in [-8, 8] */
+	carry = 0;
+	for (i = 0; i < 63; i++) {
+		e[i] += carry;
+		carry = (e[i] + 8) >> 4;
+		e[i] -= carry << 4;
+	}
+	e[63] += carry;
+
+	ge_zero(p);
+	for (i = 1; i < 64; i += 2) {
+		ge_select(t, i / 2, e[i]);
+		ge_madd(p, t);
+	}
+	ge_double(p);
+	ge_double(p);
+	ge_double(p);
+	ge_double(p);
+	for (i = 0; i < 64; i += 2) {
+		ge_select(t, i / 2, e[i]);
+		ge_madd(p, t);
+	}
+}
+
+/* p = a * q; variable time, for public inputs only */
+static void
+ge_scalarmult_vartime(gf p[4], gf q[4], const u_char a[32])
+{
+	gf tab[16][4];
+	int i, j, w;
+
+	ge_zero(tab[0]);
+	for (i = 1; i < 16; i++) {
+		for (j = 0; j < 4; j++)
+			fe_copy(tab[i][j], tab[i - 1][j]);
+		ge_add(tab[i], q);
+	}
+	ge_zero(p);
+	for (i = 63; i >= 0; i--) {
+		ge_double(p);
+		ge_double(p);
+		ge_double(p);
+		ge_double(p);
+		if ((w = (a[i / 2] >> (4 * (i & 1))) & 15) != 0)
+			ge_add(p, tab[w]);
+	}
+}
+
+/* Scalar arithmetic mod L */
+
+static void
+sc_modL(u_char *r, int64_t x[64])
+{
+	int64_t carry;
+	int i, j;
+
+	for (i = 63; i >= 32; i--) {
+		carry = 0;
+		for (j = i - 32; j < i - 12; j++) {
+			x[j] += carry - 16 * x[i] * L[j - (i - 32)];
+			carry = (x[j] + 128) >> 8;
+			x[j] -= carry * 256;
+		}
+		x[j] += carry;
+		x[i] = 0;
+	}
+	carry = 0;
+	for (j = 0; j < 32; j++) {
+		x[j] += carry - (x[31] >> 4) * L[j];
+		carry = x[j] >> 8;
+		x[j] &= 255;
+	}
+	for (j = 0; j < 32; j++)
+		x[j] -= carry * L[j];
+	for (i = 0; i < 32; i++) {
+		x[i + 1] += x[i] >> 8;
+		r[i] = x[i] & 255;
+	}
+}
+
+static void
+sc_reduce(u_char r[64])
+{
+	int64_t x[64];
+	int i;
+
+	for (i = 0; i < 64; i++)
+		x[i] = (u_int64_t)r[i];
+	for (i = 0; i < 64; i++)
+		r[i] = 0;
+	sc_modL(r, x);
+}
+
+/* Returns 1 if the 32-byte little-endian s is canonical, i.e. s < L */
+static int
+sc_is_canonical(const u_char s[32])
+{
+	int i;
+
+	for (i = 31; i >= 0; i--) {
+		if (s[i] < L[i])
+			return 1;
+		if (s[i] > L[i])
+			return 0;
+	}
+	return 0;
+}
+
+static void
+expand_secret(u_char d[64], const u_char *sk)
+{
+	sha512(d, sk, 32);
+	d[0] &= 248;
+	d[31] &= 127;
+	d[31] |= 64;
+}
+
+int
+crypto_sign_ed25519_keypair(u_char *pk, u_char *sk)
+{
+	u_char d[64];
+	gf p[4];
+	int i;
+
+	arc4random_buf(sk, 32);
+	expand_secret(d, sk);
+	ge_scalarmult_base(p, d);
+	ge_pack(pk, p);
+	for (i = 0; i < 32; i++)
+		sk[32 + i] = pk[i];
+	memset(d, 0, sizeof(d));
+	return 0;
+}
+
+/* sm = signature || m; sm must have room for mlen + 64 bytes */
+int
+crypto_sign_ed25519(u_char *sm, unsigned long long *smlen,
+    const u_char *m, unsigned long long mlen, const u_char *sk)
+{
+	u_char d[64], h[64], r[64];
+	int64_t x[64];
+	unsigned long long i;
+	int j;
+	gf p[4];
+
+	expand_secret(d, sk);
+
+	*smlen = mlen + 64;
+	memmove(sm + 64, m, mlen);
+	memcpy(sm + 32, d + 32, 32);
+
+	/* r = H(prefix || m) */
+	sha512(r, sm + 32, mlen + 32);
+	sc_reduce(r);
+	ge_scalarmult_base(p, r);
+	ge_pack(sm, p);
+
+	/* h = H(R || A || m) */
+	memcpy(sm + 32, sk + 32, 32);
+	sha512(h, sm, mlen + 64);
+	sc_reduce(h);
+
+	/* S = r + h * a */
+	for (i = 0; i < 64; i++)
+		x[i] = 0;
+	for (i = 0; i < 32; i++)
+		x[i] = (u_int64_t)r[i];
+	for (i = 0; i < 32; i++)
+		for (j = 0; j < 32; j++)
+			x[i + j] += h[i] * (u_int64_t)d[j];
+	sc_modL(sm + 32, x);
+
+	memset(d, 0, sizeof(d));
+	memset(r, 0, sizeof(r));
+	return 0;
+}
+
+/*
+ * Verifies sm = signature || message.  On success the message is copied
+ * to m, which must have room for smlen bytes.
+ */
+int
+crypto_sign_ed25519_open(u_char *m, unsigned long long *mlen,
+    const u_char *sm, unsigned long long smlen, const u_char *pk)
+{
+	u_char t[32], h[64];
+	gf p[4], q[4];
+
+	*mlen = (unsigned long long)-1;
+	if (smlen < 64 || !sc_is_canonical(sm + 32))
+		return -1;
+	if (ge_unpack_neg(q, pk) != 0)
+		return -1;
+
+	/* h = H(R || A || m) */
+	memmove(m, sm, smlen);
+	memcpy(m + 32, pk, 32);
+	sha512(h, m, smlen);
+	sc_reduce(h);
+
+	/* R' = S * B - h * A */
+	ge_scalarmult_vartime(p, q, h);
+	ge_scalarmult_base(q, sm + 32);
+	ge_add(p, q);
+	ge_pack(t, p);
+
+	smlen -= 64;
+	if (memcmp(sm, t, 32) != 0) {
+		memset(m, 0, smlen);
+		return -1;
+	}
+	memmove(m, sm + 64, smlen);
+	*mlen = smlen;
+	return 0;
+}
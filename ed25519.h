@@ -0,0 +1,18 @@
+/*
+ * Placed in the public domain.
+ */
+
+#ifndef ED25519_H
+#define ED25519_H
+
+#define ED25519_SK_SZ	64	/* 32-byte seed followed by the public key */
+#define ED25519_PK_SZ	32
+#define ED25519_SIG_SZ	64
+
+int	crypto_sign_ed25519_keypair(u_char *, u_char *);
+int	crypto_sign_ed25519(u_char *, unsigned long long *, const u_char *,
+    unsigned long long, const u_char *);
+int	crypto_sign_ed25519_open(u_char *, unsigned long long *, const u_char *,
+    unsigned long long, const u_char *);
+
+#endif				/* ED25519_H */
@@ -39,23 +39,99 @@
 #include "includes.h"
 
 #include <sys/types.h>
+#include <sys/stat.h>
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
 
 #include <netinet/in.h>
 
 #include <openssl/hmac.h>
 #include <openssl/sha.h>
 
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <resolv.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "xmalloc.h"
 #include "match.h"
 #include "key.h"
 #include "hostfile.h"
 #include "log.h"
+#include "misc.h"
+#include "atomicio.h"
+
+/*
+ * known_hosts index.
+ *
+ * Scanning a large known_hosts file costs a parse per line and an HMAC
+ * per hashed entry on every lookup.  "<file>.idx" records where a host
+ * may match: plain names in a hash table, hashed (|1|) entries as
+ * precomputed HMAC state and digest, and lines using patterns in a
+ * list that is always checked.  Each hashed entry has its own salt, so
+ * those still cost an HMAC per entry, but no parsing or decoding.  The
+ * index only narrows down which lines are read; every candidate is
+ * checked exactly as an unindexed scan would.
+ *
+ * The index is tied to the size, mtime, inode and device of the file
+ * it describes.  add_host_to_hostfile() moves those forward when it
+ * appends; lines after the indexed region are scanned normally.  Only
+ * the owner of a known_hosts file builds its index, and an index is
+ * only trusted if that user owns it and it is not group or world
+ * writable.
+ */
+#define HOSTIDX_SUFFIX		".idx"
+#define HOSTIDX_MAGIC		"KHIDX001"
+#define HOSTIDX_MIN_SIZE	(64 * 1024)	/* smaller files are scanned */
+#define HOSTIDX_MAX_SIZE	(0x7fffffff)
+#define HOSTIDX_MAX_TAIL	(64 * 1024)	/* rebuild past this */
+#define HOSTIDX_NONE		(0xffffffff)
+
+struct hostidx_hdr {
+	char magic[8];
+	u_int32_t hdrsize;
+	u_int32_t nbuckets, nplain, nhashed, nscan;
+	u_int32_t indexed_size, indexed_lines;
+	u_int64_t kh_size, kh_mtime, kh_ino, kh_dev;
+};
+
+/* a line and its position in the known_hosts file */
+struct hostidx_line {
+	u_int32_t off, linenum;
+};
+
+struct hostidx_plain {
+	u_int32_t hash, next;
+	struct hostidx_line l;
+};
+
+/*
+ * Hashed entries keep the SHA1 state after the inner and outer HMAC key
+ * blocks (see ssh_sha1_block()), so checking a host costs two
+ * compressions instead of a full HMAC keyed with the entry's salt.
+ */
+struct hostidx_hashed {
+	u_int32_t istate[5], ostate[5];
+	u_char digest[SHA_DIGEST_LENGTH];
+	struct hostidx_line l;
+};
+
+struct hostidx {
+	u_char *data;
+	size_t len;
+	int mapped;
+	struct hostidx_hdr *hdr;
+	u_int32_t *buckets;
+	struct hostidx_plain *plain;
+	struct hostidx_hashed *hashed;
+	struct hostidx_line *scan;
+};
 
 static int
 extract_salt(const char *s, u_int l, char *salt, size_t salt_len)
@@ -111,14 +187,13 @@ host_hash(const char *host, const char *name_from_hostfile, u_int src_len)
 	HMAC_CTX mac_ctx;
 	char salt[256], result[256], uu_salt[512], uu_result[512];
 	static char encoded[1024];
-	u_int i, len;
+	u_int len;
 
 	len = EVP_MD_size(md);
 
 	if (name_from_hostfile == NULL) {
 		/* Create new salt */
-		for (i = 0; i < len; i++)
-			salt[i] = arc4random();
+		arc4random_buf(salt, len);
 	} else {
 		/* Extract salt from known host entry */
 		if (extract_salt(name_from_hostfile, src_len, salt,
@@ -142,8 +217,9 @@ host_hash(const char *host, const char *name_from_hostfile, u_int src_len)
 }
 
 /*
- * Parses an RSA (number of bits, e, n) or DSA key from a string.  Moves the
- * pointer over the key.  Skips any whitespace at the beginning and at end.
+ * Parses an RSA (number of bits, e, n) key or an SSH2 key (RSA, DSA, ECDSA
+ * or Ed25519; "type base64-blob") from a string.  Moves the pointer over
+ * the key.  Skips any whitespace at the beginning and at end.
  */
 
 int
@@ -183,6 +259,516 @@ hostfile_check_key(int bits, const Key *key, const char *host, const char *filen
 	return 1;
 }
 
+static void
+hostidx_sha1_state(const u_char *salt, u_char pad, u_int32_t *state)
+{
+	u_char block[SSH_SHA1_BLOCK];
+	u_int i;
+
+	memset(block, pad, sizeof(block));
+	for (i = 0; i < SHA_DIGEST_LENGTH; i++)
+		block[i] ^= salt[i];
+	ssh_sha1_init(state);
+	ssh_sha1_block(state, block);
+	memset(block, 0, sizeof(block));
+}
+
+/* Finish a hash from a state saved after one block */
+static void
+hostidx_sha1_finish(const u_int32_t *state, const void *data, size_t len,
+    u_char *digest)
+{
+	const u_char *p = data;
+	u_char block[SSH_SHA1_BLOCK];
+	u_int32_t h[5];
+	u_int64_t bits = ((u_int64_t)len + SSH_SHA1_BLOCK) * 8;
+	u_int i;
+
+	memcpy(h, state, sizeof(h));
+	for (; len >= SSH_SHA1_BLOCK; len -= SSH_SHA1_BLOCK) {
+		ssh_sha1_block(h, p);
+		p += SSH_SHA1_BLOCK;
+	}
+	memset(block, 0, sizeof(block));
+	memcpy(block, p, len);
+	block[len] = 0x80;
+	if (len >= SSH_SHA1_BLOCK - 8) {
+		ssh_sha1_block(h, block);
+		memset(block, 0, sizeof(block));
+	}
+	for (i = 0; i < 8; i++)
+		block[SSH_SHA1_BLOCK - 1 - i] = (bits >> (8 * i)) & 0xff;
+	ssh_sha1_block(h, block);
+	for (i = 0; i < 5; i++)
+		put_u32(digest + 4 * i, h[i]);
+}
+
+static int
+hostfile_decode_hashed(const char *s, u_int len, struct hostidx_hashed *e)
+{
+	char b64[1024];
+	u_char buf[256];
+	const char *p;
+	u_int l;
+
+	if (memchr(s, ',', len) != NULL ||
+	    extract_salt(s, len, (char *)buf, sizeof(buf)) == -1)
+		return (-1);
+	hostidx_sha1_state(buf, 0x36, e->istate);
+	hostidx_sha1_state(buf, 0x5c, e->ostate);
+	s += sizeof(HASH_MAGIC) - 1;
+	len -= sizeof(HASH_MAGIC) - 1;
+	if ((p = memchr(s, HASH_DELIM, len)) == NULL)
+		return (-1);
+	l = len - (p + 1 - s);
+	if (l == 0 || l >= sizeof(b64))
+		return (-1);
+	memcpy(b64, p + 1, l);
+	b64[l] = '\0';
+	if (__b64_pton(b64, buf, sizeof(buf)) != SHA_DIGEST_LENGTH)
+		return (-1);
+	memcpy(e->digest, buf, SHA_DIGEST_LENGTH);
+	return (0);
+}
+
+/* FNV-1a over the lowercased name */
+static u_int32_t
+hostidx_hash(const char *s, u_int len)
+{
+	u_int32_t h = 2166136261U;
+	u_int i;
+
+	for (i = 0; i < len; i++) {
+		h ^= (u_char)tolower((u_char)s[i]);
+		h *= 16777619U;
+	}
+	return (h);
+}
+
+static void
+hostidx_close(struct hostidx *hi)
+{
+	if (hi->data == NULL)
+		return;
+#ifdef HAVE_MMAP
+	if (hi->mapped)
+		munmap(hi->data, hi->len);
+	else
+#endif
+		xfree(hi->data);
+	memset(hi, 0, sizeof(*hi));
+}
+
+/*
+ * Map the index for a known_hosts file with status kst and check that it
+ * is trustworthy, intact and describes the file.  Returns 0 on success.
+ */
+static int
+hostidx_open(const char *idxname, const struct stat *kst, struct hostidx *hi)
+{
+	struct hostidx_hdr *hdr;
+	struct stat st;
+	size_t need;
+	int fd;
+
+	memset(hi, 0, sizeof(*hi));
+	if ((fd = open(idxname, O_RDONLY)) == -1)
+		return (-1);
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) ||
+	    st.st_uid != kst->st_uid || (st.st_mode & 022) != 0 ||
+	    st.st_size < (off_t)sizeof(*hdr) || st.st_size > HOSTIDX_MAX_SIZE) {
+		close(fd);
+		return (-1);
+	}
+	hi->len = st.st_size;
+#ifdef HAVE_MMAP
+	hi->data = mmap(NULL, hi->len, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (hi->data != MAP_FAILED)
+		hi->mapped = 1;
+	else
+#endif
+	{
+		hi->data = xmalloc(hi->len);
+		if (atomicio(read, fd, hi->data, hi->len) != hi->len) {
+			xfree(hi->data);
+			hi->data = NULL;
+			close(fd);
+			return (-1);
+		}
+	}
+	close(fd);
+
+	hdr = hi->hdr = (struct hostidx_hdr *)hi->data;
+	if (memcmp(hdr->magic, HOSTIDX_MAGIC, sizeof(hdr->magic)) != 0 ||
+	    hdr->hdrsize != sizeof(*hdr) ||
+	    hdr->kh_size != (u_int64_t)kst->st_size ||
+	    hdr->kh_mtime != (u_int64_t)kst->st_mtime ||
+	    hdr->kh_ino != (u_int64_t)kst->st_ino ||
+	    hdr->kh_dev != (u_int64_t)kst->st_dev ||
+	    hdr->indexed_size > hdr->kh_size ||
+	    hdr->nbuckets == 0 || hdr->nbuckets > HOSTIDX_MAX_SIZE / 4 ||
+	    (hdr->nbuckets & (hdr->nbuckets - 1)) != 0 ||
+	    hdr->nplain > HOSTIDX_MAX_SIZE / sizeof(*hi->plain) ||
+	    hdr->nhashed > HOSTIDX_MAX_SIZE / sizeof(*hi->hashed) ||
+	    hdr->nscan > HOSTIDX_MAX_SIZE / sizeof(*hi->scan)) {
+		debug3("%s: %s is stale or invalid", __func__, idxname);
+		hostidx_close(hi);
+		return (-1);
+	}
+	need = sizeof(*hdr) + (size_t)hdr->nbuckets * sizeof(u_int32_t) +
+	    (size_t)hdr->nplain * sizeof(*hi->plain) +
+	    (size_t)hdr->nhashed * sizeof(*hi->hashed) +
+	    (size_t)hdr->nscan * sizeof(*hi->scan);
+	if (need != hi->len) {
+		debug3("%s: %s is truncated", __func__, idxname);
+		hostidx_close(hi);
+		return (-1);
+	}
+	hi->buckets = (u_int32_t *)(hi->data + sizeof(*hdr));
+	hi->plain = (struct hostidx_plain *)(hi->buckets + hdr->nbuckets);
+	hi->hashed = (struct hostidx_hashed *)(hi->plain + hdr->nplain);
+	hi->scan = (struct hostidx_line *)(hi->hashed + hdr->nhashed);
+	return (0);
+}
+
+/*
+ * Build the index for known_hosts file f (status kst) and atomically
+ * install it as idxname.  Lines are split exactly as
+ * check_host_in_hostfile_by_key_or_type() reads them.
+ */
+static int
+hostidx_build(FILE *f, const struct stat *kst, const char *idxname)
+{
+	struct hostidx_hdr hdr;
+	struct hostidx_plain *plain = NULL;
+	struct hostidx_hashed *hashed = NULL;
+	struct hostidx_line *scan = NULL, l;
+	u_int32_t *buckets, b, nplain = 0, nhashed = 0, nscan = 0;
+	u_int32_t aplain = 0, ahashed = 0, ascan = 0;
+	char line[8192], *cp, *cp2, *tok, *tmp;
+	long off;
+	u_int linenum = 0, len;
+	int fd, ret = -1;
+
+	rewind(f);
+	for (off = 0; fgets(line, sizeof(line), f) != NULL; off = ftell(f)) {
+		linenum++;
+		if (off < 0)
+			goto out;
+		for (cp = line; *cp == ' ' || *cp == '\t'; cp++)
+			;
+		if (!*cp || *cp == '#' || *cp == '\n')
+			continue;
+		for (cp2 = cp; *cp2 && *cp2 != ' ' && *cp2 != '\t'; cp2++)
+			;
+		len = cp2 - cp;
+		l.off = off;
+		l.linenum = linenum;
+
+		if (*cp == HASH_DELIM) {
+			if (nhashed >= ahashed) {
+				ahashed = ahashed ? ahashed * 2 : 1024;
+				hashed = xrealloc(hashed, ahashed,
+				    sizeof(*hashed));
+			}
+			if (hostfile_decode_hashed(cp, len,
+			    &hashed[nhashed]) == 0) {
+				hashed[nhashed++].l = l;
+				continue;
+			}
+		} else if (strcspn(cp, "*?! \t") >= len) {
+			for (tok = cp; tok < cp2; tok = cp + 1) {
+				if ((cp = memchr(tok, ',', cp2 - tok)) == NULL)
+					cp = cp2;
+				if (nplain >= aplain) {
+					aplain = aplain ? aplain * 2 : 1024;
+					plain = xrealloc(plain, aplain,
+					    sizeof(*plain));
+				}
+				plain[nplain].hash =
+				    hostidx_hash(tok, cp - tok);
+				plain[nplain++].l = l;
+			}
+			continue;
+		}
+		/* patterns and anything odd are always checked */
+		if (nscan >= ascan) {
+			ascan = ascan ? ascan * 2 : 64;
+			scan = xrealloc(scan, ascan, sizeof(*scan));
+		}
+		scan[nscan++] = l;
+	}
+	if (ferror(f) || (off = ftell(f)) < 0 || off != kst->st_size)
+		goto out;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, HOSTIDX_MAGIC, sizeof(hdr.magic));
+	hdr.hdrsize = sizeof(hdr);
+	for (hdr.nbuckets = 16; hdr.nbuckets < nplain + nplain / 2; )
+		hdr.nbuckets <<= 1;
+	hdr.nplain = nplain;
+	hdr.nhashed = nhashed;
+	hdr.nscan = nscan;
+	hdr.indexed_size = off;
+	hdr.indexed_lines = linenum;
+	hdr.kh_size = kst->st_size;
+	hdr.kh_mtime = kst->st_mtime;
+	hdr.kh_ino = kst->st_ino;
+	hdr.kh_dev = kst->st_dev;
+
+	buckets = xcalloc(hdr.nbuckets, sizeof(*buckets));
+	memset(buckets, 0xff, hdr.nbuckets * sizeof(*buckets));
+	for (b = 0; b < nplain; b++) {
+		plain[b].next = buckets[plain[b].hash & (hdr.nbuckets - 1)];
+		buckets[plain[b].hash & (hdr.nbuckets - 1)] = b;
+	}
+
+	xasprintf(&tmp, "%s.XXXXXXXXXX", idxname);
+	if ((fd = mkstemp(tmp)) == -1) {
+		debug("%s: mkstemp %s: %s", __func__, tmp, strerror(errno));
+		xfree(tmp);
+		xfree(buckets);
+		goto out;
+	}
+	if (atomicio(vwrite, fd, &hdr, sizeof(hdr)) != sizeof(hdr) ||
+	    atomicio(vwrite, fd, buckets, hdr.nbuckets * sizeof(*buckets)) !=
+	    hdr.nbuckets * sizeof(*buckets) ||
+	    atomicio(vwrite, fd, plain, nplain * sizeof(*plain)) !=
+	    nplain * sizeof(*plain) ||
+	    atomicio(vwrite, fd, hashed, nhashed * sizeof(*hashed)) !=
+	    nhashed * sizeof(*hashed) ||
+	    atomicio(vwrite, fd, scan, nscan * sizeof(*scan)) !=
+	    nscan * sizeof(*scan) ||
+	    fchmod(fd, kst->st_mode & 0644) == -1 ||
+	    close(fd) == -1 || rename(tmp, idxname) == -1) {
+		debug("%s: writing %s: %s", __func__, idxname,
+		    strerror(errno));
+		unlink(tmp);
+	} else {
+		debug2("%s: indexed %u lines into %s", __func__, linenum,
+		    idxname);
+		ret = 0;
+	}
+	xfree(tmp);
+	xfree(buckets);
+ out:
+	if (plain != NULL)
+		xfree(plain);
+	if (hashed != NULL)
+		xfree(hashed);
+	if (scan != NULL)
+		xfree(scan);
+	return (ret);
+}
+
+static int
+hostidx_line_cmp(const void *a, const void *b)
+{
+	const struct hostidx_line *la = a, *lb = b;
+
+	return (la->linenum < lb->linenum ? -1 :
+	    la->linenum > lb->linenum ? 1 : 0);
+}
+
+/*
+ * Use (building it if needed) the index of known_hosts file f to find the
+ * lines that may match host.  On success returns 0 with the candidates
+ * sorted by line number and the offset and line number at which the
+ * unindexed tail of the file starts.
+ */
+static int
+hostidx_candidates(const char *filename, FILE *f, const char *host,
+    struct hostidx_line **candsp, u_int *ncandsp, long *tail_off,
+    u_int *tail_line)
+{
+	struct hostidx hi;
+	struct hostidx_line *cands = NULL;
+	u_char digest[SHA_DIGEST_LENGTH];
+	struct stat st;
+	char *idxname;
+	u_int32_t i, n, ncands = 0, acands, h;
+	u_int hostlen = strlen(host);
+
+	if (fstat(fileno(f), &st) == -1 || !S_ISREG(st.st_mode) ||
+	    st.st_size < HOSTIDX_MIN_SIZE || st.st_size > HOSTIDX_MAX_SIZE)
+		return (-1);
+	xasprintf(&idxname, "%s%s", filename, HOSTIDX_SUFFIX);
+	if (hostidx_open(idxname, &st, &hi) == 0 &&
+	    st.st_size - hi.hdr->indexed_size > HOSTIDX_MAX_TAIL &&
+	    st.st_uid == geteuid())
+		hostidx_close(&hi);
+	if (hi.data == NULL) {
+		if (st.st_uid != geteuid() ||
+		    hostidx_build(f, &st, idxname) != 0 ||
+		    hostidx_open(idxname, &st, &hi) != 0) {
+			xfree(idxname);
+			return (-1);
+		}
+	}
+	xfree(idxname);
+
+	acands = hi.hdr->nscan + 16;
+	cands = xcalloc(acands, sizeof(*cands));
+	memcpy(cands, hi.scan, hi.hdr->nscan * sizeof(*cands));
+	ncands = hi.hdr->nscan;
+
+	h = hostidx_hash(host, hostlen);
+	for (i = hi.buckets[h & (hi.hdr->nbuckets - 1)], n = 0;
+	    i != HOSTIDX_NONE && i < hi.hdr->nplain && n < hi.hdr->nplain;
+	    i = hi.plain[i].next, n++) {
+		if (hi.plain[i].hash != h)
+			continue;
+		if (ncands >= acands) {
+			acands *= 2;
+			cands = xrealloc(cands, acands, sizeof(*cands));
+		}
+		cands[ncands++] = hi.plain[i].l;
+	}
+
+	for (i = 0; i < hi.hdr->nhashed; i++) {
+		/* HMAC-SHA1(salt, host) from the saved key states */
+		hostidx_sha1_finish(hi.hashed[i].istate, host, hostlen, digest);
+		hostidx_sha1_finish(hi.hashed[i].ostate, digest,
+		    SHA_DIGEST_LENGTH, digest);
+		if (memcmp(digest, hi.hashed[i].digest,
+		    SHA_DIGEST_LENGTH) != 0)
+			continue;
+		if (ncands >= acands) {
+			acands *= 2;
+			cands = xrealloc(cands, acands, sizeof(*cands));
+		}
+		cands[ncands++] = hi.hashed[i].l;
+	}
+	qsort(cands, ncands, sizeof(*cands), hostidx_line_cmp);
+
+	*candsp = cands;
+	*ncandsp = ncands;
+	*tail_off = hi.hdr->indexed_size;
+	*tail_line = hi.hdr->indexed_lines;
+	debug3("%s: %u candidate lines, %lu unindexed bytes", __func__,
+	    ncands, (u_long)(st.st_size - hi.hdr->indexed_size));
+	hostidx_close(&hi);
+	return (0);
+}
+
+/*
+ * After add_host_to_hostfile() appended to a file whose status was
+ * "before", move the index forward so that the new lines are scanned
+ * as its tail instead of invalidating it.
+ */
+static void
+hostidx_appended(const char *filename, const struct stat *before)
+{
+	struct hostidx_hdr hdr;
+	struct stat st, ist;
+	char *idxname;
+	int fd;
+
+	xasprintf(&idxname, "%s%s", filename, HOSTIDX_SUFFIX);
+	fd = open(idxname, O_RDWR);
+	xfree(idxname);
+	if (fd == -1)
+		return;
+	if (fstat(fd, &ist) == -1 || ist.st_uid != before->st_uid ||
+	    (ist.st_mode & 022) != 0 || stat(filename, &st) == -1 ||
+	    st.st_ino != before->st_ino || st.st_dev != before->st_dev ||
+	    st.st_size < before->st_size ||
+	    atomicio(read, fd, &hdr, sizeof(hdr)) != sizeof(hdr) ||
+	    memcmp(hdr.magic, HOSTIDX_MAGIC, sizeof(hdr.magic)) != 0 ||
+	    hdr.hdrsize != sizeof(hdr) ||
+	    hdr.kh_size != (u_int64_t)before->st_size ||
+	    hdr.kh_mtime != (u_int64_t)before->st_mtime ||
+	    hdr.kh_ino != (u_int64_t)before->st_ino ||
+	    hdr.kh_dev != (u_int64_t)before->st_dev) {
+		close(fd);
+		return;
+	}
+	hdr.kh_size = st.st_size;
+	hdr.kh_mtime = st.st_mtime;
+	if (lseek(fd, 0, SEEK_SET) == -1 ||
+	    atomicio(vwrite, fd, &hdr, sizeof(hdr)) != sizeof(hdr))
+		debug("%s: updating index for %s failed", __func__, filename);
+	close(fd);
+}
+
+/*
+ * Checks one known_hosts line against host.  Returns the final status if
+ * the search is over, or -1 to go on with the next line; end_return is
+ * set to HOST_CHANGED if a different key was seen for the host.
+ */
+static int
+check_host_line(char *line, int linenum, const char *filename,
+    const char *host, const Key *key, int keytype, int nid, Key *found,
+    int *numret, HostStatus *end_return)
+{
+	u_int kbits;
+	char *cp, *cp2, *hashed_host;
+
+	cp = line;
+
+	/* Skip any leading whitespace, comments and empty lines. */
+	for (; *cp == ' ' || *cp == '\t'; cp++)
+		;
+	if (!*cp || *cp == '#' || *cp == '\n')
+		return -1;
+
+	/* Find the end of the host name portion. */
+	for (cp2 = cp; *cp2 && *cp2 != ' ' && *cp2 != '\t'; cp2++)
+		;
+
+	/* Check if the host name matches. */
+	if (match_hostname(host, cp, (u_int) (cp2 - cp)) != 1) {
+		if (*cp != HASH_DELIM)
+			return -1;
+		hashed_host = host_hash(host, cp, (u_int) (cp2 - cp));
+		if (hashed_host == NULL) {
+			debug("Invalid hashed host line %d of %s",
+			    linenum, filename);
+			return -1;
+		}
+		if (strncmp(hashed_host, cp, (u_int) (cp2 - cp)) != 0)
+			return -1;
+	}
+
+	/* Got a match.  Skip host name. */
+	cp = cp2;
+
+	/*
+	 * Extract the key from the line.  This will skip any leading
+	 * whitespace.  Ignore badly formatted lines.
+	 */
+	if (!hostfile_read_key(&cp, &kbits, found))
+		return -1;
+
+	if (numret != NULL)
+		*numret = linenum;
+
+	if (key == NULL) {
+		/* we found a key of the requested type (and curve) */
+		if (found->type == keytype &&
+		    (nid == -1 || found->ecdsa_nid == nid))
+			return HOST_FOUND;
+		return -1;
+	}
+
+	if (!hostfile_check_key(kbits, found, host, filename, linenum))
+		return -1;
+
+	/* Check if the current key is the same as the given key. */
+	if (key_equal(key, found)) {
+		/* Ok, they match. */
+		debug3("check_host_in_hostfile: match line %d", linenum);
+		return HOST_OK;
+	}
+	/*
+	 * They do not match.  We will continue to go through the
+	 * file; however, we note that we will not return that it is
+	 * new.
+	 */
+	*end_return = HOST_CHANGED;
+	return -1;
+}
+
 /*
  * Checks whether the given host (which must be in all lowercase) is already
  * in the list of our known hosts. Returns HOST_OK if the host is known and
@@ -195,13 +781,15 @@ hostfile_check_key(int bits, const Key *key, const char *host, const char *filen
 
 static HostStatus
 check_host_in_hostfile_by_key_or_type(const char *filename,
-    const char *host, const Key *key, int keytype, Key *found, int *numret)
+    const char *host, const Key *key, int keytype, int nid, Key *found,
+    int *numret)
 {
 	FILE *f;
 	char line[8192];
-	int linenum = 0;
-	u_int kbits;
-	char *cp, *cp2, *hashed_host;
+	struct hostidx_line *cands = NULL;
+	u_int i, ncands = 0, tail_line;
+	long tail_off;
+	int linenum = 0, r = -1;
 	HostStatus end_return;
 
 	debug3("check_host_in_hostfile: filename %s", filename);
@@ -218,73 +806,40 @@ check_host_in_hostfile_by_key_or_type(const char *filename,
 	 */
 	end_return = HOST_NEW;
 
-	/* Go through the file. */
-	while (fgets(line, sizeof(line), f)) {
-		cp = line;
-		linenum++;
-
-		/* Skip any leading whitespace, comments and empty lines. */
-		for (; *cp == ' ' || *cp == '\t'; cp++)
-			;
-		if (!*cp || *cp == '#' || *cp == '\n')
-			continue;
-
-		/* Find the end of the host name portion. */
-		for (cp2 = cp; *cp2 && *cp2 != ' ' && *cp2 != '\t'; cp2++)
-			;
-
-		/* Check if the host name matches. */
-		if (match_hostname(host, cp, (u_int) (cp2 - cp)) != 1) {
-			if (*cp != HASH_DELIM)
-				continue;
-			hashed_host = host_hash(host, cp, (u_int) (cp2 - cp));
-			if (hashed_host == NULL) {
-				debug("Invalid hashed host line %d of %s",
-				    linenum, filename);
-				continue;
-			}
-			if (strncmp(hashed_host, cp, (u_int) (cp2 - cp)) != 0)
-				continue;
+	/* Only look at the lines the index says may match. */
+	if (hostidx_candidates(filename, f, host, &cands, &ncands,
+	    &tail_off, &tail_line) == 0) {
+		for (i = 0; i < ncands && r == -1; i++) {
+			if (fseek(f, cands[i].off, SEEK_SET) == -1 ||
+			    fgets(line, sizeof(line), f) == NULL)
+				break;
+			r = check_host_line(line, cands[i].linenum, filename,
+			    host, key, keytype, nid, found, numret,
+			    &end_return);
 		}
-
-		/* Got a match.  Skip host name. */
-		cp = cp2;
-
-		/*
-		 * Extract the key from the line.  This will skip any leading
-		 * whitespace.  Ignore badly formatted lines.
-		 */
-		if (!hostfile_read_key(&cp, &kbits, found))
-			continue;
-
-		if (numret != NULL)
-			*numret = linenum;
-
-		if (key == NULL) {
-			/* we found a key of the requested type */
-			if (found->type == keytype) {
-				fclose(f);
-				return HOST_FOUND;
-			}
-			continue;
+		xfree(cands);
+		if (r != -1) {
+			fclose(f);
+			return r;
 		}
+		if (i < ncands || fseek(f, tail_off, SEEK_SET) == -1) {
+			/* the file changed underneath us; start over */
+			rewind(f);
+			tail_line = 0;
+			end_return = HOST_NEW;
+		}
+		linenum = tail_line;
+	}
 
-		if (!hostfile_check_key(kbits, found, host, filename, linenum))
-			continue;
-
-		/* Check if the current key is the same as the given key. */
-		if (key_equal(key, found)) {
-			/* Ok, they match. */
-			debug3("check_host_in_hostfile: match line %d", linenum);
+	/* Go through the file. */
+	while (fgets(line, sizeof(line), f)) {
+		linenum++;
+		r = check_host_line(line, linenum, filename, host, key,
+		    keytype, nid, found, numret, &end_return);
+		if (r != -1) {
 			fclose(f);
-			return HOST_OK;
+			return r;
 		}
-		/*
-		 * They do not match.  We will continue to go through the
-		 * file; however, we note that we will not return that it is
-		 * new.
-		 */
-		end_return = HOST_CHANGED;
 	}
 	/* Clear variables and close the file. */
 	fclose(f);
@@ -303,7 +858,7 @@ check_host_in_hostfile(const char *filename, const char *host, const Key *key,
 	if (key == NULL)
 		fatal("no key to look up");
 	return (check_host_in_hostfile_by_key_or_type(filename, host, key, 0,
-	    found, numret));
+	    -1, found, numret));
 }
 
 int
@@ -311,7 +866,16 @@ lookup_key_in_hostfile_by_type(const char *filename, const char *host,
     int keytype, Key *found, int *numret)
 {
 	return (check_host_in_hostfile_by_key_or_type(filename, host, NULL,
-	    keytype, found, numret) == HOST_FOUND);
+	    keytype, -1, found, numret) == HOST_FOUND);
+}
+
+/* As above, but only an ECDSA key on the curve 'nid' will do. */
+int
+lookup_ecdsa_key_in_hostfile(const char *filename, const char *host,
+    int nid, Key *found, int *numret)
+{
+	return (check_host_in_hostfile_by_key_or_type(filename, host, NULL,
+	    KEY_ECDSA, nid, found, numret) == HOST_FOUND);
 }
 
 /*
@@ -324,11 +888,13 @@ add_host_to_hostfile(const char *filename, const char *host, const Key *key,
     int store_hash)
 {
 	FILE *f;
-	int success = 0;
+	struct stat st;
+	int success = 0, have_st;
 	char *hashed_host = NULL;
 
 	if (key == NULL)
 		return 1;	/* XXX ? */
+	have_st = stat(filename, &st) == 0;
 	f = fopen(filename, "a");
 	if (!f)
 		return 0;
@@ -348,6 +914,9 @@ add_host_to_hostfile(const char *filename, const char *host, const Key *key,
 		error("add_host_to_hostfile: saving key in %s failed", filename);
 	}
 	fprintf(f, "\n");
-	fclose(f);
+	if (fclose(f) != 0)
+		success = 0;
+	if (success && have_st)
+		hostidx_appended(filename, &st);
 	return success;
 }
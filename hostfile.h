@@ -24,6 +24,8 @@ HostStatus check_host_in_hostfile(const char *, const char *,
 int	add_host_to_hostfile(const char *, const char *, const Key *, int);
 int	lookup_key_in_hostfile_by_type(const char *, const char *,
 	    int, Key *, int *);
+int	lookup_ecdsa_key_in_hostfile(const char *, const char *,
+	    int, Key *, int *);
 
 #define HASH_MAGIC	"|1|"
 #define HASH_DELIM	'|'
@@ -48,6 +48,7 @@
 #include "match.h"
 #include "dispatch.h"
 #include "monitor.h"
+#include "conntrace.h"
 
 #define KEX_COOKIE_LEN	16
 
@@ -62,6 +63,7 @@ extern const EVP_MD *evp_ssh_sha256(void);
 /* prototype */
 static void kex_kexinit_finish(Kex *);
 static void kex_choose_conf(Kex *);
+static void kex_input_newkeys(int, u_int32_t, void *);
 
 /* put algorithm proposal into buffer */
 static void
@@ -138,20 +140,39 @@ kex_reset_dispatch(void)
 	dispatch_set(SSH2_MSG_KEXINIT, &kex_input_kexinit);
 }
 
+/*
+ * Called by the kex methods once the keys are derived.  The exchange is
+ * done when the peer's NEWKEYS arrives through the dispatch table, so the
+ * caller's loop keeps servicing channels in the meantime.
+ */
 void
 kex_finish(Kex *kex)
 {
 	kex_reset_dispatch();
 
+	conntrace_stop(kex->trace);
+	kex->trace = conntrace_start("kex newkeys");
 	packet_start(SSH2_MSG_NEWKEYS);
 	packet_send();
 	/* packet_write_wait(); */
 	debug("SSH2_MSG_NEWKEYS sent");
 
 	debug("expecting SSH2_MSG_NEWKEYS");
-	packet_read_expect(SSH2_MSG_NEWKEYS);
+	dispatch_set(SSH2_MSG_NEWKEYS, &kex_input_newkeys);
+}
+
+/* ARGSUSED */
+static void
+kex_input_newkeys(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = (Kex *)ctxt;
+
+	if (kex == NULL)
+		fatal("%s: no kex", __func__);
+	dispatch_set(SSH2_MSG_NEWKEYS, &kex_protocol_error);
 	packet_check_eom();
 	debug("SSH2_MSG_NEWKEYS received");
+	conntrace_stop(kex->trace);
 
 	kex->done = 1;
 	buffer_clear(&kex->peer);
@@ -164,9 +185,7 @@ kex_finish(Kex *kex)
 void
 kex_send_kexinit(Kex *kex)
 {
-	u_int32_t rnd = 0;
 	u_char *cookie;
-	u_int i;
 
 	if (kex == NULL) {
 		error("kex_send_kexinit: no kex, cannot rekey");
@@ -182,17 +201,13 @@ kex_send_kexinit(Kex *kex)
 	if (buffer_len(&kex->my) < KEX_COOKIE_LEN)
 		fatal("kex_send_kexinit: kex proposal too short");
 	cookie = buffer_ptr(&kex->my);
-	for (i = 0; i < KEX_COOKIE_LEN; i++) {
-		if (i % 4 == 0)
-			rnd = arc4random();
-		cookie[i] = rnd;
-		rnd >>= 8;
-	}
+	arc4random_buf(cookie, KEX_COOKIE_LEN);
 	packet_start(SSH2_MSG_KEXINIT);
 	packet_put_raw(buffer_ptr(&kex->my), buffer_len(&kex->my));
 	packet_send();
 	debug("SSH2_MSG_KEXINIT sent");
 	kex->flags |= KEX_INIT_SENT;
+	kex->trace = conntrace_start("kex init");
 }
 
 /* ARGSUSED */
@@ -232,6 +247,7 @@ kex_setup(char *proposal[PROPOSAL_MAX])
 	buffer_init(&kex->my);
 	kex_prop2buf(&kex->my, proposal);
 	kex->done = 0;
+	kex->trace = -1;
 
 	kex_send_kexinit(kex);					/* we start */
 	kex_reset_dispatch();
@@ -246,6 +262,8 @@ kex_kexinit_finish(Kex *kex)
 		kex_send_kexinit(kex);
 
 	kex_choose_conf(kex);
+	conntrace_stop(kex->trace);
+	kex->trace = conntrace_start("kex %s", kex->name);
 
 	if (kex->kex_type >= 0 && kex->kex_type < KEX_MAX &&
 	    kex->kex[kex->kex_type] != NULL) {
@@ -299,6 +317,10 @@ choose_comp(Comp *comp, char *client, char *server)
 		comp->type = COMP_DELAYED;
 	} else if (strcmp(name, "zlib") == 0) {
 		comp->type = COMP_ZLIB;
+#ifdef WITH_ZSTD
+	} else if (strcmp(name, "zstd@openssh.com") == 0) {
+		comp->type = COMP_ZSTD;
+#endif
 	} else if (strcmp(name, "none") == 0) {
 		comp->type = COMP_NONE;
 	} else {
@@ -326,6 +348,24 @@ choose_kex(Kex *k, char *client, char *server)
 	} else if (strcmp(k->name, KEX_DHGEX_SHA256) == 0) {
 		k->kex_type = KEX_DH_GEX_SHA256;
 		k->evp_md = evp_ssh_sha256();
+	} else if (strcmp(k->name, KEX_CURVE25519_SHA256) == 0 ||
+	    strcmp(k->name, KEX_CURVE25519_SHA256_OLD) == 0) {
+		k->kex_type = KEX_C25519_SHA256;
+		k->evp_md = evp_ssh_sha256();
+#endif
+#ifdef OPENSSL_HAS_ECC
+	} else if (strcmp(k->name, KEX_ECDH_SHA2_NISTP256) == 0) {
+		k->kex_type = KEX_ECDH_SHA2;
+		k->ec_nid = NID_X9_62_prime256v1;
+		k->evp_md = EVP_sha256();
+	} else if (strcmp(k->name, KEX_ECDH_SHA2_NISTP384) == 0) {
+		k->kex_type = KEX_ECDH_SHA2;
+		k->ec_nid = NID_secp384r1;
+		k->evp_md = EVP_sha384();
+	} else if (strcmp(k->name, KEX_ECDH_SHA2_NISTP521) == 0) {
+		k->kex_type = KEX_ECDH_SHA2;
+		k->ec_nid = NID_secp521r1;
+		k->evp_md = EVP_sha512();
 #endif
 	} else
 		fatal("bad kex alg %s", k->name);
@@ -29,15 +29,27 @@
 #include <signal.h>
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
+#include <openssl/dh.h>
+#ifdef OPENSSL_HAS_ECC
+#include <openssl/ec.h>
+#endif
 
 #define	KEX_DH1			"diffie-hellman-group1-sha1"
 #define	KEX_DH14		"diffie-hellman-group14-sha1"
 #define	KEX_DHGEX_SHA1		"diffie-hellman-group-exchange-sha1"
 #define	KEX_DHGEX_SHA256	"diffie-hellman-group-exchange-sha256"
+#define	KEX_ECDH_SHA2_NISTP256	"ecdh-sha2-nistp256"
+#define	KEX_ECDH_SHA2_NISTP384	"ecdh-sha2-nistp384"
+#define	KEX_ECDH_SHA2_NISTP521	"ecdh-sha2-nistp521"
+#define	KEX_CURVE25519_SHA256	"curve25519-sha256"
+#define	KEX_CURVE25519_SHA256_OLD "curve25519-sha256@libssh.org"
+
+#define CURVE25519_SIZE	32
 
 #define COMP_NONE	0
 #define COMP_ZLIB	1
 #define COMP_DELAYED	2
+#define COMP_ZSTD	3	/* zstd@openssh.com, delayed like COMP_DELAYED */
 
 enum kex_init_proposals {
 	PROPOSAL_KEX_ALGS,
@@ -64,6 +76,8 @@ enum kex_exchange {
 	KEX_DH_GRP14_SHA1,
 	KEX_DH_GEX_SHA1,
 	KEX_DH_GEX_SHA256,
+	KEX_ECDH_SHA2,
+	KEX_C25519_SHA256,
 	KEX_MAX
 };
 
@@ -118,6 +132,7 @@ struct Kex {
 	Buffer	peer;
 	sig_atomic_t done;
 	int	flags;
+	int	trace;		/* conntrace handle of current step */
 	const EVP_MD *evp_md;
 	char	*client_version_string;
 	char	*server_version_string;
@@ -125,6 +140,15 @@ struct Kex {
 	Key	*(*load_host_key)(int);
 	int	(*host_key_index)(Key *);
 	void	(*kex[KEX_MAX])(Kex *);
+	/* state of the exchange in progress, between dispatch callbacks */
+	DH	*dh;
+	int	min, max, nbits;	/* DH-GEX */
+	int	ec_nid;			/* ECDH curve */
+#ifdef OPENSSL_HAS_ECC
+	EC_KEY	*ec_client_key;
+#endif
+	u_char	c25519_client_key[CURVE25519_SIZE];
+	u_char	c25519_client_pubkey[CURVE25519_SIZE];
 };
 
 Kex	*kex_setup(char *[PROPOSAL_MAX]);
@@ -140,6 +164,10 @@ void	 kexdh_client(Kex *);
 void	 kexdh_server(Kex *);
 void	 kexgex_client(Kex *);
 void	 kexgex_server(Kex *);
+void	 kexecdh_client(Kex *);
+void	 kexecdh_server(Kex *);
+void	 kexc25519_client(Kex *);
+void	 kexc25519_server(Kex *);
 
 void
 kex_dh_hash(char *, char *, char *, int, char *, int, u_char *, int,
@@ -148,6 +176,21 @@ void
 kexgex_hash(const EVP_MD *, char *, char *, char *, int, char *,
     int, u_char *, int, int, int, int, BIGNUM *, BIGNUM *, BIGNUM *,
     BIGNUM *, BIGNUM *, u_char **, u_int *);
+void
+kex_ecdh_hash(const EVP_MD *, char *, char *, char *, int, char *, int,
+    u_char *, int, u_char *, u_int, u_char *, u_int, BIGNUM *,
+    u_char **, u_int *);
+
+#ifdef OPENSSL_HAS_ECC
+u_char	*kex_ecdh_pub_to_blob(EC_KEY *, u_int *);
+EC_POINT *kex_ecdh_blob_to_pub(const EC_GROUP *, u_char *, u_int);
+void	 kex_ecdh_shared_secret(EC_KEY *, const EC_POINT *, BIGNUM *);
+#endif
+
+void	 kexc25519_keygen(u_char[CURVE25519_SIZE], u_char[CURVE25519_SIZE]);
+int	 kexc25519_shared_secret(const u_char[CURVE25519_SIZE],
+    const u_char[CURVE25519_SIZE], BIGNUM *);
+int	 crypto_scalarmult_curve25519(u_char *, const u_char *, const u_char *);
 
 void
 derive_ssh1_session_id(BIGNUM *, BIGNUM *, u_int8_t[8], u_int8_t[16]);
@@ -0,0 +1,56 @@
+/*
+ * Placed in the public domain.
+ *
+ * curve25519-sha256 key exchange primitives (RFC 8731), on top of the
+ * reference scalar multiplication in smult_curve25519_ref.c.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <signal.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/evp.h>
+
+#include "buffer.h"
+#include "key.h"
+#include "cipher.h"
+#include "kex.h"
+#include "log.h"
+
+void
+kexc25519_keygen(u_char key[CURVE25519_SIZE], u_char pub[CURVE25519_SIZE])
+{
+	static const u_char basepoint[CURVE25519_SIZE] = {9};
+
+	arc4random_buf(key, CURVE25519_SIZE);
+	crypto_scalarmult_curve25519(pub, key, basepoint);
+}
+
+/*
+ * Computes the shared secret as an unsigned integer in network byte order.
+ * Returns -1 if the peer sent a low order point (all-zero result).
+ */
+int
+kexc25519_shared_secret(const u_char key[CURVE25519_SIZE],
+    const u_char peer[CURVE25519_SIZE], BIGNUM *out)
+{
+	u_char shared[CURVE25519_SIZE], acc = 0;
+	u_int i;
+
+	crypto_scalarmult_curve25519(shared, key, peer);
+	for (i = 0; i < CURVE25519_SIZE; i++)
+		acc |= shared[i];
+	if (acc == 0)
+		return -1;
+#ifdef DEBUG_KEXECDH
+	dump_digest("shared secret", shared, CURVE25519_SIZE);
+#endif
+	if (BN_bin2bn(shared, CURVE25519_SIZE, out) == NULL)
+		fatal("%s: BN_bin2bn failed", __func__);
+	memset(shared, 0, sizeof(shared));
+	return 0;
+}
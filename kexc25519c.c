@@ -0,0 +1,114 @@
+/*
+ * Placed in the public domain.
+ *
+ * curve25519-sha256 key exchange, client side.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+
+#include "xmalloc.h"
+#include "buffer.h"
+#include "key.h"
+#include "cipher.h"
+#include "kex.h"
+#include "log.h"
+#include "packet.h"
+#include "ssh2.h"
+#include "dispatch.h"
+
+static void input_kex_c25519_reply(int, u_int32_t, void *);
+
+void
+kexc25519_client(Kex *kex)
+{
+	kexc25519_keygen(kex->c25519_client_key, kex->c25519_client_pubkey);
+
+	packet_start(SSH2_MSG_KEX_ECDH_INIT);
+	packet_put_string(kex->c25519_client_pubkey, CURVE25519_SIZE);
+	packet_send();
+	debug("sending SSH2_MSG_KEX_ECDH_INIT");
+
+	debug("expecting SSH2_MSG_KEX_ECDH_REPLY");
+	dispatch_set(SSH2_MSG_KEX_ECDH_REPLY, &input_kex_c25519_reply);
+}
+
+/* ARGSUSED */
+static void
+input_kex_c25519_reply(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	BIGNUM *shared_secret;
+	Key *server_host_key;
+	u_char *server_host_key_blob = NULL, *signature = NULL;
+	u_char *server_pubkey, *hash;
+	u_int slen, sbloblen, pklen, hashlen;
+
+	dispatch_set(SSH2_MSG_KEX_ECDH_REPLY, NULL);
+
+	/* hostkey */
+	server_host_key_blob = packet_get_string(&sbloblen);
+	server_host_key = key_from_blob(server_host_key_blob, sbloblen);
+	if (server_host_key == NULL)
+		fatal("cannot decode server_host_key_blob");
+	if (server_host_key->type != kex->hostkey_type)
+		fatal("type mismatch for decoded server_host_key_blob");
+	if (kex->verify_host_key == NULL)
+		fatal("cannot verify server_host_key");
+	if (kex->verify_host_key(server_host_key) == -1)
+		fatal("server_host_key verification failed");
+
+	/* Q_S, server public key */
+	server_pubkey = packet_get_string(&pklen);
+	if (pklen != CURVE25519_SIZE)
+		packet_disconnect("bad server public key length %u", pklen);
+
+	/* signed H */
+	signature = packet_get_string(&slen);
+	packet_check_eom();
+
+	if ((shared_secret = BN_new()) == NULL)
+		fatal("%s: BN_new failed", __func__);
+	if (kexc25519_shared_secret(kex->c25519_client_key, server_pubkey,
+	    shared_secret) != 0)
+		packet_disconnect("bad server public curve25519 value");
+	memset(kex->c25519_client_key, 0, CURVE25519_SIZE);
+
+	/* calc and verify H */
+	kex_ecdh_hash(
+	    kex->evp_md,
+	    kex->client_version_string,
+	    kex->server_version_string,
+	    buffer_ptr(&kex->my), buffer_len(&kex->my),
+	    buffer_ptr(&kex->peer), buffer_len(&kex->peer),
+	    server_host_key_blob, sbloblen,
+	    kex->c25519_client_pubkey, CURVE25519_SIZE,
+	    server_pubkey, CURVE25519_SIZE,
+	    shared_secret,
+	    &hash, &hashlen
+	);
+	xfree(server_host_key_blob);
+	xfree(server_pubkey);
+
+	if (key_verify(server_host_key, signature, slen, hash, hashlen) != 1)
+		fatal("key_verify failed for server_host_key");
+	key_free(server_host_key);
+	xfree(signature);
+
+	/* save session id */
+	if (kex->session_id == NULL) {
+		kex->session_id_len = hashlen;
+		kex->session_id = xmalloc(kex->session_id_len);
+		memcpy(kex->session_id, hash, kex->session_id_len);
+	}
+
+	kex_derive_keys(kex, hash, hashlen, shared_secret);
+	BN_clear_free(shared_secret);
+	kex_finish(kex);
+}
@@ -0,0 +1,113 @@
+/*
+ * Placed in the public domain.
+ *
+ * curve25519-sha256 key exchange, server side.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <stdarg.h>
+#include <string.h>
+#include <signal.h>
+
+#include "xmalloc.h"
+#include "buffer.h"
+#include "key.h"
+#include "cipher.h"
+#include "kex.h"
+#include "log.h"
+#include "packet.h"
+#include "ssh2.h"
+#ifdef GSSAPI
+#include "ssh-gss.h"
+#endif
+#include "monitor_wrap.h"
+#include "dispatch.h"
+
+static void input_kex_c25519_init(int, u_int32_t, void *);
+
+void
+kexc25519_server(Kex *kex)
+{
+	debug("expecting SSH2_MSG_KEX_ECDH_INIT");
+	dispatch_set(SSH2_MSG_KEX_ECDH_INIT, &input_kex_c25519_init);
+}
+
+/* ARGSUSED */
+static void
+input_kex_c25519_init(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	BIGNUM *shared_secret;
+	Key *server_host_key;
+	u_char *server_host_key_blob = NULL, *signature = NULL;
+	u_char server_key[CURVE25519_SIZE], server_pubkey[CURVE25519_SIZE];
+	u_char *client_pubkey, *hash;
+	u_int slen, sbloblen, pklen, hashlen;
+
+	dispatch_set(SSH2_MSG_KEX_ECDH_INIT, NULL);
+
+	if (kex->load_host_key == NULL)
+		fatal("Cannot load hostkey");
+	server_host_key = kex->load_host_key(kex->hostkey_type);
+	if (server_host_key == NULL)
+		fatal("Unsupported hostkey type %d", kex->hostkey_type);
+
+	/* Q_C, client public key */
+	client_pubkey = packet_get_string(&pklen);
+	if (pklen != CURVE25519_SIZE)
+		packet_disconnect("bad client public key length %u", pklen);
+	packet_check_eom();
+
+	kexc25519_keygen(server_key, server_pubkey);
+
+	if ((shared_secret = BN_new()) == NULL)
+		fatal("%s: BN_new failed", __func__);
+	if (kexc25519_shared_secret(server_key, client_pubkey,
+	    shared_secret) != 0)
+		packet_disconnect("bad client public curve25519 value");
+	memset(server_key, 0, sizeof(server_key));
+
+	key_to_blob(server_host_key, &server_host_key_blob, &sbloblen);
+
+	/* calc H */
+	kex_ecdh_hash(
+	    kex->evp_md,
+	    kex->client_version_string,
+	    kex->server_version_string,
+	    buffer_ptr(&kex->peer), buffer_len(&kex->peer),
+	    buffer_ptr(&kex->my), buffer_len(&kex->my),
+	    server_host_key_blob, sbloblen,
+	    client_pubkey, CURVE25519_SIZE,
+	    server_pubkey, CURVE25519_SIZE,
+	    shared_secret,
+	    &hash, &hashlen
+	);
+	xfree(client_pubkey);
+
+	/* save session id := H */
+	if (kex->session_id == NULL) {
+		kex->session_id_len = hashlen;
+		kex->session_id = xmalloc(kex->session_id_len);
+		memcpy(kex->session_id, hash, kex->session_id_len);
+	}
+
+	/* sign H */
+	PRIVSEP(key_sign(server_host_key, &signature, &slen, hash, hashlen));
+
+	/* send server hostkey, Q_S and signed H */
+	packet_start(SSH2_MSG_KEX_ECDH_REPLY);
+	packet_put_string(server_host_key_blob, sbloblen);
+	packet_put_string(server_pubkey, CURVE25519_SIZE);
+	packet_put_string(signature, slen);
+	packet_send();
+
+	xfree(signature);
+	xfree(server_host_key_blob);
+
+	kex_derive_keys(kex, hash, hashlen, shared_secret);
+	BN_clear_free(shared_secret);
+	kex_finish(kex);
+}
@@ -41,17 +41,14 @@
 #include "packet.h"
 #include "dh.h"
 #include "ssh2.h"
+#include "dispatch.h"
+
+static void input_kex_dh(int, u_int32_t, void *);
 
 void
 kexdh_client(Kex *kex)
 {
-	BIGNUM *dh_server_pub = NULL, *shared_secret = NULL;
 	DH *dh;
-	Key *server_host_key;
-	u_char *server_host_key_blob = NULL, *signature = NULL;
-	u_char *kbuf, *hash;
-	u_int klen, slen, sbloblen, hashlen;
-	int kout;
 
 	/* generate and send 'e', client DH public key */
 	switch (kex->kex_type) {
@@ -77,8 +74,25 @@ kexdh_client(Kex *kex)
 	fprintf(stderr, "\n");
 #endif
 
+	kex->dh = dh;
 	debug("expecting SSH2_MSG_KEXDH_REPLY");
-	packet_read_expect(SSH2_MSG_KEXDH_REPLY);
+	dispatch_set(SSH2_MSG_KEXDH_REPLY, &input_kex_dh);
+}
+
+/* ARGSUSED */
+static void
+input_kex_dh(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	DH *dh = kex->dh;
+	BIGNUM *dh_server_pub = NULL, *shared_secret = NULL;
+	Key *server_host_key;
+	u_char *server_host_key_blob = NULL, *signature = NULL;
+	u_char *kbuf, *hash;
+	u_int klen, slen, sbloblen, hashlen;
+	int kout;
+
+	dispatch_set(SSH2_MSG_KEXDH_REPLY, NULL);
 
 	/* key, cert */
 	server_host_key_blob = packet_get_string(&sbloblen);
@@ -140,6 +154,7 @@ kexdh_client(Kex *kex)
 	xfree(server_host_key_blob);
 	BN_clear_free(dh_server_pub);
 	DH_free(dh);
+	kex->dh = NULL;
 
 	if (key_verify(server_host_key, signature, slen, hash, hashlen) != 1)
 		fatal("key_verify failed for server_host_key");
@@ -44,16 +44,14 @@
 #include "ssh-gss.h"
 #endif
 #include "monitor_wrap.h"
+#include "dispatch.h"
+
+static void input_kex_dh_init(int, u_int32_t, void *);
 
 void
 kexdh_server(Kex *kex)
 {
-	BIGNUM *shared_secret = NULL, *dh_client_pub = NULL;
 	DH *dh;
-	Key *server_host_key;
-	u_char *kbuf, *hash, *signature = NULL, *server_host_key_blob = NULL;
-	u_int sbloblen, klen, hashlen, slen;
-	int kout;
 
 	/* generate server DH public key */
 	switch (kex->kex_type) {
@@ -67,9 +65,25 @@ kexdh_server(Kex *kex)
 		fatal("%s: Unexpected KEX type %d", __func__, kex->kex_type);
 	}
 	dh_gen_key(dh, kex->we_need * 8);
+	kex->dh = dh;
 
 	debug("expecting SSH2_MSG_KEXDH_INIT");
-	packet_read_expect(SSH2_MSG_KEXDH_INIT);
+	dispatch_set(SSH2_MSG_KEXDH_INIT, &input_kex_dh_init);
+}
+
+/* ARGSUSED */
+static void
+input_kex_dh_init(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	DH *dh = kex->dh;
+	BIGNUM *shared_secret = NULL, *dh_client_pub = NULL;
+	Key *server_host_key;
+	u_char *kbuf, *hash, *signature = NULL, *server_host_key_blob = NULL;
+	u_int sbloblen, klen, hashlen, slen;
+	int kout;
+
+	dispatch_set(SSH2_MSG_KEXDH_INIT, NULL);
 
 	if (kex->load_host_key == NULL)
 		fatal("Cannot load hostkey");
@@ -152,6 +166,7 @@ kexdh_server(Kex *kex)
 	xfree(server_host_key_blob);
 	/* have keys, free DH */
 	DH_free(dh);
+	kex->dh = NULL;
 
 	kex_derive_keys(kex, hash, hashlen, shared_secret);
 	BN_clear_free(shared_secret);
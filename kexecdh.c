@@ -0,0 +1,166 @@
+/*
+ * Placed in the public domain.
+ *
+ * Exchange hash shared by ecdh-sha2-* (RFC 5656) and curve25519-sha256,
+ * and the EC point helpers used by the ecdh-sha2-* client and server.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <signal.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/evp.h>
+#ifdef OPENSSL_HAS_ECC
+#include <openssl/ec.h>
+#include <openssl/ecdh.h>
+#endif
+
+#include "xmalloc.h"
+#include "buffer.h"
+#include "ssh2.h"
+#include "key.h"
+#include "cipher.h"
+#include "kex.h"
+#include "log.h"
+
+void
+kex_ecdh_hash(
+    const EVP_MD *evp_md,
+    char *client_version_string,
+    char *server_version_string,
+    char *ckexinit, int ckexinitlen,
+    char *skexinit, int skexinitlen,
+    u_char *serverhostkeyblob, int sbloblen,
+    u_char *client_pub, u_int client_publen,
+    u_char *server_pub, u_int server_publen,
+    BIGNUM *shared_secret,
+    u_char **hash, u_int *hashlen)
+{
+	Buffer b;
+	static u_char digest[EVP_MAX_MD_SIZE];
+	EVP_MD_CTX md;
+
+	buffer_init(&b);
+	buffer_put_cstring(&b, client_version_string);
+	buffer_put_cstring(&b, server_version_string);
+
+	/* kexinit messages: fake header: len+SSH2_MSG_KEXINIT */
+	buffer_put_int(&b, ckexinitlen+1);
+	buffer_put_char(&b, SSH2_MSG_KEXINIT);
+	buffer_append(&b, ckexinit, ckexinitlen);
+	buffer_put_int(&b, skexinitlen+1);
+	buffer_put_char(&b, SSH2_MSG_KEXINIT);
+	buffer_append(&b, skexinit, skexinitlen);
+
+	buffer_put_string(&b, serverhostkeyblob, sbloblen);
+	buffer_put_string(&b, client_pub, client_publen);
+	buffer_put_string(&b, server_pub, server_publen);
+	buffer_put_bignum2(&b, shared_secret);
+
+#ifdef DEBUG_KEX
+	buffer_dump(&b);
+#endif
+	EVP_DigestInit(&md, evp_md);
+	EVP_DigestUpdate(&md, buffer_ptr(&b), buffer_len(&b));
+	EVP_DigestFinal(&md, digest, NULL);
+
+	buffer_free(&b);
+
+#ifdef DEBUG_KEX
+	dump_digest("hash", digest, EVP_MD_size(evp_md));
+#endif
+	*hash = digest;
+	*hashlen = EVP_MD_size(evp_md);
+}
+
+#ifdef OPENSSL_HAS_ECC
+/* Returns the public point of 'key' in uncompressed form, xmalloc'd */
+u_char *
+kex_ecdh_pub_to_blob(EC_KEY *key, u_int *lenp)
+{
+	const EC_GROUP *group = EC_KEY_get0_group(key);
+	const EC_POINT *pub = EC_KEY_get0_public_key(key);
+	u_char *blob;
+	size_t len;
+
+	len = EC_POINT_point2oct(group, pub, POINT_CONVERSION_UNCOMPRESSED,
+	    NULL, 0, NULL);
+	if (len == 0)
+		fatal("%s: EC_POINT_point2oct failed", __func__);
+	blob = xmalloc(len);
+	if (EC_POINT_point2oct(group, pub, POINT_CONVERSION_UNCOMPRESSED,
+	    blob, len, NULL) != len)
+		fatal("%s: EC_POINT_point2oct failed", __func__);
+	*lenp = len;
+	return blob;
+}
+
+/*
+ * Decodes and validates the peer's public point (RFC 5656, section 3.2.2.1
+ * with cofactor 1).  Returns NULL if it is not acceptable.
+ */
+EC_POINT *
+kex_ecdh_blob_to_pub(const EC_GROUP *group, u_char *blob, u_int len)
+{
+	EC_POINT *pub, *tmp = NULL;
+	BN_CTX *ctx;
+	BIGNUM *order;
+	int ok = 0;
+
+	if (len == 0 || blob[0] != POINT_CONVERSION_UNCOMPRESSED)
+		return NULL;
+	if ((ctx = BN_CTX_new()) == NULL)
+		fatal("%s: BN_CTX_new failed", __func__);
+	BN_CTX_start(ctx);
+	if ((pub = EC_POINT_new(group)) == NULL ||
+	    (tmp = EC_POINT_new(group)) == NULL ||
+	    (order = BN_CTX_get(ctx)) == NULL)
+		fatal("%s: allocation failed", __func__);
+
+	/* oct2point also checks that the point is on the curve */
+	if (EC_POINT_oct2point(group, pub, blob, len, ctx) != 1)
+		goto out;
+	if (EC_POINT_is_at_infinity(group, pub))
+		goto out;
+	/* order * pub must be the point at infinity */
+	if (EC_GROUP_get_order(group, order, ctx) != 1 ||
+	    EC_POINT_mul(group, tmp, NULL, pub, order, ctx) != 1 ||
+	    EC_POINT_is_at_infinity(group, tmp) != 1)
+		goto out;
+	ok = 1;
+ out:
+	BN_CTX_end(ctx);
+	BN_CTX_free(ctx);
+	EC_POINT_free(tmp);
+	if (!ok) {
+		EC_POINT_free(pub);
+		return NULL;
+	}
+	return pub;
+}
+
+void
+kex_ecdh_shared_secret(EC_KEY *key, const EC_POINT *peer, BIGNUM *shared)
+{
+	u_char *kbuf;
+	u_int klen;
+	int kout;
+
+	klen = (EC_GROUP_get_degree(EC_KEY_get0_group(key)) + 7) / 8;
+	kbuf = xmalloc(klen);
+	if ((kout = ECDH_compute_key(kbuf, klen, peer, key, NULL)) < 0 ||
+	    (u_int)kout != klen)
+		fatal("%s: ECDH_compute_key failed", __func__);
+#ifdef DEBUG_KEXECDH
+	dump_digest("shared secret", kbuf, kout);
+#endif
+	if (BN_bin2bn(kbuf, kout, shared) == NULL)
+		fatal("%s: BN_bin2bn failed", __func__);
+	memset(kbuf, 0, klen);
+	xfree(kbuf);
+}
+#endif /* OPENSSL_HAS_ECC */
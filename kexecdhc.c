@@ -0,0 +1,137 @@
+/*
+ * Placed in the public domain.
+ *
+ * ecdh-sha2-nistp256/384/521 key exchange, client side (RFC 5656).
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+
+#include "xmalloc.h"
+#include "buffer.h"
+#include "key.h"
+#include "cipher.h"
+#include "kex.h"
+#include "log.h"
+#include "packet.h"
+#include "ssh2.h"
+#include "dispatch.h"
+
+#ifdef OPENSSL_HAS_ECC
+
+#include <openssl/ecdh.h>
+
+static void input_kex_ecdh_reply(int, u_int32_t, void *);
+
+void
+kexecdh_client(Kex *kex)
+{
+	EC_KEY *client_key;
+	u_char *pub;
+	u_int publen;
+
+	/* generate and send Q_C, the client ephemeral public key */
+	if ((client_key = EC_KEY_new_by_curve_name(kex->ec_nid)) == NULL)
+		fatal("%s: EC_KEY_new_by_curve_name failed", __func__);
+	if (EC_KEY_generate_key(client_key) != 1)
+		fatal("%s: EC_KEY_generate_key failed", __func__);
+	pub = kex_ecdh_pub_to_blob(client_key, &publen);
+
+	packet_start(SSH2_MSG_KEX_ECDH_INIT);
+	packet_put_string(pub, publen);
+	packet_send();
+	xfree(pub);
+	debug("sending SSH2_MSG_KEX_ECDH_INIT");
+
+	kex->ec_client_key = client_key;
+	debug("expecting SSH2_MSG_KEX_ECDH_REPLY");
+	dispatch_set(SSH2_MSG_KEX_ECDH_REPLY, &input_kex_ecdh_reply);
+}
+
+/* ARGSUSED */
+static void
+input_kex_ecdh_reply(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	EC_KEY *client_key = kex->ec_client_key;
+	EC_POINT *server_public;
+	BIGNUM *shared_secret;
+	Key *server_host_key;
+	u_char *server_host_key_blob = NULL, *signature = NULL;
+	u_char *server_pub, *client_pub, *hash;
+	u_int slen, sbloblen, server_publen, client_publen, hashlen;
+
+	dispatch_set(SSH2_MSG_KEX_ECDH_REPLY, NULL);
+
+	/* hostkey */
+	server_host_key_blob = packet_get_string(&sbloblen);
+	server_host_key = key_from_blob(server_host_key_blob, sbloblen);
+	if (server_host_key == NULL)
+		fatal("cannot decode server_host_key_blob");
+	if (server_host_key->type != kex->hostkey_type)
+		fatal("type mismatch for decoded server_host_key_blob");
+	if (kex->verify_host_key == NULL)
+		fatal("cannot verify server_host_key");
+	if (kex->verify_host_key(server_host_key) == -1)
+		fatal("server_host_key verification failed");
+
+	/* Q_S, server public key */
+	server_pub = packet_get_string(&server_publen);
+
+	/* signed H */
+	signature = packet_get_string(&slen);
+	packet_check_eom();
+
+	server_public = kex_ecdh_blob_to_pub(EC_KEY_get0_group(client_key),
+	    server_pub, server_publen);
+	if (server_public == NULL)
+		packet_disconnect("bad server public ECDH value");
+
+	if ((shared_secret = BN_new()) == NULL)
+		fatal("%s: BN_new failed", __func__);
+	kex_ecdh_shared_secret(client_key, server_public, shared_secret);
+	EC_POINT_free(server_public);
+
+	/* calc and verify H */
+	client_pub = kex_ecdh_pub_to_blob(client_key, &client_publen);
+	kex_ecdh_hash(
+	    kex->evp_md,
+	    kex->client_version_string,
+	    kex->server_version_string,
+	    buffer_ptr(&kex->my), buffer_len(&kex->my),
+	    buffer_ptr(&kex->peer), buffer_len(&kex->peer),
+	    server_host_key_blob, sbloblen,
+	    client_pub, client_publen,
+	    server_pub, server_publen,
+	    shared_secret,
+	    &hash, &hashlen
+	);
+	xfree(server_host_key_blob);
+	xfree(client_pub);
+	xfree(server_pub);
+	EC_KEY_free(client_key);
+	kex->ec_client_key = NULL;
+
+	if (key_verify(server_host_key, signature, slen, hash, hashlen) != 1)
+		fatal("key_verify failed for server_host_key");
+	key_free(server_host_key);
+	xfree(signature);
+
+	/* save session id */
+	if (kex->session_id == NULL) {
+		kex->session_id_len = hashlen;
+		kex->session_id = xmalloc(kex->session_id_len);
+		memcpy(kex->session_id, hash, kex->session_id_len);
+	}
+
+	kex_derive_keys(kex, hash, hashlen, shared_secret);
+	BN_clear_free(shared_secret);
+	kex_finish(kex);
+}
+#endif /* OPENSSL_HAS_ECC */
@@ -0,0 +1,126 @@
+/*
+ * Placed in the public domain.
+ *
+ * ecdh-sha2-nistp256/384/521 key exchange, server side (RFC 5656).
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <stdarg.h>
+#include <string.h>
+#include <signal.h>
+
+#include "xmalloc.h"
+#include "buffer.h"
+#include "key.h"
+#include "cipher.h"
+#include "kex.h"
+#include "log.h"
+#include "packet.h"
+#include "ssh2.h"
+#ifdef GSSAPI
+#include "ssh-gss.h"
+#endif
+#include "monitor_wrap.h"
+#include "dispatch.h"
+
+#ifdef OPENSSL_HAS_ECC
+
+#include <openssl/ecdh.h>
+
+static void input_kex_ecdh_init(int, u_int32_t, void *);
+
+void
+kexecdh_server(Kex *kex)
+{
+	debug("expecting SSH2_MSG_KEX_ECDH_INIT");
+	dispatch_set(SSH2_MSG_KEX_ECDH_INIT, &input_kex_ecdh_init);
+}
+
+/* ARGSUSED */
+static void
+input_kex_ecdh_init(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	EC_KEY *server_key;
+	EC_POINT *client_public;
+	BIGNUM *shared_secret;
+	Key *server_host_key;
+	u_char *server_host_key_blob = NULL, *signature = NULL;
+	u_char *server_pub, *client_pub, *hash;
+	u_int slen, sbloblen, server_publen, client_publen, hashlen;
+
+	dispatch_set(SSH2_MSG_KEX_ECDH_INIT, NULL);
+
+	if (kex->load_host_key == NULL)
+		fatal("Cannot load hostkey");
+	server_host_key = kex->load_host_key(kex->hostkey_type);
+	if (server_host_key == NULL)
+		fatal("Unsupported hostkey type %d", kex->hostkey_type);
+
+	/* Q_C, client public key */
+	client_pub = packet_get_string(&client_publen);
+	packet_check_eom();
+
+	if ((server_key = EC_KEY_new_by_curve_name(kex->ec_nid)) == NULL)
+		fatal("%s: EC_KEY_new_by_curve_name failed", __func__);
+	if (EC_KEY_generate_key(server_key) != 1)
+		fatal("%s: EC_KEY_generate_key failed", __func__);
+
+	client_public = kex_ecdh_blob_to_pub(EC_KEY_get0_group(server_key),
+	    client_pub, client_publen);
+	if (client_public == NULL)
+		packet_disconnect("bad client public ECDH value");
+
+	if ((shared_secret = BN_new()) == NULL)
+		fatal("%s: BN_new failed", __func__);
+	kex_ecdh_shared_secret(server_key, client_public, shared_secret);
+	EC_POINT_free(client_public);
+
+	key_to_blob(server_host_key, &server_host_key_blob, &sbloblen);
+
+	/* calc H */
+	server_pub = kex_ecdh_pub_to_blob(server_key, &server_publen);
+	kex_ecdh_hash(
+	    kex->evp_md,
+	    kex->client_version_string,
+	    kex->server_version_string,
+	    buffer_ptr(&kex->peer), buffer_len(&kex->peer),
+	    buffer_ptr(&kex->my), buffer_len(&kex->my),
+	    server_host_key_blob, sbloblen,
+	    client_pub, client_publen,
+	    server_pub, server_publen,
+	    shared_secret,
+	    &hash, &hashlen
+	);
+	xfree(client_pub);
+	EC_KEY_free(server_key);
+
+	/* save session id := H */
+	if (kex->session_id == NULL) {
+		kex->session_id_len = hashlen;
+		kex->session_id = xmalloc(kex->session_id_len);
+		memcpy(kex->session_id, hash, kex->session_id_len);
+	}
+
+	/* sign H */
+	PRIVSEP(key_sign(server_host_key, &signature, &slen, hash, hashlen));
+
+	/* send server hostkey, Q_S and signed H */
+	packet_start(SSH2_MSG_KEX_ECDH_REPLY);
+	packet_put_string(server_host_key_blob, sbloblen);
+	packet_put_string(server_pub, server_publen);
+	packet_put_string(signature, slen);
+	packet_send();
+
+	xfree(signature);
+	xfree(server_host_key_blob);
+	xfree(server_pub);
+
+	kex_derive_keys(kex, hash, hashlen, shared_secret);
+	BN_clear_free(shared_secret);
+	kex_finish(kex);
+}
+#endif /* OPENSSL_HAS_ECC */
@@ -43,18 +43,15 @@
 #include "dh.h"
 #include "ssh2.h"
 #include "compat.h"
+#include "dispatch.h"
+
+static void input_kex_dh_gex_group(int, u_int32_t, void *);
+static void input_kex_dh_gex_reply(int, u_int32_t, void *);
 
 void
 kexgex_client(Kex *kex)
 {
-	BIGNUM *dh_server_pub = NULL, *shared_secret = NULL;
-	BIGNUM *p = NULL, *g = NULL;
-	Key *server_host_key;
-	u_char *kbuf, *hash, *signature = NULL, *server_host_key_blob = NULL;
-	u_int klen, slen, sbloblen, hashlen;
-	int kout;
 	int min, max, nbits;
-	DH *dh;
 
 	nbits = dh_estimate(kex->we_need * 8);
 
@@ -83,10 +80,23 @@ kexgex_client(Kex *kex)
 	    min, nbits, max);
 #endif
 	packet_send();
+	kex->min = min;
+	kex->max = max;
+	kex->nbits = nbits;
 
 	debug("expecting SSH2_MSG_KEX_DH_GEX_GROUP");
-	packet_read_expect(SSH2_MSG_KEX_DH_GEX_GROUP);
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_GROUP, &input_kex_dh_gex_group);
+}
+
+/* ARGSUSED */
+static void
+input_kex_dh_gex_group(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	BIGNUM *p = NULL, *g = NULL;
+	DH *dh;
 
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_GROUP, NULL);
 	if ((p = BN_new()) == NULL)
 		fatal("BN_new");
 	packet_get_bignum2(p);
@@ -95,9 +105,9 @@ kexgex_client(Kex *kex)
 	packet_get_bignum2(g);
 	packet_check_eom();
 
-	if (BN_num_bits(p) < min || BN_num_bits(p) > max)
+	if (BN_num_bits(p) < kex->min || BN_num_bits(p) > kex->max)
 		fatal("DH_GEX group out of range: %d !< %d !< %d",
-		    min, BN_num_bits(p), max);
+		    kex->min, BN_num_bits(p), kex->max);
 
 	dh = dh_new_group(g, p);
 	dh_gen_key(dh, kex->we_need * 8);
@@ -114,9 +124,25 @@ kexgex_client(Kex *kex)
 	packet_start(SSH2_MSG_KEX_DH_GEX_INIT);
 	packet_put_bignum2(dh->pub_key);
 	packet_send();
+	kex->dh = dh;
 
 	debug("expecting SSH2_MSG_KEX_DH_GEX_REPLY");
-	packet_read_expect(SSH2_MSG_KEX_DH_GEX_REPLY);
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_REPLY, &input_kex_dh_gex_reply);
+}
+
+/* ARGSUSED */
+static void
+input_kex_dh_gex_reply(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	DH *dh = kex->dh;
+	BIGNUM *dh_server_pub = NULL, *shared_secret = NULL;
+	Key *server_host_key;
+	u_char *kbuf, *hash, *signature = NULL, *server_host_key_blob = NULL;
+	u_int klen, slen, sbloblen, hashlen;
+	int kout;
+
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_REPLY, NULL);
 
 	/* key, cert */
 	server_host_key_blob = packet_get_string(&sbloblen);
@@ -164,7 +190,7 @@ kexgex_client(Kex *kex)
 	xfree(kbuf);
 
 	if (datafellows & SSH_OLD_DHGEX)
-		min = max = -1;
+		kex->min = kex->max = -1;
 
 	/* calc and verify H */
 	kexgex_hash(
@@ -174,7 +200,7 @@ kexgex_client(Kex *kex)
 	    buffer_ptr(&kex->my), buffer_len(&kex->my),
 	    buffer_ptr(&kex->peer), buffer_len(&kex->peer),
 	    server_host_key_blob, sbloblen,
-	    min, nbits, max,
+	    kex->min, kex->nbits, kex->max,
 	    dh->p, dh->g,
 	    dh->pub_key,
 	    dh_server_pub,
@@ -184,6 +210,7 @@ kexgex_client(Kex *kex)
 
 	/* have keys, free DH */
 	DH_free(dh);
+	kex->dh = NULL;
 	xfree(server_host_key_blob);
 	BN_clear_free(dh_server_pub);
 
@@ -47,24 +47,31 @@
 #include "ssh-gss.h"
 #endif
 #include "monitor_wrap.h"
+#include "dispatch.h"
+
+static void input_kex_dh_gex_request(int, u_int32_t, void *);
+static void input_kex_dh_gex_init(int, u_int32_t, void *);
 
 void
 kexgex_server(Kex *kex)
 {
-	BIGNUM *shared_secret = NULL, *dh_client_pub = NULL;
-	Key *server_host_key;
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_REQUEST_OLD,
+	    &input_kex_dh_gex_request);
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_REQUEST, &input_kex_dh_gex_request);
+	debug("expecting SSH2_MSG_KEX_DH_GEX_REQUEST");
+}
+
+/* ARGSUSED */
+static void
+input_kex_dh_gex_request(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
 	DH *dh;
-	u_char *kbuf, *hash, *signature = NULL, *server_host_key_blob = NULL;
-	u_int sbloblen, klen, slen, hashlen;
-	int min = -1, max = -1, nbits = -1, type, kout;
+	int min = -1, max = -1, nbits = -1;
 
-	if (kex->load_host_key == NULL)
-		fatal("Cannot load hostkey");
-	server_host_key = kex->load_host_key(kex->hostkey_type);
-	if (server_host_key == NULL)
-		fatal("Unsupported hostkey type %d", kex->hostkey_type);
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_REQUEST_OLD, NULL);
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_REQUEST, NULL);
 
-	type = packet_read();
 	switch (type) {
 	case SSH2_MSG_KEX_DH_GEX_REQUEST:
 		debug("SSH2_MSG_KEX_DH_GEX_REQUEST received");
@@ -101,14 +108,41 @@ kexgex_server(Kex *kex)
 	packet_put_bignum2(dh->g);
 	packet_send();
 
-	/* flush */
-	packet_write_wait();
+	/* flush, but do not stall the other channels if the link is busy */
+	packet_write_poll();
 
 	/* Compute our exchange value in parallel with the client */
 	dh_gen_key(dh, kex->we_need * 8);
+	if (type == SSH2_MSG_KEX_DH_GEX_REQUEST_OLD)
+		min = max = -1;		/* not part of the hash for old GEX */
+	kex->dh = dh;
+	kex->min = min;
+	kex->max = max;
+	kex->nbits = nbits;
 
 	debug("expecting SSH2_MSG_KEX_DH_GEX_INIT");
-	packet_read_expect(SSH2_MSG_KEX_DH_GEX_INIT);
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_INIT, &input_kex_dh_gex_init);
+}
+
+/* ARGSUSED */
+static void
+input_kex_dh_gex_init(int type, u_int32_t seq, void *ctxt)
+{
+	Kex *kex = ctxt;
+	DH *dh = kex->dh;
+	BIGNUM *shared_secret = NULL, *dh_client_pub = NULL;
+	Key *server_host_key;
+	u_char *kbuf, *hash, *signature = NULL, *server_host_key_blob = NULL;
+	u_int sbloblen, klen, slen, hashlen;
+	int kout;
+
+	dispatch_set(SSH2_MSG_KEX_DH_GEX_INIT, NULL);
+
+	if (kex->load_host_key == NULL)
+		fatal("Cannot load hostkey");
+	server_host_key = kex->load_host_key(kex->hostkey_type);
+	if (server_host_key == NULL)
+		fatal("Unsupported hostkey type %d", kex->hostkey_type);
 
 	/* key, cert */
 	if ((dh_client_pub = BN_new()) == NULL)
@@ -148,9 +182,6 @@ kexgex_server(Kex *kex)
 
 	key_to_blob(server_host_key, &server_host_key_blob, &sbloblen);
 
-	if (type == SSH2_MSG_KEX_DH_GEX_REQUEST_OLD)
-		min = max = -1;
-
 	/* calc H */
 	kexgex_hash(
 	    kex->evp_md,
@@ -159,7 +190,7 @@ kexgex_server(Kex *kex)
 	    buffer_ptr(&kex->peer), buffer_len(&kex->peer),
 	    buffer_ptr(&kex->my), buffer_len(&kex->my),
 	    server_host_key_blob, sbloblen,
-	    min, nbits, max,
+	    kex->min, kex->nbits, kex->max,
 	    dh->p, dh->g,
 	    dh_client_pub,
 	    dh->pub_key,
@@ -192,6 +223,7 @@ kexgex_server(Kex *kex)
 	xfree(server_host_key_blob);
 	/* have keys, free DH */
 	DH_free(dh);
+	kex->dh = NULL;
 
 	kex_derive_keys(kex, hash, hashlen, shared_secret);
 	BN_clear_free(shared_secret);
@@ -49,6 +49,11 @@
 #include "uuencode.h"
 #include "buffer.h"
 #include "log.h"
+#include "ed25519.h"
+
+#ifdef OPENSSL_HAS_ECC
+static int key_ecdsa_nid_from_name(const char *);
+#endif
 
 Key *
 key_new(int type)
@@ -60,6 +65,10 @@ key_new(int type)
 	k->type = type;
 	k->dsa = NULL;
 	k->rsa = NULL;
+	k->ecdsa_nid = -1;
+	k->ecdsa = NULL;
+	k->ed25519_sk = NULL;
+	k->ed25519_pk = NULL;
 	switch (k->type) {
 	case KEY_RSA1:
 	case KEY_RSA:
@@ -84,6 +93,12 @@ key_new(int type)
 			fatal("key_new: BN_new failed");
 		k->dsa = dsa;
 		break;
+	case KEY_ECDSA:
+		/* Cannot do anything until we know the group */
+		break;
+	case KEY_ED25519:
+		/* the key material is allocated by whoever fills it in */
+		break;
 	case KEY_UNSPEC:
 		break;
 	default:
@@ -142,6 +157,25 @@ key_free(Key *k)
 			DSA_free(k->dsa);
 		k->dsa = NULL;
 		break;
+	case KEY_ECDSA:
+#ifdef OPENSSL_HAS_ECC
+		if (k->ecdsa != NULL)
+			EC_KEY_free(k->ecdsa);
+#endif
+		k->ecdsa = NULL;
+		break;
+	case KEY_ED25519:
+		if (k->ed25519_pk != NULL) {
+			memset(k->ed25519_pk, 0, ED25519_PK_SZ);
+			xfree(k->ed25519_pk);
+			k->ed25519_pk = NULL;
+		}
+		if (k->ed25519_sk != NULL) {
+			memset(k->ed25519_sk, 0, ED25519_SK_SZ);
+			xfree(k->ed25519_sk);
+			k->ed25519_sk = NULL;
+		}
+		break;
 	case KEY_UNSPEC:
 		break;
 	default:
@@ -154,6 +188,11 @@ key_free(Key *k)
 int
 key_equal(const Key *a, const Key *b)
 {
+#ifdef OPENSSL_HAS_ECC
+	BN_CTX *bnctx;
+	int ret;
+#endif
+
 	if (a == NULL || b == NULL || a->type != b->type)
 		return 0;
 	switch (a->type) {
@@ -168,6 +207,24 @@ key_equal(const Key *a, const Key *b)
 		    BN_cmp(a->dsa->q, b->dsa->q) == 0 &&
 		    BN_cmp(a->dsa->g, b->dsa->g) == 0 &&
 		    BN_cmp(a->dsa->pub_key, b->dsa->pub_key) == 0;
+#ifdef OPENSSL_HAS_ECC
+	case KEY_ECDSA:
+		if (a->ecdsa == NULL || b->ecdsa == NULL ||
+		    a->ecdsa_nid != b->ecdsa_nid ||
+		    EC_KEY_get0_public_key(a->ecdsa) == NULL ||
+		    EC_KEY_get0_public_key(b->ecdsa) == NULL)
+			return 0;
+		if ((bnctx = BN_CTX_new()) == NULL)
+			fatal("key_equal: BN_CTX_new failed");
+		ret = EC_POINT_cmp(EC_KEY_get0_group(a->ecdsa),
+		    EC_KEY_get0_public_key(a->ecdsa),
+		    EC_KEY_get0_public_key(b->ecdsa), bnctx) == 0;
+		BN_CTX_free(bnctx);
+		return ret;
+#endif
+	case KEY_ED25519:
+		return a->ed25519_pk != NULL && b->ed25519_pk != NULL &&
+		    memcmp(a->ed25519_pk, b->ed25519_pk, ED25519_PK_SZ) == 0;
 	default:
 		fatal("key_equal: bad key type %d", a->type);
 	}
@@ -208,6 +265,8 @@ key_fingerprint_raw(const Key *k, enum fp_type dgst_type,
 		break;
 	case KEY_DSA:
 	case KEY_RSA:
+	case KEY_ECDSA:
+	case KEY_ED25519:
 		key_to_blob(k, &blob, &len);
 		break;
 	case KEY_UNSPEC:
@@ -411,6 +470,8 @@ key_read(Key *ret, char **cpp)
 	case KEY_UNSPEC:
 	case KEY_RSA:
 	case KEY_DSA:
+	case KEY_ECDSA:
+	case KEY_ED25519:
 		space = strchr(cp, ' ');
 		if (space == NULL) {
 			debug3("key_read: missing whitespace");
@@ -464,7 +525,7 @@ key_read(Key *ret, char **cpp)
 #ifdef DEBUG_PK
 			RSA_print_fp(stderr, ret->rsa, 8);
 #endif
-		} else {
+		} else if (ret->type == KEY_DSA) {
 			if (ret->dsa != NULL)
 				DSA_free(ret->dsa);
 			ret->dsa = k->dsa;
@@ -473,6 +534,22 @@ key_read(Key *ret, char **cpp)
 #ifdef DEBUG_PK
 			DSA_print_fp(stderr, ret->dsa, 8);
 #endif
+#ifdef OPENSSL_HAS_ECC
+		} else if (ret->type == KEY_ECDSA) {
+			if (ret->ecdsa != NULL)
+				EC_KEY_free(ret->ecdsa);
+			ret->ecdsa = k->ecdsa;
+			ret->ecdsa_nid = k->ecdsa_nid;
+			k->ecdsa = NULL;
+			k->ecdsa_nid = -1;
+			success = 1;
+#endif
+		} else if (ret->type == KEY_ED25519) {
+			if (ret->ed25519_pk != NULL)
+				xfree(ret->ed25519_pk);
+			ret->ed25519_pk = k->ed25519_pk;
+			k->ed25519_pk = NULL;
+			success = 1;
 		}
 /*XXXX*/
 		key_free(k);
@@ -511,7 +588,9 @@ key_write(const Key *key, FILE *f)
 			error("key_write: failed for RSA key");
 		}
 	} else if ((key->type == KEY_DSA && key->dsa != NULL) ||
-	    (key->type == KEY_RSA && key->rsa != NULL)) {
+	    (key->type == KEY_RSA && key->rsa != NULL) ||
+	    (key->type == KEY_ECDSA && key->ecdsa != NULL) ||
+	    (key->type == KEY_ED25519 && key->ed25519_pk != NULL)) {
 		key_to_blob(key, &blob, &len);
 		uu = xmalloc(2*len);
 		n = uuencode(blob, len, uu, 2*len);
@@ -535,6 +614,10 @@ key_type(const Key *k)
 		return "RSA";
 	case KEY_DSA:
 		return "DSA";
+	case KEY_ECDSA:
+		return "ECDSA";
+	case KEY_ED25519:
+		return "ED25519";
 	}
 	return "unknown";
 }
@@ -547,6 +630,20 @@ key_ssh_name(const Key *k)
 		return "ssh-rsa";
 	case KEY_DSA:
 		return "ssh-dss";
+	case KEY_ECDSA:
+		switch (k->ecdsa_nid) {
+#ifdef OPENSSL_HAS_ECC
+		case NID_X9_62_prime256v1:
+			return "ecdsa-sha2-nistp256";
+		case NID_secp384r1:
+			return "ecdsa-sha2-nistp384";
+		case NID_secp521r1:
+			return "ecdsa-sha2-nistp521";
+#endif
+		}
+		break;
+	case KEY_ED25519:
+		return "ssh-ed25519";
 	}
 	return "ssh-unknown";
 }
@@ -560,6 +657,10 @@ key_size(const Key *k)
 		return BN_num_bits(k->rsa->n);
 	case KEY_DSA:
 		return BN_num_bits(k->dsa->p);
+	case KEY_ECDSA:
+		return key_curve_nid_to_bits(k->ecdsa_nid);
+	case KEY_ED25519:
+		return 256;
 	}
 	return 0;
 }
@@ -589,6 +690,24 @@ dsa_generate_private_key(u_int bits)
 	return private;
 }
 
+#ifdef OPENSSL_HAS_ECC
+static EC_KEY *
+ecdsa_generate_private_key(u_int bits, int *nid)
+{
+	EC_KEY *private;
+
+	if ((*nid = key_ecdsa_bits_to_nid(bits)) == -1)
+		fatal("%s: invalid key length %u", __func__, bits);
+	if ((private = EC_KEY_new_by_curve_name(*nid)) == NULL)
+		fatal("%s: EC_KEY_new_by_curve_name failed", __func__);
+	if (EC_KEY_generate_key(private) != 1)
+		fatal("%s: EC_KEY_generate_key failed", __func__);
+	/* write the curve by name, not by its explicit parameters */
+	EC_KEY_set_asn1_flag(private, OPENSSL_EC_NAMED_CURVE);
+	return private;
+}
+#endif
+
 Key *
 key_generate(int type, u_int bits)
 {
@@ -601,6 +720,16 @@ key_generate(int type, u_int bits)
 	case KEY_RSA1:
 		k->rsa = rsa_generate_private_key(bits);
 		break;
+#ifdef OPENSSL_HAS_ECC
+	case KEY_ECDSA:
+		k->ecdsa = ecdsa_generate_private_key(bits, &k->ecdsa_nid);
+		break;
+#endif
+	case KEY_ED25519:
+		k->ed25519_pk = xmalloc(ED25519_PK_SZ);
+		k->ed25519_sk = xmalloc(ED25519_SK_SZ);
+		crypto_sign_ed25519_keypair(k->ed25519_pk, k->ed25519_sk);
+		break;
 	default:
 		fatal("key_generate: unknown type %d", type);
 	}
@@ -628,6 +757,24 @@ key_from_private(const Key *k)
 		    (BN_copy(n->rsa->e, k->rsa->e) == NULL))
 			fatal("key_from_private: BN_copy failed");
 		break;
+#ifdef OPENSSL_HAS_ECC
+	case KEY_ECDSA:
+		n = key_new(k->type);
+		n->ecdsa_nid = k->ecdsa_nid;
+		if ((n->ecdsa = EC_KEY_new_by_curve_name(k->ecdsa_nid)) == NULL)
+			fatal("key_from_private: EC_KEY_new_by_curve_name failed");
+		if (EC_KEY_set_public_key(n->ecdsa,
+		    EC_KEY_get0_public_key(k->ecdsa)) != 1)
+			fatal("key_from_private: EC_KEY_set_public_key failed");
+		break;
+#endif
+	case KEY_ED25519:
+		n = key_new(k->type);
+		if (k->ed25519_pk != NULL) {
+			n->ed25519_pk = xmalloc(ED25519_PK_SZ);
+			memcpy(n->ed25519_pk, k->ed25519_pk, ED25519_PK_SZ);
+		}
+		break;
 	default:
 		fatal("key_from_private: unknown type %d", k->type);
 		break;
@@ -648,6 +795,14 @@ key_type_from_name(char *name)
 		return KEY_RSA;
 	} else if (strcmp(name, "ssh-dss") == 0) {
 		return KEY_DSA;
+	} else if (strcmp(name, "ed25519") == 0 ||
+	    strcmp(name, "ssh-ed25519") == 0) {
+		return KEY_ED25519;
+#ifdef OPENSSL_HAS_ECC
+	} else if (strcmp(name, "ecdsa") == 0 ||
+	    key_ecdsa_nid_from_name(name) != -1) {
+		return KEY_ECDSA;
+#endif
 	}
 	debug2("key_type_from_name: unknown key type '%s'", name);
 	return KEY_UNSPEC;
@@ -675,6 +830,216 @@ key_names_valid2(const char *names)
 	return 1;
 }
 
+int
+key_ecdsa_bits_to_nid(int bits)
+{
+	switch (bits) {
+#ifdef OPENSSL_HAS_ECC
+	case 256:
+		return NID_X9_62_prime256v1;
+	case 384:
+		return NID_secp384r1;
+	case 521:
+		return NID_secp521r1;
+#endif
+	default:
+		return -1;
+	}
+}
+
+int
+key_curve_name_to_nid(const char *name)
+{
+#ifdef OPENSSL_HAS_ECC
+	if (strcmp(name, "nistp256") == 0)
+		return NID_X9_62_prime256v1;
+	else if (strcmp(name, "nistp384") == 0)
+		return NID_secp384r1;
+	else if (strcmp(name, "nistp521") == 0)
+		return NID_secp521r1;
+#endif
+	debug("%s: unsupported EC curve name \"%.100s\"", __func__, name);
+	return -1;
+}
+
+const char *
+key_curve_nid_to_name(int nid)
+{
+#ifdef OPENSSL_HAS_ECC
+	if (nid == NID_X9_62_prime256v1)
+		return "nistp256";
+	else if (nid == NID_secp384r1)
+		return "nistp384";
+	else if (nid == NID_secp521r1)
+		return "nistp521";
+#endif
+	error("%s: unsupported EC curve nid %d", __func__, nid);
+	return NULL;
+}
+
+u_int
+key_curve_nid_to_bits(int nid)
+{
+	switch (nid) {
+#ifdef OPENSSL_HAS_ECC
+	case NID_X9_62_prime256v1:
+		return 256;
+	case NID_secp384r1:
+		return 384;
+	case NID_secp521r1:
+		return 521;
+#endif
+	default:
+		error("%s: unsupported EC curve nid %d", __func__, nid);
+		return 0;
+	}
+}
+
+#ifdef OPENSSL_HAS_ECC
+/* Maps "ecdsa-sha2-nistp256" and friends to a curve NID, -1 otherwise */
+static int
+key_ecdsa_nid_from_name(const char *name)
+{
+	if (strncmp(name, "ecdsa-sha2-", 11) != 0)
+		return -1;
+	if (strcmp(name + 11, "nistp256") == 0)
+		return NID_X9_62_prime256v1;
+	else if (strcmp(name + 11, "nistp384") == 0)
+		return NID_secp384r1;
+	else if (strcmp(name + 11, "nistp521") == 0)
+		return NID_secp521r1;
+	return -1;
+}
+
+/* Returns the NID of a key loaded from a file if it is a curve we speak */
+int
+key_ecdsa_key_to_nid(EC_KEY *k)
+{
+	const EC_GROUP *g = EC_KEY_get0_group(k);
+	int nid;
+
+	if (g == NULL)
+		return -1;
+	nid = EC_GROUP_get_curve_name(g);
+	if (nid != NID_X9_62_prime256v1 && nid != NID_secp384r1 &&
+	    nid != NID_secp521r1)
+		return -1;
+	return nid;
+}
+
+const EVP_MD *
+key_ec_nid_to_evpmd(int nid)
+{
+	int kbits = key_curve_nid_to_bits(nid);
+
+	if (kbits == 0)
+		fatal("%s: invalid nid %d", __func__, nid);
+	/* RFC5656 section 6.2.1 */
+	if (kbits <= 256)
+		return EVP_sha256();
+	else if (kbits <= 384)
+		return EVP_sha384();
+	else
+		return EVP_sha512();
+}
+
+/*
+ * Checks a public point as described in SEC1 3.2.2.1 (the curves we use
+ * have cofactor 1).  Returns 0 if the point is acceptable, -1 if not.
+ */
+int
+key_ec_validate_public(const EC_GROUP *group, const EC_POINT *public)
+{
+	BN_CTX *bnctx;
+	EC_POINT *nq = NULL;
+	BIGNUM *order;
+	int ret = -1;
+
+	if ((bnctx = BN_CTX_new()) == NULL)
+		fatal("%s: BN_CTX_new failed", __func__);
+	BN_CTX_start(bnctx);
+	if ((order = BN_CTX_get(bnctx)) == NULL ||
+	    (nq = EC_POINT_new(group)) == NULL)
+		fatal("%s: allocation failed", __func__);
+
+	if (EC_POINT_is_at_infinity(group, public)) {
+		error("%s: received degenerate public key", __func__);
+		goto out;
+	}
+	if (EC_POINT_is_on_curve(group, public, bnctx) != 1) {
+		error("%s: public key is not on the curve", __func__);
+		goto out;
+	}
+	/* order * Q must be the point at infinity */
+	if (EC_GROUP_get_order(group, order, bnctx) != 1 ||
+	    EC_POINT_mul(group, nq, NULL, public, order, bnctx) != 1)
+		fatal("%s: EC_POINT_mul failed", __func__);
+	if (EC_POINT_is_at_infinity(group, nq) != 1) {
+		error("%s: public key has the wrong order", __func__);
+		goto out;
+	}
+	ret = 0;
+ out:
+	BN_CTX_end(bnctx);
+	BN_CTX_free(bnctx);
+	EC_POINT_free(nq);
+	return ret;
+}
+
+/* Checks 1 < private < order - 1; returns 0 if acceptable, -1 if not */
+int
+key_ec_validate_private(const EC_KEY *key)
+{
+	BN_CTX *bnctx;
+	BIGNUM *order, *tmp;
+	int ret = -1;
+
+	if ((bnctx = BN_CTX_new()) == NULL)
+		fatal("%s: BN_CTX_new failed", __func__);
+	BN_CTX_start(bnctx);
+	if ((order = BN_CTX_get(bnctx)) == NULL ||
+	    (tmp = BN_CTX_get(bnctx)) == NULL)
+		fatal("%s: BN_CTX_get failed", __func__);
+
+	if (EC_GROUP_get_order(EC_KEY_get0_group(key), order, bnctx) != 1)
+		fatal("%s: EC_GROUP_get_order failed", __func__);
+	if (BN_num_bits(EC_KEY_get0_private_key(key)) <=
+	    BN_num_bits(order) / 2) {
+		error("%s: private key too small", __func__);
+		goto out;
+	}
+	if (!BN_sub(tmp, order, BN_value_one()))
+		fatal("%s: BN_sub failed", __func__);
+	if (BN_cmp(EC_KEY_get0_private_key(key), tmp) >= 0) {
+		error("%s: private key >= group order - 1", __func__);
+		goto out;
+	}
+	ret = 0;
+ out:
+	BN_CTX_end(bnctx);
+	BN_CTX_free(bnctx);
+	return ret;
+}
+
+/* Reads and validates an ECDSA public point into key->ecdsa */
+static int
+key_ec_get_public(Buffer *b, Key *key)
+{
+	const EC_GROUP *group = EC_KEY_get0_group(key->ecdsa);
+	EC_POINT *q;
+	int ret = -1;
+
+	if ((q = EC_POINT_new(group)) == NULL)
+		fatal("%s: EC_POINT_new failed", __func__);
+	if (buffer_get_ecpoint_ret(b, group, q) == 0 &&
+	    key_ec_validate_public(group, q) == 0 &&
+	    EC_KEY_set_public_key(key->ecdsa, q) == 1)
+		ret = 0;
+	EC_POINT_free(q);
+	return ret;
+}
+#endif /* OPENSSL_HAS_ECC */
+
 Key *
 key_from_blob(const u_char *blob, u_int blen)
 {
@@ -682,6 +1047,11 @@ key_from_blob(const u_char *blob, u_int blen)
 	int rlen, type;
 	char *ktype = NULL;
 	Key *key = NULL;
+	u_char *pk;
+	u_int len;
+#ifdef OPENSSL_HAS_ECC
+	char *curve;
+#endif
 
 #ifdef DEBUG_PK
 	dump_base64(stderr, blob, blen);
@@ -724,6 +1094,46 @@ key_from_blob(const u_char *blob, u_int blen)
 		DSA_print_fp(stderr, key->dsa, 8);
 #endif
 		break;
+#ifdef OPENSSL_HAS_ECC
+	case KEY_ECDSA:
+		key = key_new(type);
+		key->ecdsa_nid = key_ecdsa_nid_from_name(ktype);
+		if ((curve = buffer_get_string_ret(&b, NULL)) == NULL) {
+			error("key_from_blob: can't read ecdsa curve");
+			key_free(key);
+			key = NULL;
+			goto out;
+		}
+		if (key->ecdsa_nid != key_curve_name_to_nid(curve)) {
+			error("key_from_blob: ecdsa curve doesn't match type");
+			xfree(curve);
+			key_free(key);
+			key = NULL;
+			goto out;
+		}
+		xfree(curve);
+		if ((key->ecdsa = EC_KEY_new_by_curve_name(
+		    key->ecdsa_nid)) == NULL)
+			fatal("key_from_blob: EC_KEY_new_by_curve_name failed");
+		if (key_ec_get_public(&b, key) != 0) {
+			error("key_from_blob: can't read ecdsa key point");
+			key_free(key);
+			key = NULL;
+			goto out;
+		}
+		break;
+#endif
+	case KEY_ED25519:
+		if ((pk = buffer_get_string_ret(&b, &len)) == NULL ||
+		    len != ED25519_PK_SZ) {
+			error("key_from_blob: can't read ed25519 key");
+			if (pk != NULL)
+				xfree(pk);
+			goto out;
+		}
+		key = key_new(type);
+		key->ed25519_pk = pk;
+		break;
 	case KEY_UNSPEC:
 		key = key_new(type);
 		break;
@@ -765,6 +1175,18 @@ key_to_blob(const Key *key, u_char **blobp, u_int *lenp)
 		buffer_put_bignum2(&b, key->rsa->e);
 		buffer_put_bignum2(&b, key->rsa->n);
 		break;
+#ifdef OPENSSL_HAS_ECC
+	case KEY_ECDSA:
+		buffer_put_cstring(&b, key_ssh_name(key));
+		buffer_put_cstring(&b, key_curve_nid_to_name(key->ecdsa_nid));
+		buffer_put_ecpoint(&b, EC_KEY_get0_group(key->ecdsa),
+		    EC_KEY_get0_public_key(key->ecdsa));
+		break;
+#endif
+	case KEY_ED25519:
+		buffer_put_cstring(&b, key_ssh_name(key));
+		buffer_put_string(&b, key->ed25519_pk, ED25519_PK_SZ);
+		break;
 	default:
 		error("key_to_blob: unsupported key type %d", key->type);
 		buffer_free(&b);
@@ -793,6 +1215,12 @@ key_sign(
 		return ssh_dss_sign(key, sigp, lenp, data, datalen);
 	case KEY_RSA:
 		return ssh_rsa_sign(key, sigp, lenp, data, datalen);
+#ifdef OPENSSL_HAS_ECC
+	case KEY_ECDSA:
+		return ssh_ecdsa_sign(key, sigp, lenp, data, datalen);
+#endif
+	case KEY_ED25519:
+		return ssh_ed25519_sign(key, sigp, lenp, data, datalen);
 	default:
 		error("key_sign: invalid key type %d", key->type);
 		return -1;
@@ -817,6 +1245,12 @@ key_verify(
 		return ssh_dss_verify(key, signature, signaturelen, data, datalen);
 	case KEY_RSA:
 		return ssh_rsa_verify(key, signature, signaturelen, data, datalen);
+#ifdef OPENSSL_HAS_ECC
+	case KEY_ECDSA:
+		return ssh_ecdsa_verify(key, signature, signaturelen, data, datalen);
+#endif
+	case KEY_ED25519:
+		return ssh_ed25519_verify(key, signature, signaturelen, data, datalen);
 	default:
 		error("key_verify: invalid key type %d", key->type);
 		return -1;
@@ -834,6 +1268,10 @@ key_demote(const Key *k)
 	pk->flags = k->flags;
 	pk->dsa = NULL;
 	pk->rsa = NULL;
+	pk->ecdsa_nid = k->ecdsa_nid;
+	pk->ecdsa = NULL;
+	pk->ed25519_sk = NULL;
+	pk->ed25519_pk = NULL;
 
 	switch (k->type) {
 	case KEY_RSA1:
@@ -857,6 +1295,21 @@ key_demote(const Key *k)
 		if ((pk->dsa->pub_key = BN_dup(k->dsa->pub_key)) == NULL)
 			fatal("key_demote: BN_dup failed");
 		break;
+#ifdef OPENSSL_HAS_ECC
+	case KEY_ECDSA:
+		if ((pk->ecdsa = EC_KEY_new_by_curve_name(pk->ecdsa_nid)) == NULL)
+			fatal("key_demote: EC_KEY_new_by_curve_name failed");
+		if (EC_KEY_set_public_key(pk->ecdsa,
+		    EC_KEY_get0_public_key(k->ecdsa)) != 1)
+			fatal("key_demote: EC_KEY_set_public_key failed");
+		break;
+#endif
+	case KEY_ED25519:
+		if (k->ed25519_pk != NULL) {
+			pk->ed25519_pk = xmalloc(ED25519_PK_SZ);
+			memcpy(pk->ed25519_pk, k->ed25519_pk, ED25519_PK_SZ);
+		}
+		break;
 	default:
 		fatal("key_free: bad key type %d", k->type);
 		break;
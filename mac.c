@@ -186,3 +186,22 @@ mac_valid(const char *names)
 	xfree(maclist);
 	return (1);
 }
+
+/* Returns a comma-separated list of every MAC in the table */
+char *
+mac_alg_list(void)
+{
+	char *ret = NULL;
+	size_t nlen, rlen = 0;
+	int i;
+
+	for (i = 0; macs[i].name; i++) {
+		if (ret != NULL)
+			ret[rlen++] = *MAC_SEP;
+		nlen = strlen(macs[i].name);
+		ret = xrealloc(ret, 1, rlen + nlen + 2);
+		memcpy(ret + rlen, macs[i].name, nlen + 1);
+		rlen += nlen;
+	}
+	return (ret);
+}
@@ -24,6 +24,7 @@
  */
 
 int	 mac_valid(const char *);
+char	*mac_alg_list(void);
 int	 mac_setup(Mac *, char *);
 int	 mac_init(Mac *);
 u_char	*mac_compute(Mac *, u_int32_t, u_char *, int);
@@ -40,17 +40,24 @@
 #include "includes.h"
 
 #include <sys/types.h>
+#include <sys/param.h>
+#include <sys/wait.h>
 
 #include <openssl/bn.h>
 
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "xmalloc.h"
 #include "log.h"
+#include "atomicio.h"
 
 /*
  * File output defines
@@ -138,6 +145,40 @@
 /* Minimum number of primality tests to perform */
 #define TRIAL_MINIMUM	(4)
 
+/*
+ * Parallelism defines
+ */
+
+/* Upper bound on worker processes for sieving and screening */
+#define WORKERS_MAXIMUM	(64)
+
+/*
+ * Screening results are written in input order; this bounds how far
+ * ahead of the oldest unfinished candidate the workers may run.
+ */
+#define QWINDOW		(1024)
+
+/* Seconds between checkpoint updates while screening */
+#define CHECKPOINT_INTERVAL	(10)
+
+/* Result of screening one candidate line */
+#define QRESULT_SKIP	(0)	/* comment, malformed or unusable generator */
+#define QRESULT_FAIL	(1)	/* tested, not a safe prime */
+#define QRESULT_SAFE	(2)	/* safe prime found */
+
+struct qresult {
+	int status;
+	u_int32_t tests, tries, size, generator;
+	char *modulus;		/* hex, only for QRESULT_SAFE */
+};
+
+/* Per-process screening state */
+struct qtest {
+	BIGNUM *p, *q;
+	BN_CTX *ctx;
+	u_int32_t trials, generator_wanted;
+};
+
 /*
  * Sieving data (XXX - move to struct)
  */
@@ -153,8 +194,24 @@ static u_int32_t *LargeSieve, largewords, largetries, largenumbers;
 static u_int32_t largebits, largememory;	/* megabytes */
 static BIGNUM *largebase;
 
-int gen_candidates(FILE *, u_int32_t, u_int32_t, BIGNUM *);
-int prime_test(FILE *, FILE *, u_int32_t, u_int32_t);
+int gen_candidates(FILE *, u_int32_t, u_int32_t, BIGNUM *, u_int32_t);
+int prime_test(FILE *, FILE *, u_int32_t, u_int32_t, u_int32_t, char *);
+
+/*
+ * Number of worker processes to use when none was requested: one per
+ * online processor.
+ */
+static u_int32_t
+default_workers(void)
+{
+	long n = 1;
+
+#ifdef _SC_NPROCESSORS_ONLN
+	if ((n = sysconf(_SC_NPROCESSORS_ONLN)) < 1)
+		n = 1;
+#endif
+	return (n > WORKERS_MAXIMUM ? WORKERS_MAXIMUM : (u_int32_t)n);
+}
 
 /*
  * print moduli out in consistent form,
@@ -244,16 +301,160 @@ sieve_large(u_int32_t s)
 	}
 }
 
+/*
+ * Sieve this worker's share of the small primes into LargeSieve: every
+ * nworkers'th tiny prime and every nworkers'th 2**16 block of the small
+ * prime range.  Splitting the primes rather than the LargeSieve bitmap
+ * means each BN_mod_word() against largebase is done exactly once.
+ */
+static void
+sieve_share(u_int32_t worker, u_int32_t nworkers)
+{
+	u_int32_t i, n, r, s, t;
+	u_int32_t smallwords = TINY_NUMBER >> 6;
+
+	for (i = n = 0; i < tinybits; i++) {
+		if (BIT_TEST(TinySieve, i))
+			continue; /* 2*i+3 is composite */
+		if (n++ % nworkers == worker)
+			sieve_large(2 * i + 3);
+	}
+
+	/*
+	 * Start the small block search at the next possible prime. To avoid
+	 * fencepost errors, the last pass is skipped.
+	 */
+	for (smallbase = TINY_NUMBER + 3, n = 0;
+	    smallbase < (SMALL_MAXIMUM - TINY_NUMBER);
+	    smallbase += TINY_NUMBER, n++) {
+		if (n % nworkers != worker)
+			continue;
+		for (i = 0; i < tinybits; i++) {
+			if (BIT_TEST(TinySieve, i))
+				continue; /* 2*i+3 is composite */
+
+			/* The next tiny prime */
+			t = 2 * i + 3;
+			r = smallbase % t;
+
+			if (r == 0) {
+				s = 0; /* t divides into smallbase exactly */
+			} else {
+				/* smallbase+s is first entry divisible by t */
+				s = t - r;
+			}
+
+			/*
+			 * The sieve omits even numbers, so ensure that
+			 * smallbase+s is odd. Then, step through the sieve
+			 * in increments of 2*t
+			 */
+			if (s & 1)
+				s += t; /* Make smallbase+s odd, and s even */
+
+			/* Mark all multiples of 2*t */
+			for (s /= 2; s < smallbits; s += t)
+				BIT_SET(SmallSieve, s);
+		}
+
+		/*
+		 * SmallSieve
+		 */
+		for (i = 0; i < smallbits; i++) {
+			if (BIT_TEST(SmallSieve, i))
+				continue; /* 2*i+smallbase is composite */
+
+			/* The next small prime */
+			sieve_large((2 * i) + smallbase);
+		}
+
+		memset(SmallSieve, 0, smallwords << SHIFT_BYTE);
+	}
+}
+
+/*
+ * Run sieve_share() in nworkers processes.  Each child marks its own
+ * copy of LargeSieve and sends it back over a pipe; the parent sieves
+ * share 0 itself and ORs the children's bitmaps into its own.
+ */
+static int
+sieve_parallel(u_int32_t nworkers)
+{
+	pid_t *pids;
+	int *fds, pfd[2], status, ret = 0;
+	u_int32_t *chunk, i, n, off, tries, w;
+	size_t len;
+
+	pids = xcalloc(nworkers, sizeof(*pids));
+	fds = xcalloc(nworkers, sizeof(*fds));
+	for (w = 1; w < nworkers; w++) {
+		if (pipe(pfd) == -1)
+			fatal("%s: pipe: %s", __func__, strerror(errno));
+		if ((pids[w] = fork()) == -1)
+			fatal("%s: fork: %s", __func__, strerror(errno));
+		if (pids[w] == 0) {
+			close(pfd[0]);
+			for (i = 1; i < w; i++)
+				close(fds[i]);
+			sieve_share(w, nworkers);
+			len = (size_t)largewords << SHIFT_BYTE;
+			if (atomicio(vwrite, pfd[1], &largetries,
+			    sizeof(largetries)) != sizeof(largetries) ||
+			    atomicio(vwrite, pfd[1], LargeSieve, len) != len)
+				_exit(1);
+			_exit(0);
+		}
+		close(pfd[1]);
+		fds[w] = pfd[0];
+	}
+
+	sieve_share(0, nworkers);
+
+	chunk = xcalloc(TINY_NUMBER, sizeof(u_int32_t));
+	for (w = 1; w < nworkers; w++) {
+		if (ret == 0 && atomicio(read, fds[w], &tries,
+		    sizeof(tries)) == sizeof(tries)) {
+			largetries += tries;
+			for (off = 0; off < largewords; off += n) {
+				n = MIN(largewords - off, TINY_NUMBER);
+				len = (size_t)n << SHIFT_BYTE;
+				if (atomicio(read, fds[w], chunk, len) != len) {
+					ret = -1;
+					break;
+				}
+				for (i = 0; i < n; i++)
+					LargeSieve[off + i] |= chunk[i];
+			}
+		} else
+			ret = -1;
+		close(fds[w]);
+		while (waitpid(pids[w], &status, 0) == -1)
+			if (errno != EINTR)
+				fatal("%s: waitpid: %s", __func__,
+				    strerror(errno));
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			error("Sieve worker %u failed", w);
+			ret = -1;
+		}
+	}
+	xfree(chunk);
+	xfree(fds);
+	xfree(pids);
+
+	return (ret);
+}
+
 /*
  * list candidates for Sophie-Germain primes (where q = (p-1)/2)
  * to standard output.
  * The list is checked against small known primes (less than 2**30).
  */
 int
-gen_candidates(FILE *out, u_int32_t memory, u_int32_t power, BIGNUM *start)
+gen_candidates(FILE *out, u_int32_t memory, u_int32_t power, BIGNUM *start,
+    u_int32_t nworkers)
 {
 	BIGNUM *q;
-	u_int32_t j, r, s, t;
+	u_int32_t j, r, t;
 	u_int32_t smallwords = TINY_NUMBER >> 6;
 	u_int32_t tinywords = TINY_NUMBER >> 6;
 	time_t time_start, time_stop;
@@ -262,6 +463,11 @@ gen_candidates(FILE *out, u_int32_t memory, u_int32_t power, BIGNUM *start)
 
 	largememory = memory;
 
+	if (nworkers == 0)
+		nworkers = default_workers();
+	else if (nworkers > WORKERS_MAXIMUM)
+		nworkers = WORKERS_MAXIMUM;
+
 	if (memory != 0 &&
 	    (memory < LARGE_MINIMUM || memory > LARGE_MAXIMUM)) {
 		error("Invalid memory amount (min %ld, max %ld)",
@@ -367,57 +573,22 @@ gen_candidates(FILE *out, u_int32_t memory, u_int32_t power, BIGNUM *start)
 		/* Mark all multiples of t */
 		for (j = i + t; j < tinybits; j += t)
 			BIT_SET(TinySieve, j);
-
-		sieve_large(t);
 	}
 
-	/*
-	 * Start the small block search at the next possible prime. To avoid
-	 * fencepost errors, the last pass is skipped.
-	 */
-	for (smallbase = TINY_NUMBER + 3;
-	    smallbase < (SMALL_MAXIMUM - TINY_NUMBER);
-	    smallbase += TINY_NUMBER) {
-		for (i = 0; i < tinybits; i++) {
-			if (BIT_TEST(TinySieve, i))
-				continue; /* 2*i+3 is composite */
-
-			/* The next tiny prime */
-			t = 2 * i + 3;
-			r = smallbase % t;
-
-			if (r == 0) {
-				s = 0; /* t divides into smallbase exactly */
-			} else {
-				/* smallbase+s is first entry divisible by t */
-				s = t - r;
-			}
-
-			/*
-			 * The sieve omits even numbers, so ensure that
-			 * smallbase+s is odd. Then, step through the sieve
-			 * in increments of 2*t
-			 */
-			if (s & 1)
-				s += t; /* Make smallbase+s odd, and s even */
-
-			/* Mark all multiples of 2*t */
-			for (s /= 2; s < smallbits; s += t)
-				BIT_SET(SmallSieve, s);
-		}
-
-		/*
-		 * SmallSieve
-		 */
-		for (i = 0; i < smallbits; i++) {
-			if (BIT_TEST(SmallSieve, i))
-				continue; /* 2*i+smallbase is composite */
-
-			/* The next small prime */
-			sieve_large((2 * i) + smallbase);
-		}
-
-		memset(SmallSieve, 0, smallwords << SHIFT_BYTE);
+	if (nworkers > 1) {
+		debug("Sieving with %u processes", nworkers);
+		fflush(out);
+		if (sieve_parallel(nworkers) != 0)
+			ret = -1;
+	} else
+		sieve_share(0, 1);
+
+	if (ret != 0) {
+		xfree(LargeSieve);
+		xfree(SmallSieve);
+		xfree(TinySieve);
+		BN_free(q);
+		return (ret);
 	}
 
 	time(&time_stop);
@@ -454,210 +625,511 @@ gen_candidates(FILE *out, u_int32_t memory, u_int32_t power, BIGNUM *start)
 	return (ret);
 }
 
+static void
+write_checkpoint(char *cpfile, u_int32_t lineno)
+{
+	FILE *fp;
+	char tmp[MAXPATHLEN];
+	int fd, r;
+
+	r = snprintf(tmp, sizeof(tmp), "%s.XXXXXXXXXX", cpfile);
+	if (r == -1 || r >= (int)sizeof(tmp)) {
+		logit("write_checkpoint: temp pathname too long");
+		return;
+	}
+	if ((fd = mkstemp(tmp)) == -1) {
+		logit("mkstemp(%s): %s", tmp, strerror(errno));
+		return;
+	}
+	if ((fp = fdopen(fd, "w")) == NULL) {
+		logit("write_checkpoint: fdopen: %s", strerror(errno));
+		close(fd);
+		unlink(tmp);
+		return;
+	}
+	if (fprintf(fp, "%u\n", lineno) > 0 && fclose(fp) == 0 &&
+	    rename(tmp, cpfile) == 0) {
+		debug3("wrote checkpoint line %u to '%s'", lineno, cpfile);
+	} else {
+		logit("failed to write to checkpoint file '%s': %s", cpfile,
+		    strerror(errno));
+		unlink(tmp);
+	}
+}
+
+static u_int32_t
+read_checkpoint(char *cpfile)
+{
+	FILE *fp;
+	u_int32_t lineno = 0;
+
+	if ((fp = fopen(cpfile, "r")) == NULL)
+		return (0);
+	if (fscanf(fp, "%u\n", &lineno) < 1)
+		logit("Failed to load checkpoint from '%s'", cpfile);
+	else
+		logit("Loaded checkpoint from '%s' line %u", cpfile, lineno);
+	fclose(fp);
+	return (lineno);
+}
+
+/*
+ * Screen a single candidate line.  The (1/4)^N performance bound on
+ * Miller-Rabin is extremely pessimistic, so don't spend a lot of time
+ * really verifying that q is prime until after we know that p is also
+ * prime.
+ */
+static void
+prime_test_line(struct qtest *qt, char *lp, u_int32_t count_in,
+    struct qresult *qr)
+{
+	BIGNUM *a, *p = qt->p, *q = qt->q;
+	char *cp;
+	u_int32_t generator_known, in_tests, in_tries, in_type, in_size;
+
+	memset(qr, 0, sizeof(*qr));
+	qr->status = QRESULT_SKIP;
+
+	if (strlen(lp) < 14 || *lp == '!' || *lp == '#') {
+		debug2("%10u: comment or short line", count_in);
+		return;
+	}
+
+	/* XXX - fragile parser */
+	/* time */
+	cp = &lp[14];	/* (skip) */
+
+	/* type */
+	in_type = strtoul(cp, &cp, 10);
+
+	/* tests */
+	in_tests = strtoul(cp, &cp, 10);
+
+	if (in_tests & QTEST_COMPOSITE) {
+		debug2("%10u: known composite", count_in);
+		return;
+	}
+
+	/* tries */
+	in_tries = strtoul(cp, &cp, 10);
+
+	/* size (most significant bit) */
+	in_size = strtoul(cp, &cp, 10);
+
+	/* generator (hex) */
+	generator_known = strtoul(cp, &cp, 16);
+
+	/* Skip white space */
+	cp += strspn(cp, " ");
+
+	/* modulus (hex) */
+	switch (in_type) {
+	case QTYPE_SOPHIE_GERMAIN:
+		debug2("%10u: (%u) Sophie-Germain", count_in, in_type);
+		a = q;
+		if (BN_hex2bn(&a, cp) == 0)
+			fatal("BN_hex2bn failed");
+		/* p = 2*q + 1 */
+		if (BN_lshift(p, q, 1) == 0)
+			fatal("BN_lshift failed");
+		if (BN_add_word(p, 1) == 0)
+			fatal("BN_add_word failed");
+		in_size += 1;
+		generator_known = 0;
+		break;
+	case QTYPE_UNSTRUCTURED:
+	case QTYPE_SAFE:
+	case QTYPE_SCHNORR:
+	case QTYPE_STRONG:
+	case QTYPE_UNKNOWN:
+		debug2("%10u: (%u)", count_in, in_type);
+		a = p;
+		if (BN_hex2bn(&a, cp) == 0)
+			fatal("BN_hex2bn failed");
+		/* q = (p-1) / 2 */
+		if (BN_rshift(q, p, 1) == 0)
+			fatal("BN_rshift failed");
+		break;
+	default:
+		debug2("Unknown prime type");
+		return;
+	}
+
+	/*
+	 * due to earlier inconsistencies in interpretation, check
+	 * the proposed bit size.
+	 */
+	if ((u_int32_t)BN_num_bits(p) != (in_size + 1)) {
+		debug2("%10u: bit size %u mismatch", count_in, in_size);
+		return;
+	}
+	if (in_size < QSIZE_MINIMUM) {
+		debug2("%10u: bit size %u too short", count_in, in_size);
+		return;
+	}
+
+	if (in_tests & QTEST_MILLER_RABIN)
+		in_tries += qt->trials;
+	else
+		in_tries = qt->trials;
+
+	/*
+	 * guess unknown generator
+	 */
+	if (generator_known == 0) {
+		if (BN_mod_word(p, 24) == 11)
+			generator_known = 2;
+		else if (BN_mod_word(p, 12) == 5)
+			generator_known = 3;
+		else {
+			u_int32_t r = BN_mod_word(p, 10);
+
+			if (r == 3 || r == 7)
+				generator_known = 5;
+		}
+	}
+	/*
+	 * skip tests when desired generator doesn't match
+	 */
+	if (qt->generator_wanted > 0 &&
+	    qt->generator_wanted != generator_known) {
+		debug2("%10u: generator %d != %d",
+		    count_in, generator_known, qt->generator_wanted);
+		return;
+	}
+
+	/*
+	 * Primes with no known generator are useless for DH, so
+	 * skip those.
+	 */
+	if (generator_known == 0) {
+		debug2("%10u: no known generator", count_in);
+		return;
+	}
+
+	qr->status = QRESULT_FAIL;
+
+	/*
+	 * A single pass will weed out the vast majority of composite q's.
+	 */
+	if (BN_is_prime(q, 1, NULL, qt->ctx, NULL) <= 0) {
+		debug("%10u: q failed first possible prime test",
+		    count_in);
+		return;
+	}
+
+	/*
+	 * q is possibly prime, so go ahead and really make sure
+	 * that p is prime. If it is, then we can go back and do
+	 * the same for q. If p is composite, chances are that
+	 * will show up on the first Rabin-Miller iteration so it
+	 * doesn't hurt to specify a high iteration count.
+	 */
+	if (!BN_is_prime(p, qt->trials, NULL, qt->ctx, NULL)) {
+		debug("%10u: p is not prime", count_in);
+		return;
+	}
+	debug("%10u: p is almost certainly prime", count_in);
+
+	/* recheck q more rigorously */
+	if (!BN_is_prime(q, qt->trials - 1, NULL, qt->ctx, NULL)) {
+		debug("%10u: q is not prime", count_in);
+		return;
+	}
+	debug("%10u: q is almost certainly prime", count_in);
+
+	qr->status = QRESULT_SAFE;
+	qr->tests = in_tests | QTEST_MILLER_RABIN;
+	qr->tries = in_tries;
+	qr->size = in_size;
+	qr->generator = generator_known;
+	if ((qr->modulus = BN_bn2hex(p)) == NULL)
+		fatal("BN_bn2hex failed");
+}
+
+/*
+ * Screening worker: read "count line" requests from rfd, answer each
+ * with one "status tests tries size generator modulus" line on wfd.
+ */
+static void
+prime_test_worker(struct qtest *qt, int rfd, int wfd)
+{
+	FILE *in, *out;
+	char *lp, *cp;
+	u_int32_t count_in;
+	struct qresult qr;
+
+	if ((in = fdopen(rfd, "r")) == NULL || (out = fdopen(wfd, "w")) == NULL)
+		fatal("%s: fdopen: %s", __func__, strerror(errno));
+	lp = xmalloc(QLINESIZE + 16);
+	while (fgets(lp, QLINESIZE + 16, in) != NULL) {
+		count_in = strtoul(lp, &cp, 10);
+		if (*cp == ' ')
+			cp++;
+		prime_test_line(qt, cp, count_in, &qr);
+		fprintf(out, "%d %u %u %u %u %s\n", qr.status, qr.tests,
+		    qr.tries, qr.size, qr.generator,
+		    qr.modulus == NULL ? "-" : qr.modulus);
+		if (fflush(out) != 0)
+			_exit(1);
+		if (qr.modulus != NULL)
+			OPENSSL_free(qr.modulus);
+	}
+	_exit(0);
+}
+
+/* Write a finished screening result; frees its modulus */
+static int
+prime_test_emit(FILE *out, struct qresult *qr, BIGNUM *p,
+    u_int32_t *count_possible, u_int32_t *count_out)
+{
+	int ret = 0;
+
+	if (qr->status != QRESULT_SKIP)
+		(*count_possible)++;
+	if (qr->status != QRESULT_SAFE)
+		return (0);
+	if (BN_hex2bn(&p, qr->modulus) == 0)
+		fatal("BN_hex2bn failed");
+	if (qfileout(out, QTYPE_SAFE, qr->tests, qr->tries, qr->size,
+	    qr->generator, p))
+		ret = -1;
+	else
+		(*count_out)++;
+	xfree(qr->modulus);
+	qr->modulus = NULL;
+	return (ret);
+}
+
+struct qworker {
+	pid_t pid;
+	int wfd;
+	FILE *rf;
+	u_int32_t count_in;	/* line in progress, 0 when idle */
+};
+
 /*
  * perform a Miller-Rabin primality test
  * on the list of candidates
  * (checking both q and p)
  * The result is a list of so-call "safe" primes
+ *
+ * With nworkers > 1 the candidates are handed to a pool of worker
+ * processes; results are still written in input order.  If cpfile is
+ * set, the number of input lines fully accounted for in the output is
+ * saved there periodically and screening resumes after it.
  */
 int
-prime_test(FILE *in, FILE *out, u_int32_t trials, u_int32_t generator_wanted)
+prime_test(FILE *in, FILE *out, u_int32_t trials, u_int32_t generator_wanted,
+    u_int32_t nworkers, char *cpfile)
 {
-	BIGNUM *q, *p, *a;
-	BN_CTX *ctx;
-	char *cp, *lp;
+	struct qtest qt;
+	struct qresult qr, *window = NULL;
+	struct qworker *workers = NULL;
+	struct pollfd *pfd = NULL;
+	BIGNUM *res_p;
+	char *lp, *cp, *rp;
 	u_int32_t count_in = 0, count_out = 0, count_possible = 0;
-	u_int32_t generator_known, in_tests, in_tries, in_type, in_size;
-	time_t time_start, time_stop;
-	int res;
+	u_int32_t count_done, start_line = 0, nbusy, w, n, i;
+	time_t time_start, time_stop, time_checkpoint;
+	int res, eof, rq[2], rs[2];
+	size_t len;
 
 	if (trials < TRIAL_MINIMUM) {
 		error("Minimum primality trials is %d", TRIAL_MINIMUM);
 		return (-1);
 	}
+	if (nworkers == 0)
+		nworkers = default_workers();
+	else if (nworkers > WORKERS_MAXIMUM)
+		nworkers = WORKERS_MAXIMUM;
 
 	time(&time_start);
+	time_checkpoint = time_start;
 
-	if ((p = BN_new()) == NULL)
+	memset(&qt, 0, sizeof(qt));
+	qt.trials = trials;
+	qt.generator_wanted = generator_wanted;
+	if ((qt.p = BN_new()) == NULL)
 		fatal("BN_new failed");
-	if ((q = BN_new()) == NULL)
+	if ((qt.q = BN_new()) == NULL)
 		fatal("BN_new failed");
-	if ((ctx = BN_CTX_new()) == NULL)
+	if ((qt.ctx = BN_CTX_new()) == NULL)
 		fatal("BN_CTX_new failed");
+	if ((res_p = BN_new()) == NULL)
+		fatal("BN_new failed");
 
 	debug2("%.24s Final %u Miller-Rabin trials (%x generator)",
 	    ctime(&time_start), trials, generator_wanted);
 
 	res = 0;
 	lp = xmalloc(QLINESIZE + 1);
-	while (fgets(lp, QLINESIZE + 1, in) != NULL) {
-		count_in++;
-		if (strlen(lp) < 14 || *lp == '!' || *lp == '#') {
-			debug2("%10u: comment or short line", count_in);
-			continue;
-		}
-
-		/* XXX - fragile parser */
-		/* time */
-		cp = &lp[14];	/* (skip) */
-
-		/* type */
-		in_type = strtoul(cp, &cp, 10);
-
-		/* tests */
-		in_tests = strtoul(cp, &cp, 10);
-
-		if (in_tests & QTEST_COMPOSITE) {
-			debug2("%10u: known composite", count_in);
-			continue;
-		}
-
-		/* tries */
-		in_tries = strtoul(cp, &cp, 10);
-
-		/* size (most significant bit) */
-		in_size = strtoul(cp, &cp, 10);
-
-		/* generator (hex) */
-		generator_known = strtoul(cp, &cp, 16);
-
-		/* Skip white space */
-		cp += strspn(cp, " ");
-
-		/* modulus (hex) */
-		switch (in_type) {
-		case QTYPE_SOPHIE_GERMAIN:
-			debug2("%10u: (%u) Sophie-Germain", count_in, in_type);
-			a = q;
-			if (BN_hex2bn(&a, cp) == 0)
-				fatal("BN_hex2bn failed");
-			/* p = 2*q + 1 */
-			if (BN_lshift(p, q, 1) == 0)
-				fatal("BN_lshift failed");
-			if (BN_add_word(p, 1) == 0)
-				fatal("BN_add_word failed");
-			in_size += 1;
-			generator_known = 0;
-			break;
-		case QTYPE_UNSTRUCTURED:
-		case QTYPE_SAFE:
-		case QTYPE_SCHNORR:
-		case QTYPE_STRONG:
-		case QTYPE_UNKNOWN:
-			debug2("%10u: (%u)", count_in, in_type);
-			a = p;
-			if (BN_hex2bn(&a, cp) == 0)
-				fatal("BN_hex2bn failed");
-			/* q = (p-1) / 2 */
-			if (BN_rshift(q, p, 1) == 0)
-				fatal("BN_rshift failed");
-			break;
-		default:
-			debug2("Unknown prime type");
-			break;
-		}
-
-		/*
-		 * due to earlier inconsistencies in interpretation, check
-		 * the proposed bit size.
-		 */
-		if ((u_int32_t)BN_num_bits(p) != (in_size + 1)) {
-			debug2("%10u: bit size %u mismatch", count_in, in_size);
-			continue;
-		}
-		if (in_size < QSIZE_MINIMUM) {
-			debug2("%10u: bit size %u too short", count_in, in_size);
-			continue;
-		}
 
-		if (in_tests & QTEST_MILLER_RABIN)
-			in_tries += trials;
-		else
-			in_tries = trials;
-
-		/*
-		 * guess unknown generator
-		 */
-		if (generator_known == 0) {
-			if (BN_mod_word(p, 24) == 11)
-				generator_known = 2;
-			else if (BN_mod_word(p, 12) == 5)
-				generator_known = 3;
-			else {
-				u_int32_t r = BN_mod_word(p, 10);
-
-				if (r == 3 || r == 7)
-					generator_known = 5;
+	if (cpfile != NULL)
+		start_line = read_checkpoint(cpfile);
+	while (count_in < start_line && fgets(lp, QLINESIZE + 1, in) != NULL)
+		count_in++;
+	if (start_line > 0 && count_in == start_line)
+		logit("Resuming screening after line %u", start_line);
+	count_done = count_in;
+
+	if (nworkers == 1) {
+		while (fgets(lp, QLINESIZE + 1, in) != NULL) {
+			count_in++;
+			prime_test_line(&qt, lp, count_in, &qr);
+			if (qr.status == QRESULT_SAFE) {
+				/* prime_test_emit wants an xmalloc'd copy */
+				cp = xstrdup(qr.modulus);
+				OPENSSL_free(qr.modulus);
+				qr.modulus = cp;
+			}
+			if (prime_test_emit(out, &qr, res_p,
+			    &count_possible, &count_out) != 0) {
+				res = -1;
+				break;
+			}
+			count_done = count_in;
+			if (cpfile != NULL && (qr.status == QRESULT_SAFE ||
+			    time(NULL) - time_checkpoint >=
+			    CHECKPOINT_INTERVAL)) {
+				write_checkpoint(cpfile, count_done);
+				time_checkpoint = time(NULL);
 			}
 		}
-		/*
-		 * skip tests when desired generator doesn't match
-		 */
-		if (generator_wanted > 0 &&
-		    generator_wanted != generator_known) {
-			debug2("%10u: generator %d != %d",
-			    count_in, generator_known, generator_wanted);
-			continue;
-		}
+		goto done;
+	}
 
-		/*
-		 * Primes with no known generator are useless for DH, so
-		 * skip those.
-		 */
-		if (generator_known == 0) {
-			debug2("%10u: no known generator", count_in);
-			continue;
+	debug("Screening with %u processes", nworkers);
+	signal(SIGPIPE, SIG_IGN);
+	fflush(out);
+	workers = xcalloc(nworkers, sizeof(*workers));
+	pfd = xcalloc(nworkers, sizeof(*pfd));
+	window = xcalloc(QWINDOW, sizeof(*window));
+	for (w = 0; w < nworkers; w++) {
+		if (pipe(rq) == -1 || pipe(rs) == -1)
+			fatal("%s: pipe: %s", __func__, strerror(errno));
+		if ((workers[w].pid = fork()) == -1)
+			fatal("%s: fork: %s", __func__, strerror(errno));
+		if (workers[w].pid == 0) {
+			for (i = 0; i < w; i++) {
+				close(workers[i].wfd);
+				fclose(workers[i].rf);
+			}
+			close(rq[1]);
+			close(rs[0]);
+			prime_test_worker(&qt, rq[0], rs[1]);
 		}
+		close(rq[0]);
+		close(rs[1]);
+		workers[w].wfd = rq[1];
+		if ((workers[w].rf = fdopen(rs[0], "r")) == NULL)
+			fatal("%s: fdopen: %s", __func__, strerror(errno));
+	}
 
-		count_possible++;
-
-		/*
-		 * The (1/4)^N performance bound on Miller-Rabin is
-		 * extremely pessimistic, so don't spend a lot of time
-		 * really verifying that q is prime until after we know
-		 * that p is also prime. A single pass will weed out the
-		 * vast majority of composite q's.
-		 */
-		if (BN_is_prime(q, 1, NULL, ctx, NULL) <= 0) {
-			debug("%10u: q failed first possible prime test",
-			    count_in);
-			continue;
+	rp = xmalloc(QLINESIZE + 64);
+	for (eof = 0;;) {
+		/* hand out lines to idle workers, staying inside the window */
+		for (w = 0, nbusy = 0; w < nworkers; w++) {
+			if (workers[w].count_in == 0 && !eof && res == 0 &&
+			    count_in - count_done < QWINDOW) {
+				if (fgets(lp, QLINESIZE + 1, in) == NULL) {
+					eof = 1;
+				} else {
+					count_in++;
+					window[count_in % QWINDOW].status = -1;
+					len = strlen(lp);
+					cp = xmalloc(len + 16);
+					n = snprintf(cp, len + 16, "%u %s%s",
+					    count_in, lp, (len > 0 &&
+					    lp[len - 1] == '\n') ? "" : "\n");
+					if (atomicio(vwrite, workers[w].wfd,
+					    cp, n) != n)
+						fatal("%s: write to worker: %s",
+						    __func__, strerror(errno));
+					xfree(cp);
+					workers[w].count_in = count_in;
+				}
+			}
+			pfd[w].fd = fileno(workers[w].rf);
+			pfd[w].events = workers[w].count_in != 0 ? POLLIN : 0;
+			if (workers[w].count_in != 0)
+				nbusy++;
 		}
+		if (nbusy == 0)
+			break;
 
-		/*
-		 * q is possibly prime, so go ahead and really make sure
-		 * that p is prime. If it is, then we can go back and do
-		 * the same for q. If p is composite, chances are that
-		 * will show up on the first Rabin-Miller iteration so it
-		 * doesn't hurt to specify a high iteration count.
-		 */
-		if (!BN_is_prime(p, trials, NULL, ctx, NULL)) {
-			debug("%10u: p is not prime", count_in);
-			continue;
+		if (poll(pfd, nworkers, -1) == -1) {
+			if (errno == EINTR)
+				continue;
+			fatal("%s: poll: %s", __func__, strerror(errno));
 		}
-		debug("%10u: p is almost certainly prime", count_in);
-
-		/* recheck q more rigorously */
-		if (!BN_is_prime(q, trials - 1, NULL, ctx, NULL)) {
-			debug("%10u: q is not prime", count_in);
-			continue;
+		for (w = 0; w < nworkers; w++) {
+			if (workers[w].count_in == 0 ||
+			    (pfd[w].revents & (POLLIN|POLLHUP|POLLERR)) == 0)
+				continue;
+			if (fgets(rp, QLINESIZE + 64, workers[w].rf) == NULL)
+				fatal("%s: screening worker %ld exited",
+				    __func__, (long)workers[w].pid);
+			memset(&qr, 0, sizeof(qr));
+			qr.status = strtol(rp, &cp, 10);
+			qr.tests = strtoul(cp, &cp, 10);
+			qr.tries = strtoul(cp, &cp, 10);
+			qr.size = strtoul(cp, &cp, 10);
+			qr.generator = strtoul(cp, &cp, 10);
+			cp += strspn(cp, " ");
+			cp[strcspn(cp, "\n")] = '\0';
+			if (qr.status == QRESULT_SAFE)
+				qr.modulus = xstrdup(cp);
+			window[workers[w].count_in % QWINDOW] = qr;
+			workers[w].count_in = 0;
 		}
-		debug("%10u: q is almost certainly prime", count_in);
 
-		if (qfileout(out, QTYPE_SAFE, (in_tests | QTEST_MILLER_RABIN),
-		    in_tries, in_size, generator_known, p)) {
-			res = -1;
-			break;
+		/* write out everything that is now complete, in order */
+		while (res == 0 && count_done < count_in &&
+		    window[(count_done + 1) % QWINDOW].status != -1) {
+			qr = window[(count_done + 1) % QWINDOW];
+			if (prime_test_emit(out, &qr, res_p,
+			    &count_possible, &count_out) != 0) {
+				res = -1;
+				break;
+			}
+			count_done++;
+			if (cpfile != NULL &&
+			    (qr.status == QRESULT_SAFE ||
+			    time(NULL) - time_checkpoint >=
+			    CHECKPOINT_INTERVAL)) {
+				write_checkpoint(cpfile, count_done);
+				time_checkpoint = time(NULL);
+			}
 		}
-
-		count_out++;
 	}
+	xfree(rp);
+
+	for (w = 0; w < nworkers; w++) {
+		close(workers[w].wfd);
+		fclose(workers[w].rf);
+		while (waitpid(workers[w].pid, NULL, 0) == -1 &&
+		    errno == EINTR)
+			;
+	}
+	xfree(window);
+	xfree(pfd);
+	xfree(workers);
 
+ done:
 	time(&time_stop);
 	xfree(lp);
-	BN_free(p);
-	BN_free(q);
-	BN_CTX_free(ctx);
+	BN_free(qt.p);
+	BN_free(qt.q);
+	BN_free(res_p);
+	BN_CTX_free(qt.ctx);
+
+	if (cpfile != NULL) {
+		if (res == 0)
+			unlink(cpfile);
+		else
+			write_checkpoint(cpfile, count_done);
+	}
 
 	logit("%.24s Found %u safe primes of %u candidates in %ld seconds",
 	    ctime(&time_stop), count_out, count_possible,
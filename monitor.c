@@ -68,6 +68,7 @@
 #include "zlib.h"
 #endif
 #include "packet.h"
+#include "compress.h"
 #include "auth-options.h"
 #include "sshpty.h"
 #include "channels.h"
@@ -124,6 +125,8 @@ struct {
 	u_int ilen;
 	u_char *output;
 	u_int olen;
+	u_char *comp;
+	u_int complen;
 } child_state;
 
 /* Functions on the monitor that answer unprivileged requests */
@@ -568,7 +571,8 @@ mm_answer_sign(int sock, Buffer *m)
 	 * Supported KEX types will only return SHA1 (20 byte) or
 	 * SHA256 (32 byte) hashes
 	 */
-	if (datlen != 20 && datlen != 32)
+	/* SHA1, SHA256, SHA384 and SHA512 exchange hashes */
+	if (datlen != 20 && datlen != 32 && datlen != 48 && datlen != 64)
 		fatal("%s: data length incorrect: %u", __func__, datlen);
 
 	/* save session id, it will be passed on the first call */
@@ -1601,6 +1605,8 @@ mm_answer_audit_command(int socket, Buffer *m)
 void
 monitor_apply_keystate(struct monitor *pmonitor)
 {
+	Buffer comp;
+
 	if (compat20) {
 		set_newkeys(MODE_IN);
 		set_newkeys(MODE_OUT);
@@ -1628,6 +1634,11 @@ monitor_apply_keystate(struct monitor *pmonitor)
 	    sizeof(incoming_stream));
 	memcpy(&outgoing_stream, &child_state.outgoing,
 	    sizeof(outgoing_stream));
+	buffer_init(&comp);
+	buffer_append(&comp, child_state.comp, child_state.complen);
+	buffer_compress_get_state(&comp);
+	buffer_free(&comp);
+	xfree(child_state.comp);
 
 	/* Update with new address */
 	if (options.compression)
@@ -1664,6 +1675,10 @@ mm_get_kex(Buffer *m)
 	kex->kex[KEX_DH_GRP14_SHA1] = kexdh_server;
 	kex->kex[KEX_DH_GEX_SHA1] = kexgex_server;
 	kex->kex[KEX_DH_GEX_SHA256] = kexgex_server;
+	kex->kex[KEX_C25519_SHA256] = kexc25519_server;
+#ifdef OPENSSL_HAS_ECC
+	kex->kex[KEX_ECDH_SHA2] = kexecdh_server;
+#endif
 	kex->server = 1;
 	kex->hostkey_type = buffer_get_int(m);
 	kex->kex_type = buffer_get_int(m);
@@ -1751,6 +1766,7 @@ mm_get_keystate(struct monitor *pmonitor)
 		fatal("%s: bad request size", __func__);
 	memcpy(&child_state.incoming, p, sizeof(child_state.incoming));
 	xfree(p);
+	child_state.comp = buffer_get_string(&m, &child_state.complen);
 
 	/* Network I/O buffers */
 	debug3("%s: Getting Network I/O buffers", __func__);
@@ -61,6 +61,7 @@
 #else
 #include "zlib.h"
 #endif
+#include "compress.h"
 #include "monitor.h"
 #ifdef GSSAPI
 #include "ssh-gss.h"
@@ -567,7 +568,7 @@ mm_send_kex(Buffer *m, Kex *kex)
 void
 mm_send_keystate(struct monitor *monitor)
 {
-	Buffer m;
+	Buffer m, comp;
 	u_char *blob, *p;
 	u_int bloblen, plen;
 	u_int32_t seqnr, packets;
@@ -648,6 +649,10 @@ mm_send_keystate(struct monitor *monitor)
 	debug3("%s: Sending compression state", __func__);
 	buffer_put_string(&m, &outgoing_stream, sizeof(outgoing_stream));
 	buffer_put_string(&m, &incoming_stream, sizeof(incoming_stream));
+	buffer_init(&comp);
+	buffer_compress_put_state(&comp);
+	buffer_put_string(&m, buffer_ptr(&comp), buffer_len(&comp));
+	buffer_free(&comp);
 
 	/* Network I/O buffers */
 	buffer_put_string(&m, buffer_ptr(&input), buffer_len(&input));
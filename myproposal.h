@@ -33,14 +33,36 @@
 	"diffie-hellman-group14-sha1," \
 	"diffie-hellman-group1-sha1"
 #else
+# ifdef OPENSSL_HAS_ECC
+#  define KEX_ECDH_KEX		\
+	"ecdh-sha2-nistp256," \
+	"ecdh-sha2-nistp384," \
+	"ecdh-sha2-nistp521,"
+# else
+#  define KEX_ECDH_KEX		""
+# endif
 # define KEX_DEFAULT_KEX		\
+	"curve25519-sha256," \
+	"curve25519-sha256@libssh.org," \
+	KEX_ECDH_KEX \
 	"diffie-hellman-group-exchange-sha256," \
 	"diffie-hellman-group-exchange-sha1," \
 	"diffie-hellman-group14-sha1," \
 	"diffie-hellman-group1-sha1"
 #endif
 
-#define	KEX_DEFAULT_PK_ALG	"ssh-rsa,ssh-dss"
+#ifdef OPENSSL_HAS_ECC
+# define KEX_ECDSA_PK_ALG	\
+	"ecdsa-sha2-nistp256," \
+	"ecdsa-sha2-nistp384," \
+	"ecdsa-sha2-nistp521,"
+#else
+# define KEX_ECDSA_PK_ALG	""
+#endif
+#define	KEX_DEFAULT_PK_ALG	\
+	KEX_ECDSA_PK_ALG \
+	"ssh-ed25519," \
+	"ssh-rsa,ssh-dss"
 #define	KEX_DEFAULT_ENCRYPT \
 	"aes128-cbc,3des-cbc,blowfish-cbc,cast128-cbc," \
 	"arcfour128,arcfour256,arcfour," \
@@ -50,7 +72,22 @@
 	"hmac-md5,hmac-sha1,umac-64@openssh.com,hmac-ripemd160," \
 	"hmac-ripemd160@openssh.com," \
 	"hmac-sha1-96,hmac-md5-96"
-#define	KEX_DEFAULT_COMP	"none,zlib@openssh.com,zlib"
+/*
+ * Algorithms that may be proposed by "Ciphers auto-fast" and "MACs auto-fast";
+ * the client reorders these by measured local throughput.  Each is also in
+ * the default proposal; CBC modes and hmac-md5 are left out so that a fast
+ * measurement can never put them first.
+ */
+#define	KEX_AUTOFAST_ENCRYPT \
+	"aes128-ctr,aes192-ctr,aes256-ctr"
+#define	KEX_AUTOFAST_MAC \
+	"hmac-sha1,umac-64@openssh.com,hmac-ripemd160"
+#ifdef WITH_ZSTD
+# define KEX_ZSTD_COMP		"zstd@openssh.com,"
+#else
+# define KEX_ZSTD_COMP		""
+#endif
+#define	KEX_DEFAULT_COMP	"none," KEX_ZSTD_COMP "zlib@openssh.com,zlib"
 #define	KEX_DEFAULT_LANG	""
 
 
@@ -1,5 +1,8 @@
 /*
  * Copyright (c) 1999,2000,2004 Damien Miller <djm@mindrot.org>
+ * Copyright (c) 1996, David Mazieres <dm@uun.org>
+ * Copyright (c) 2008, Damien Miller <djm@openbsd.org>
+ * Copyright (c) 2013, Markus Friedl <markus@openbsd.org>
  *
  * Permission to use, copy, modify, and distribute this software for any
  * purpose with or without fee is hereby granted, provided that the above
@@ -14,71 +17,224 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+/*
+ * ChaCha based random number generator for OpenBSD, adapted for portable
+ * OpenSSH.  Keystream is generated a buffer at a time so that callers such
+ * as the packet layer can take a whole packet's worth of padding in one
+ * arc4random_buf() call.  The generator is rekeyed from its own output after
+ * every buffer (for backtracking resistance) and reseeded from the kernel
+ * every REKEY_BYTES.
+ */
+
 #include "includes.h"
 
 #include <sys/types.h>
 
+#include <errno.h>
 #include <string.h>
 #include <stdarg.h>
+#ifdef HAVE_SYS_RANDOM_H
+# include <sys/random.h>
+#endif
 
 #include "log.h"
 
 #ifndef HAVE_ARC4RANDOM
 
 #include <openssl/rand.h>
-#include <openssl/rc4.h>
 #include <openssl/err.h>
 
-/* Size of key to use */
-#define SEED_SIZE 20
+#define KEYSTREAM_ONLY
+#include "chacha_private.h"
+
+#define KEYSZ	32
+#define IVSZ	8
+#define BLOCKSZ	64
+#define RSBUFSZ	(16*BLOCKSZ)
 
 /* Number of bytes to reseed after */
 #define REKEY_BYTES	(1 << 24)
 
-static int rc4_ready = 0;
-static RC4_KEY rc4;
+static int rs_initialized;
+static chacha_ctx rs;		/* chacha context for random keystream */
+static u_char rs_buf[RSBUFSZ];	/* keystream blocks */
+static size_t rs_have;		/* valid bytes at end of rs_buf */
+static size_t rs_count;		/* bytes till reseed */
 
-unsigned int
-arc4random(void)
+static void _rs_rekey(u_char *, size_t);
+
+static void
+_rs_init(u_char *buf, size_t n)
+{
+	if (n < KEYSZ + IVSZ)
+		return;
+	chacha_keysetup(&rs, buf, KEYSZ * 8, 0);
+	chacha_ivsetup(&rs, buf + KEYSZ);
+}
+
+/* Fill 'buf' with seed material from the kernel, or OpenSSL as fallback */
+static void
+_rs_seed(u_char *buf, size_t n)
 {
-	unsigned int r = 0;
 	static int first_time = 1;
+#ifdef HAVE_GETRANDOM
+	ssize_t r;
+	size_t o = 0;
+
+	while (o < n) {
+		if ((r = getrandom(buf + o, n - o, 0)) == -1) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		o += r;
+	}
+	if (o == n)
+		return;
+	/* Kernel lacks the syscall; fall back to OpenSSL's PRNG */
+#endif
+	if (first_time)
+		seed_rng();
+	first_time = 0;
+	if (RAND_bytes(buf, n) <= 0)
+		fatal("Couldn't obtain random bytes (error %ld)",
+		    ERR_get_error());
+}
 
-	if (rc4_ready <= 0) {
-		if (first_time)
-			seed_rng();
-		first_time = 0;
-		arc4random_stir();
+static void
+_rs_stir(void)
+{
+	u_char rnd[KEYSZ + IVSZ];
+
+	_rs_seed(rnd, sizeof(rnd));
+	if (!rs_initialized) {
+		rs_initialized = 1;
+		_rs_init(rnd, sizeof(rnd));
+	} else
+		_rs_rekey(rnd, sizeof(rnd));
+	memset(rnd, 0, sizeof(rnd));
+
+	/* invalidate rs_buf */
+	rs_have = 0;
+	memset(rs_buf, 0, RSBUFSZ);
+
+	rs_count = REKEY_BYTES;
+}
+
+static void
+_rs_stir_if_needed(size_t len)
+{
+	if (!rs_initialized || rs_count <= len)
+		_rs_stir();
+	else
+		rs_count -= len;
+}
+
+static void
+_rs_rekey(u_char *dat, size_t datlen)
+{
+	size_t i, m;
+
+	/* fill rs_buf with the keystream */
+	chacha_encrypt_bytes(&rs, rs_buf, rs_buf, RSBUFSZ);
+	/* mix in optional user provided data */
+	if (dat != NULL) {
+		m = MIN(datlen, KEYSZ + IVSZ);
+		for (i = 0; i < m; i++)
+			rs_buf[i] ^= dat[i];
 	}
+	/* immediately reinit for backtracking resistance */
+	_rs_init(rs_buf, KEYSZ + IVSZ);
+	memset(rs_buf, 0, KEYSZ + IVSZ);
+	rs_have = RSBUFSZ - KEYSZ - IVSZ;
+}
 
-	RC4(&rc4, sizeof(r), (unsigned char *)&r, (unsigned char *)&r);
+static void
+_rs_random_buf(void *_buf, size_t n)
+{
+	u_char *buf = (u_char *)_buf;
+	size_t m;
+
+	_rs_stir_if_needed(n);
+	while (n > 0) {
+		if (rs_have > 0) {
+			m = MIN(n, rs_have);
+			memcpy(buf, rs_buf + RSBUFSZ - rs_have, m);
+			memset(rs_buf + RSBUFSZ - rs_have, 0, m);
+			buf += m;
+			n -= m;
+			rs_have -= m;
+		}
+		if (rs_have == 0)
+			_rs_rekey(NULL, 0);
+	}
+}
 
-	rc4_ready -= sizeof(r);
-	
-	return(r);
+static void
+_rs_random_u32(u_int32_t *val)
+{
+	_rs_stir_if_needed(sizeof(*val));
+	if (rs_have < sizeof(*val))
+		_rs_rekey(NULL, 0);
+	memcpy(val, rs_buf + RSBUFSZ - rs_have, sizeof(*val));
+	memset(rs_buf + RSBUFSZ - rs_have, 0, sizeof(*val));
+	rs_have -= sizeof(*val);
 }
 
 void
 arc4random_stir(void)
 {
-	unsigned char rand_buf[SEED_SIZE];
-	int i;
-
-	memset(&rc4, 0, sizeof(rc4));
-	if (RAND_bytes(rand_buf, sizeof(rand_buf)) <= 0)
-		fatal("Couldn't obtain random bytes (error %ld)",
-		    ERR_get_error());
-	RC4_set_key(&rc4, sizeof(rand_buf), rand_buf);
+	_rs_stir();
+}
 
-	/*
-	 * Discard early keystream, as per recommendations in:
-	 * http://www.wisdom.weizmann.ac.il/~itsik/RC4/Papers/Rc4_ksa.ps
-	 */
-	for(i = 0; i <= 256; i += sizeof(rand_buf))
-		RC4(&rc4, sizeof(rand_buf), rand_buf, rand_buf);
+unsigned int
+arc4random(void)
+{
+	u_int32_t val;
 
-	memset(rand_buf, 0, sizeof(rand_buf));
+	_rs_random_u32(&val);
+	return val;
+}
 
-	rc4_ready = REKEY_BYTES;
+/*
+ * If we are providing arc4random, then we can provide a more efficient
+ * arc4random_buf().
+ */
+# ifndef HAVE_ARC4RANDOM_BUF
+void
+arc4random_buf(void *buf, size_t n)
+{
+	_rs_random_buf(buf, n);
 }
+# endif /* !HAVE_ARC4RANDOM_BUF */
 #endif /* !HAVE_ARC4RANDOM */
+
+/* arc4random_buf() that uses platform arc4random() */
+#if !defined(HAVE_ARC4RANDOM_BUF) && defined(HAVE_ARC4RANDOM)
+void
+arc4random_buf(void *_buf, size_t n)
+{
+	size_t i;
+	u_int32_t r = 0;
+	char *buf = (char *)_buf;
+
+	for (i = 0; i < n; i++) {
+		if (i % 4 == 0)
+			r = arc4random();
+		buf[i] = r & 0xff;
+		r >>= 8;
+	}
+	i = r = 0;
+}
+#endif /* !defined(HAVE_ARC4RANDOM_BUF) && defined(HAVE_ARC4RANDOM) */
+
+/*
+ * Platform arc4random() implementations that reseed themselves (e.g. glibc)
+ * do not provide arc4random_stir(); callers may still use it after fork.
+ */
+#if defined(HAVE_ARC4RANDOM) && !defined(HAVE_ARC4RANDOM_STIR)
+void
+arc4random_stir(void)
+{
+}
+#endif /* defined(HAVE_ARC4RANDOM) && !defined(HAVE_ARC4RANDOM_STIR) */
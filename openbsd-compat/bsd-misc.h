@@ -23,6 +23,11 @@
 
 char *ssh_get_progname(char *);
 
+/* bsd-sha1.c */
+#define SSH_SHA1_BLOCK	64
+void ssh_sha1_init(u_int32_t *);
+void ssh_sha1_block(u_int32_t *, const u_char *);
+
 #ifndef HAVE_SETSID
 #define setsid() setpgrp(0, getpid())
 #endif /* !HAVE_SETSID */
@@ -0,0 +1,71 @@
+/*
+ * Placed in the public domain.
+ *
+ * The SHA-1 compression function on its own.  OpenSSL only offers the
+ * streaming interface, and its SHA_CTX is not meant to be looked into,
+ * so callers that need a midstate (the precomputed HMAC key blocks in
+ * the known_hosts index) use this instead.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <string.h>
+
+#define ROL(x, n)	(((x) << (n)) | ((x) >> (32 - (n))))
+
+/* Standard SHA-1 initial state */
+void
+ssh_sha1_init(u_int32_t *state)
+{
+	state[0] = 0x67452301;
+	state[1] = 0xefcdab89;
+	state[2] = 0x98badcfe;
+	state[3] = 0x10325476;
+	state[4] = 0xc3d2e1f0;
+}
+
+/* Mixes one SSH_SHA1_BLOCK byte block into 'state' */
+void
+ssh_sha1_block(u_int32_t *state, const u_char *block)
+{
+	u_int32_t a, b, c, d, e, t, w[80];
+	u_int i;
+
+	for (i = 0; i < 16; i++)
+		w[i] = (u_int32_t)block[4 * i] << 24 |
+		    (u_int32_t)block[4 * i + 1] << 16 |
+		    (u_int32_t)block[4 * i + 2] << 8 |
+		    (u_int32_t)block[4 * i + 3];
+	for (; i < 80; i++)
+		w[i] = ROL(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+	a = state[0];
+	b = state[1];
+	c = state[2];
+	d = state[3];
+	e = state[4];
+	for (i = 0; i < 80; i++) {
+		if (i < 20)
+			t = ((b & c) | (~b & d)) + 0x5a827999;
+		else if (i < 40)
+			t = (b ^ c ^ d) + 0x6ed9eba1;
+		else if (i < 60)
+			t = ((b & c) | (b & d) | (c & d)) + 0x8f1bbcdc;
+		else
+			t = (b ^ c ^ d) + 0xca62c1d6;
+		t += ROL(a, 5) + e + w[i];
+		e = d;
+		d = c;
+		c = ROL(b, 30);
+		b = a;
+		a = t;
+	}
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+	memset(w, 0, sizeof(w));
+}
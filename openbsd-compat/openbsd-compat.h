@@ -148,9 +148,16 @@ int getpeereid(int , uid_t *, gid_t *);
 
 #ifndef HAVE_ARC4RANDOM
 unsigned int arc4random(void);
-void arc4random_stir(void);
 #endif /* !HAVE_ARC4RANDOM */
 
+#ifndef HAVE_ARC4RANDOM_BUF
+void arc4random_buf(void *, size_t);
+#endif /* !HAVE_ARC4RANDOM_BUF */
+
+#ifndef HAVE_ARC4RANDOM_STIR
+void arc4random_stir(void);
+#endif /* !HAVE_ARC4RANDOM_STIR */
+
 #ifndef HAVE_ASPRINTF
 int asprintf(char **, const char *, ...);
 #endif 
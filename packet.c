@@ -52,6 +52,9 @@
 #include <arpa/inet.h>
 
 #include <errno.h>
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -121,6 +124,9 @@ static int compression_buffer_ready = 0;
 /* Flag indicating whether packet compression/decompression is enabled. */
 static int packet_compression = 0;
 
+/* Level used when SSH2 compression is negotiated. */
+static int packet_compression_level = 6;
+
 /* default maximum packet size */
 u_int max_packet_size = 32768;
 
@@ -161,10 +167,33 @@ struct packet {
 };
 #ifndef _TOH_
 TAILQ_HEAD(, packet) outgoing;
+TAILQ_HEAD(, packet) outgoing_free;
 #else /* _TOH_ */
 TAILQ_HEAD(dummy_headname, packet) outgoing;
+TAILQ_HEAD(dummy_freename, packet) outgoing_free;
 #endif /* _TOH_ */
 
+/*
+ * Non-transport packets are held in 'outgoing' while a key exchange is in
+ * progress.  Entries (and their payload buffers) are recycled through
+ * 'outgoing_free' so a busy rekey does not cost a malloc per packet.
+ * Channel output is throttled once PACKET_QUEUE_MAX bytes are held.
+ */
+#define PACKET_QUEUE_MAX	(1024 * 1024)
+#define PACKET_FREE_MAX		64
+static u_int outgoing_nfree;
+static u_int outgoing_npackets;
+static u_int64_t outgoing_bytes;
+
+/* Rekey statistics: how long outgoing channel data was held back */
+static struct {
+	struct timeval	start;
+	u_int		count;
+	u_int64_t	total_usec;
+	u_int64_t	max_usec;
+	u_int64_t	max_bytes;
+} rekey_stats;
+
 /*
  * Sets the descriptors used for communication.  Disables encryption until
  * packet_set_encryption_key is called.
@@ -190,6 +219,7 @@ packet_set_connection(int fd_in, int fd_out)
 		buffer_init(&outgoing_packet);
 		buffer_init(&incoming_packet);
 		TAILQ_INIT(&outgoing);
+		TAILQ_INIT(&outgoing_free);
 	}
 }
 
@@ -318,6 +348,25 @@ packet_set_state(int mode, u_int32_t seqnr, u_int64_t blocks, u_int32_t packets)
 	state->packets = packets;
 }
 
+/*
+ * Returns how many rekeys completed, the total and longest time outgoing
+ * channel data was held back by them (in microseconds) and the most bytes
+ * queued meanwhile.
+ */
+void
+packet_get_rekey_stats(u_int *count, u_int64_t *total_usec,
+    u_int64_t *max_usec, u_int64_t *max_bytes)
+{
+	if (count != NULL)
+		*count = rekey_stats.count;
+	if (total_usec != NULL)
+		*total_usec = rekey_stats.total_usec;
+	if (max_usec != NULL)
+		*max_usec = rekey_stats.max_usec;
+	if (max_bytes != NULL)
+		*max_bytes = rekey_stats.max_bytes;
+}
+
 /* returns 1 if connection is via ipv4 */
 
 int
@@ -375,6 +424,14 @@ packet_close(void)
 	if (!initialized)
 		return;
 	initialized = 0;
+	/* The client reports these with its transfer statistics */
+	if (server_side && rekey_stats.count > 0)
+		verbose("Rekeyed %u times: outgoing data held for %llu ms "
+		    "total, %llu ms max, up to %llu bytes queued",
+		    rekey_stats.count,
+		    (unsigned long long)rekey_stats.total_usec / 1000,
+		    (unsigned long long)rekey_stats.max_usec / 1000,
+		    (unsigned long long)rekey_stats.max_bytes);
 	if (connection_in == connection_out) {
 		shutdown(connection_out, SHUT_RDWR);
 		close(connection_out);
@@ -435,6 +492,38 @@ packet_start_compression(int level)
 	buffer_compress_init_recv();
 }
 
+/* Sets the level (1-9) used for compression negotiated by SSH2 kex. */
+void
+packet_set_compression_level(int level)
+{
+	if (level < 1 || level > 9)
+		fatal("Bad compression level %d.", level);
+	packet_compression_level = level;
+}
+
+/* Switches on the negotiated SSH2 compression method for one direction. */
+static void
+packet_enable_comp(Comp *comp, int mode)
+{
+	packet_init_compression();
+#ifdef WITH_ZSTD
+	if (comp->type == COMP_ZSTD) {
+		if (mode == MODE_OUT)
+			buffer_compress_init_send_zstd(
+			    packet_compression_level);
+		else
+			buffer_compress_init_recv_zstd();
+		comp->enabled = 1;
+		return;
+	}
+#endif
+	if (mode == MODE_OUT)
+		buffer_compress_init_send(packet_compression_level);
+	else
+		buffer_compress_init_recv();
+	comp->enabled = 1;
+}
+
 /*
  * Causes any further packets to be encrypted using the given key.  The same
  * key is used for both sending and reception.  However, both directions are
@@ -537,9 +626,8 @@ static void
 packet_send1(void)
 {
 	u_char buf[8], *cp;
-	int i, padding, len;
+	int padding, len;
 	u_int checksum;
-	u_int32_t rnd = 0;
 
 	/*
 	 * If using packet compression, compress the payload of the outgoing
@@ -563,12 +651,7 @@ packet_send1(void)
 	padding = 8 - len % 8;
 	if (!send_context.plaintext) {
 		cp = buffer_ptr(&outgoing_packet);
-		for (i = 0; i < padding; i++) {
-			if (i % 4 == 0)
-				rnd = arc4random();
-			cp[7 - i] = rnd & 0xff;
-			rnd >>= 8;
-		}
+		arc4random_buf(cp + 8 - padding, padding);
 	}
 	buffer_consume(&outgoing_packet, 8 - padding);
 
@@ -658,15 +741,9 @@ set_newkeys(int mode)
 	   memset(enc->key, 0, enc->key_len);
 	   memset(mac->key, 0, mac->key_len); */
 	if ((comp->type == COMP_ZLIB ||
-	    (comp->type == COMP_DELAYED && after_authentication)) &&
-	    comp->enabled == 0) {
-		packet_init_compression();
-		if (mode == MODE_OUT)
-			buffer_compress_init_send(6);
-		else
-			buffer_compress_init_recv();
-		comp->enabled = 1;
-	}
+	    ((comp->type == COMP_DELAYED || comp->type == COMP_ZSTD) &&
+	    after_authentication)) && comp->enabled == 0)
+		packet_enable_comp(comp, mode);
 	/*
 	 * The 2^(blocksize*2) limit is too expensive for 3DES,
 	 * blowfish, etc, so enforce a 1GB limit for small blocksizes.
@@ -700,14 +777,9 @@ packet_enable_delayed_compress(void)
 		if (newkeys[mode] == NULL)
 			continue;
 		comp = &newkeys[mode]->comp;
-		if (comp && !comp->enabled && comp->type == COMP_DELAYED) {
-			packet_init_compression();
-			if (mode == MODE_OUT)
-				buffer_compress_init_send(6);
-			else
-				buffer_compress_init_recv();
-			comp->enabled = 1;
-		}
+		if (comp && !comp->enabled && (comp->type == COMP_DELAYED ||
+		    comp->type == COMP_ZSTD))
+			packet_enable_comp(comp, mode);
 	}
 }
 
@@ -720,8 +792,7 @@ packet_send2_wrapped(void)
 	u_char type, *cp, *macbuf = NULL;
 	u_char padlen, pad;
 	u_int packet_length = 0;
-	u_int i, len;
-	u_int32_t rnd = 0;
+	u_int len;
 	Enc *enc   = NULL;
 	Mac *mac   = NULL;
 	Comp *comp = NULL;
@@ -777,13 +848,8 @@ packet_send2_wrapped(void)
 	}
 	cp = buffer_append_space(&outgoing_packet, padlen);
 	if (enc && !send_context.plaintext) {
-		/* random padding */
-		for (i = 0; i < padlen; i++) {
-			if (i % 4 == 0)
-				rnd = arc4random();
-			cp[i] = rnd & 0xff;
-			rnd >>= 8;
-		}
+		/* random padding, taken from the pool in one go */
+		arc4random_buf(cp, padlen);
 	} else {
 		/* clear padding */
 		memset(cp, 0, padlen);
@@ -828,12 +894,33 @@ packet_send2_wrapped(void)
 		packet_enable_delayed_compress();
 }
 
+/* Records how long outgoing data was held back by a completed rekey. */
+static void
+packet_rekey_done(void)
+{
+	struct timeval now, diff;
+	u_int64_t usec;
+
+	gettimeofday(&now, NULL);
+	timersub(&now, &rekey_stats.start, &diff);
+	usec = (u_int64_t)diff.tv_sec * 1000000 + diff.tv_usec;
+	rekey_stats.count++;
+	rekey_stats.total_usec += usec;
+	rekey_stats.max_usec = MAX(rekey_stats.max_usec, usec);
+	rekey_stats.max_bytes = MAX(rekey_stats.max_bytes, outgoing_bytes);
+	debug("rekey: outgoing data held for %llu ms, %u packets "
+	    "(%llu bytes) queued", (unsigned long long)usec / 1000,
+	    outgoing_npackets, (unsigned long long)outgoing_bytes);
+}
+
 static void
 packet_send2(void)
 {
 	static int rekeying = 0;
 	struct packet *p;
+	Buffer spare;
 	u_char type, *cp;
+	int had_keys = (newkeys[MODE_OUT] != NULL);
 
 	cp = buffer_ptr(&outgoing_packet);
 	type = cp[5];
@@ -842,35 +929,59 @@ packet_send2(void)
 	if (rekeying) {
 		if (!((type >= SSH2_MSG_TRANSPORT_MIN) &&
 		    (type <= SSH2_MSG_TRANSPORT_MAX))) {
-			debug("enqueue packet: %u", type);
-			p = xmalloc(sizeof(*p));
+			debug3("enqueue packet: %u", type);
+			if ((p = TAILQ_FIRST(&outgoing_free)) != NULL) {
+				TAILQ_REMOVE(&outgoing_free, p, next);
+				outgoing_nfree--;
+			} else {
+				p = xmalloc(sizeof(*p));
+				buffer_init(&p->payload);
+			}
 			p->type = type;
+			/* hand the packet to the queue, take its spare buffer */
+			memcpy(&spare, &p->payload, sizeof(Buffer));
 			memcpy(&p->payload, &outgoing_packet, sizeof(Buffer));
-			buffer_init(&outgoing_packet);
+			memcpy(&outgoing_packet, &spare, sizeof(Buffer));
+			buffer_clear(&outgoing_packet);
+			outgoing_npackets++;
+			outgoing_bytes += buffer_len(&p->payload);
 			TAILQ_INSERT_TAIL(&outgoing, p, next);
 			return;
 		}
 	}
 
 	/* rekeying starts with sending KEXINIT */
-	if (type == SSH2_MSG_KEXINIT)
+	if (type == SSH2_MSG_KEXINIT) {
 		rekeying = 1;
+		gettimeofday(&rekey_stats.start, NULL);
+	}
 
 	packet_send2_wrapped();
 
 	/* after a NEWKEYS message we can send the complete queue */
 	if (type == SSH2_MSG_NEWKEYS) {
 		rekeying = 0;
+		/* the initial key exchange is not a rekey */
+		if (had_keys)
+			packet_rekey_done();
 		while ((p = TAILQ_FIRST(&outgoing))) {
 			type = p->type;
-			debug("dequeue packet: %u", type);
-			buffer_free(&outgoing_packet);
-			memcpy(&outgoing_packet, &p->payload,
-			    sizeof(Buffer));
+			debug3("dequeue packet: %u", type);
 			TAILQ_REMOVE(&outgoing, p, next);
-			xfree(p);
+			memcpy(&spare, &outgoing_packet, sizeof(Buffer));
+			memcpy(&outgoing_packet, &p->payload, sizeof(Buffer));
+			memcpy(&p->payload, &spare, sizeof(Buffer));
 			packet_send2_wrapped();
+			if (outgoing_nfree < PACKET_FREE_MAX) {
+				TAILQ_INSERT_TAIL(&outgoing_free, p, next);
+				outgoing_nfree++;
+			} else {
+				buffer_free(&p->payload);
+				xfree(p);
+			}
 		}
+		outgoing_npackets = 0;
+		outgoing_bytes = 0;
 	}
 }
 
@@ -1275,6 +1386,72 @@ packet_process_incoming(const char *buf, u_int len)
 	buffer_append(&input, buf, len);
 }
 
+/*
+ * Reads one line of the identification exchange into buf, without its
+ * line terminator; anything from a '\r' on is dropped too.  The stream is
+ * read in blocks into the input buffer rather than a byte at a time, so
+ * whatever the peer sent after the line is left there for the packet
+ * layer.  A line that does not fit in buf is returned in pieces.
+ * Returns the number of bytes taken from the stream, 0 if the peer
+ * closed the connection or -1 on error.
+ */
+int
+packet_read_ident(char *buf, u_int len)
+{
+	char rbuf[1024], *cp;
+	u_int avail, i, used;
+	ssize_t r;
+
+	if (len == 0)
+		fatal("%s: no space", __func__);
+	for (;;) {
+		cp = buffer_ptr(&input);
+		avail = buffer_len(&input);
+		for (i = 0; i < avail && i < len - 1; i++) {
+			if (cp[i] == '\n')
+				break;
+			/* Kludge for F-Secure Macintosh < 1.0.2 */
+			if (cp[i] == '\r' && i == 12 &&
+			    strncmp(cp, "SSH-1.5-W1.0", 12) == 0)
+				break;
+		}
+		if (i < avail) {
+			used = (i < len - 1 || cp[i] == '\n') ? i + 1 : i;
+			memcpy(buf, cp, i);
+			buf[i] = '\0';
+			buf[strcspn(buf, "\r")] = '\0';
+			buffer_consume(&input, used);
+			return used;
+		}
+		r = read(connection_in, rbuf, sizeof(rbuf));
+		if (r == -1 && (errno == EINTR || errno == EAGAIN)) {
+#ifndef _TOH_
+			if (errno == EAGAIN) {
+				struct pollfd pfd;
+
+				pfd.fd = connection_in;
+				pfd.events = POLLIN;
+				(void)poll(&pfd, 1, -1);
+			}
+#endif /* _TOH_ */
+			continue;
+		}
+		if (r <= 0)
+			return r;
+		buffer_append(&input, rbuf, r);
+	}
+}
+
+/*
+ * Queues our identification string so that it goes out together with
+ * the first packet.  packet_write_wait() sends it on its own.
+ */
+void
+packet_send_ident(const char *s)
+{
+	buffer_append(&output, s, strlen(s));
+}
+
 /* Returns a character from the packet. */
 
 u_int
@@ -1490,6 +1667,9 @@ packet_have_data_to_write(void)
 int
 packet_not_very_much_data_to_write(void)
 {
+	/* channel data keeps flowing during rekey, but only up to a point */
+	if (outgoing_bytes >= PACKET_QUEUE_MAX)
+		return 0;
 	if (interactive_mode)
 		return buffer_len(&output) < 16384;
 	else
@@ -1583,17 +1763,9 @@ packet_add_padding(u_char pad)
 void
 packet_send_ignore(int nbytes)
 {
-	u_int32_t rnd = 0;
-	int i;
-
 	packet_start(compat20 ? SSH2_MSG_IGNORE : SSH_MSG_IGNORE);
 	packet_put_int(nbytes);
-	for (i = 0; i < nbytes; i++) {
-		if (i % 4 == 0)
-			rnd = arc4random();
-		packet_put_char((u_char)rnd & 0xff);
-		rnd >>= 8;
-	}
+	arc4random_buf(buffer_append_space(&outgoing_packet, nbytes), nbytes);
 }
 
 #define MAX_PACKETS	(1U<<31)
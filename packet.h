@@ -30,6 +30,7 @@ u_int	 packet_get_encryption_key(u_char *);
 void     packet_set_protocol_flags(u_int);
 u_int	 packet_get_protocol_flags(void);
 void     packet_start_compression(int);
+void     packet_set_compression_level(int);
 void     packet_set_interactive(int);
 int      packet_is_interactive(void);
 void     packet_set_server(void);
@@ -49,6 +50,8 @@ int      packet_read(void);
 void     packet_read_expect(int type);
 int      packet_read_poll(void);
 void     packet_process_incoming(const char *buf, u_int len);
+int      packet_read_ident(char *, u_int);
+void     packet_send_ident(const char *);
 int      packet_read_seqnr(u_int32_t *seqnr_p);
 int      packet_read_poll_seqnr(u_int32_t *seqnr_p);
 
@@ -68,6 +71,7 @@ int	 packet_get_keycontext(int, u_char *);
 void	 packet_set_keycontext(int, u_char *);
 void	 packet_get_state(int, u_int32_t *, u_int64_t *, u_int32_t *);
 void	 packet_set_state(int, u_int32_t, u_int64_t, u_int32_t);
+void	 packet_get_rekey_stats(u_int *, u_int64_t *, u_int64_t *, u_int64_t *);
 int	 packet_get_ssh1_cipher(void);
 void	 packet_set_iv(int, u_char *);
 
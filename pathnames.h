@@ -39,6 +39,8 @@
 #define _PATH_HOST_KEY_FILE		SSHDIR "/ssh_host_key"
 #define _PATH_HOST_DSA_KEY_FILE		SSHDIR "/ssh_host_dsa_key"
 #define _PATH_HOST_RSA_KEY_FILE		SSHDIR "/ssh_host_rsa_key"
+#define _PATH_HOST_ECDSA_KEY_FILE	SSHDIR "/ssh_host_ecdsa_key"
+#define _PATH_HOST_ED25519_KEY_FILE	SSHDIR "/ssh_host_ed25519_key"
 #define _PATH_DH_MODULI			SSHDIR "/moduli"
 /* Backwards compatibility */
 #define _PATH_DH_PRIMES			SSHDIR "/primes"
@@ -74,6 +76,16 @@
 #define _PATH_SSH_USER_HOSTFILE2	"known_hosts2"
 #endif /* _TOH_ */
 
+/*
+ * Cache of locally measured cipher and MAC throughput, used to order the
+ * proposal when Ciphers or MACs is set to "auto-fast".
+ */
+#ifndef _TOH_
+#define _PATH_SSH_USER_ALGSPEED		"~/.ssh/algspeed"
+#else /* _TOH_ */
+#define _PATH_SSH_USER_ALGSPEED		"algspeed"
+#endif /* _TOH_ */
+
 /*
  * Name of the default file containing client-side authentication key. This
  * file should only be readable by the user him/herself.
@@ -82,10 +94,14 @@
 #define _PATH_SSH_CLIENT_IDENTITY	".ssh/identity"
 #define _PATH_SSH_CLIENT_ID_DSA		".ssh/id_dsa"
 #define _PATH_SSH_CLIENT_ID_RSA		".ssh/id_rsa"
+#define _PATH_SSH_CLIENT_ID_ECDSA	".ssh/id_ecdsa"
+#define _PATH_SSH_CLIENT_ID_ED25519	".ssh/id_ed25519"
 #else /* _TOH_ */
 #define _PATH_SSH_CLIENT_IDENTITY	"identity"
 #define _PATH_SSH_CLIENT_ID_DSA		"id_dsa"
 #define _PATH_SSH_CLIENT_ID_RSA		"id_rsa"
+#define _PATH_SSH_CLIENT_ID_ECDSA	"id_ecdsa"
+#define _PATH_SSH_CLIENT_ID_ED25519	"id_ed25519"
 #endif /* _TOH_ */
 
 /*
@@ -252,7 +252,7 @@ start_progress_meter(char *f, off_t filesize, off_t *ctr)
 	start = last_update = time(NULL);
 	file = f;
 	end_pos = filesize;
-	cur_pos = 0;
+	cur_pos = *ctr;
 	counter = ctr;
 	stalled = 0;
 	bytes_per_second = 0;
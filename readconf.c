@@ -42,6 +42,7 @@
 #include "buffer.h"
 #include "kex.h"
 #include "mac.h"
+#include "algspeed.h"
 
 /* Format of the configuration file:
 
@@ -130,6 +131,7 @@ typedef enum {
 	oServerAliveInterval, oServerAliveCountMax, oIdentitiesOnly,
 	oSendEnv, oControlPath, oControlMaster, oHashKnownHosts,
 	oTunnel, oTunnelDevice, oLocalCommand, oPermitLocalCommand,
+	oConnectTrace,
 	oDeprecated, oUnsupported
 } OpCodes;
 
@@ -226,6 +228,7 @@ static struct {
 	{ "tunneldevice", oTunnelDevice },
 	{ "localcommand", oLocalCommand },
 	{ "permitlocalcommand", oPermitLocalCommand },
+	{ "connecttrace", oConnectTrace },
 	{ NULL, oBadOption }
 };
 
@@ -649,7 +652,7 @@ parse_int:
 		arg = strdelim(&s);
 		if (!arg || *arg == '\0')
 			fatal("%.200s line %d: Missing argument.", filename, linenum);
-		if (!ciphers_valid(arg))
+		if (strcmp(arg, ALGSPEED_AUTO_FAST) != 0 && !ciphers_valid(arg))
 			fatal("%.200s line %d: Bad SSH2 cipher spec '%s'.",
 			    filename, linenum, arg ? arg : "<NONE>");
 		if (*activep && options->ciphers == NULL)
@@ -660,7 +663,7 @@ parse_int:
 		arg = strdelim(&s);
 		if (!arg || *arg == '\0')
 			fatal("%.200s line %d: Missing argument.", filename, linenum);
-		if (!mac_valid(arg))
+		if (strcmp(arg, ALGSPEED_AUTO_FAST) != 0 && !mac_valid(arg))
 			fatal("%.200s line %d: Bad SSH2 Mac spec '%s'.",
 			    filename, linenum, arg ? arg : "<NONE>");
 		if (*activep && options->macs == NULL)
@@ -915,6 +918,10 @@ parse_int:
 		intptr = &options->permit_local_command;
 		goto parse_flag;
 
+	case oConnectTrace:
+		intptr = &options->connect_trace;
+		goto parse_flag;
+
 	case oDeprecated:
 		debug("%s line %d: Deprecated option \"%s\"",
 		    filename, linenum, keyword);
@@ -1067,6 +1074,7 @@ initialize_options(Options * options)
 	options->tun_remote = -1;
 	options->local_command = NULL;
 	options->permit_local_command = -1;
+	options->connect_trace = -1;
 }
 
 /*
@@ -1175,6 +1183,28 @@ fill_default_options(Options * options)
 #else /* _TOH_ */
 			    len, "%.100s", _PATH_SSH_CLIENT_ID_DSA);
 #endif /* _TOH_ */
+
+#ifdef OPENSSL_HAS_ECC
+			len = 2 + strlen(_PATH_SSH_CLIENT_ID_ECDSA) + 1;
+			options->identity_files[options->num_identity_files] =
+			    xmalloc(len);
+			snprintf(options->identity_files[options->num_identity_files++],
+#ifndef _TOH_
+			    len, "~/%.100s", _PATH_SSH_CLIENT_ID_ECDSA);
+#else /* _TOH_ */
+			    len, "%.100s", _PATH_SSH_CLIENT_ID_ECDSA);
+#endif /* _TOH_ */
+#endif
+
+			len = 2 + strlen(_PATH_SSH_CLIENT_ID_ED25519) + 1;
+			options->identity_files[options->num_identity_files] =
+			    xmalloc(len);
+			snprintf(options->identity_files[options->num_identity_files++],
+#ifndef _TOH_
+			    len, "~/%.100s", _PATH_SSH_CLIENT_ID_ED25519);
+#else /* _TOH_ */
+			    len, "%.100s", _PATH_SSH_CLIENT_ID_ED25519);
+#endif /* _TOH_ */
 		}
 	}
 	if (options->escape_char == -1)
@@ -1217,6 +1247,8 @@ fill_default_options(Options * options)
 		options->tun_remote = SSH_TUNID_ANY;
 	if (options->permit_local_command == -1)
 		options->permit_local_command = 0;
+	if (options->connect_trace == -1)
+		options->connect_trace = 0;
 	/* options->local_command should not be set by default */
 	/* options->proxy_command should not be set by default */
 	/* options->user will be set in the main program if appropriate */
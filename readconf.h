@@ -120,6 +120,7 @@ typedef struct {
 
 	char	*local_command;
 	int	permit_local_command;
+	int	connect_trace;	/* log timing of connection setup */
 
 }       Options;
 
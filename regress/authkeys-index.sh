@@ -0,0 +1,68 @@
+#	Placed in the Public Domain.
+
+tid="authorized_keys index"
+
+AK=$OBJ/authorized_keys_$USER
+
+rm -f $OBJ/pad $OBJ/pad.pub $AK.orig
+${SSHKEYGEN} -q -N '' -t rsa -b 1024 -f $OBJ/pad ||\
+	fatal "ssh-keygen for pad failed"
+cp $AK $AK.orig
+cp $OBJ/sshd_proxy $OBJ/sshd_proxy_bak
+
+# pad count: authorized_keys lines for a key that is not ours
+pad()
+{
+	key=`cat $OBJ/pad.pub`
+	i=0
+	while [ $i -lt $1 ]; do
+		echo "$key pad$i"
+		echo "from=\"10.0.0.$i\",no-pty $key"
+		i=`expr $i + 1`
+	done
+}
+
+for p in yes no; do
+	cp $OBJ/sshd_proxy_bak $OBJ/sshd_proxy
+	echo "UsePrivilegeSeparation $p" >> $OBJ/sshd_proxy
+
+	verbose "$tid: privsep $p: key after padding"
+	(
+		pad 200
+		cat $AK.orig
+	) > $AK
+	${SSH} -2 -F $OBJ/ssh_proxy somehost true ||\
+		fail "privsep $p: key after padding rejected"
+
+	verbose "$tid: privsep $p: first matching line wins"
+	(
+		pad 100
+		echo "command=\"echo forced a b\",no-pty `cat $OBJ/rsa.pub`"
+		pad 100
+		cat $AK.orig
+	) > $AK
+	r=`${SSH} -2 -F $OBJ/ssh_proxy somehost echo plain`
+	if [ "x$r" != "xforced a b" ]; then
+		fail "privsep $p: got \"$r\" instead of the forced command"
+	fi
+
+	verbose "$tid: privsep $p: comments and junk"
+	(
+		echo "# comment"
+		echo ""
+		pad 100
+		echo "junk line"
+		echo "ssh-rsa not-base64"
+		echo "no-pty ssh-rsa"
+		cat $AK.orig
+	) > $AK
+	${SSH} -2 -F $OBJ/ssh_proxy somehost true ||\
+		fail "privsep $p: key after junk rejected"
+
+	verbose "$tid: privsep $p: key absent"
+	pad 200 > $AK
+	${SSH} -2 -F $OBJ/ssh_proxy somehost true >>$TEST_SSH_LOGFILE 2>&1 &&\
+		fail "privsep $p: absent key accepted"
+done
+
+rm -f $OBJ/pad $OBJ/pad.pub $AK.orig
@@ -0,0 +1,63 @@
+#	Placed in the Public Domain.
+
+tid="compression"
+
+DATA=/bin/ls${EXEEXT}
+COPY=${OBJ}/copy
+RAND=${OBJ}/compress.rand
+LOG=${OBJ}/compress.log
+
+cp $OBJ/sshd_proxy $OBJ/sshd_proxy_bak
+
+# Incompressible data, several of zlib's 256KB back-off windows long
+rm -f ${RAND}
+if [ -r /dev/urandom ]; then
+	dd if=/dev/urandom of=${RAND} bs=1k count=2048 2>/dev/null
+fi
+
+for p in yes no; do
+	for c in delayed yes; do
+		cp $OBJ/sshd_proxy_bak $OBJ/sshd_proxy
+		echo "UsePrivilegeSeparation $p" >> $OBJ/sshd_proxy
+		echo "Compression $c" >> $OBJ/sshd_proxy
+
+		for l in 1 6 9; do
+			verbose "$tid: privsep $p compression $c level $l"
+			rm -f ${COPY}
+			${SSH} -n -C -o CompressionLevel=$l -F $OBJ/ssh_proxy \
+			    somehost cat ${DATA} > ${COPY}
+			if [ $? -ne 0 ]; then
+				fail "ssh cat $DATA failed"
+			fi
+			cmp ${DATA} ${COPY} || fail "corrupted copy"
+		done
+
+		test -f ${RAND} || continue
+
+		verbose "$tid: privsep $p compression $c incompressible"
+		rm -f ${COPY}
+		${SSH} -n -C -F $OBJ/ssh_proxy somehost cat ${RAND} > ${COPY}
+		if [ $? -ne 0 ]; then
+			fail "ssh cat $RAND failed"
+		fi
+		cmp ${RAND} ${COPY} || fail "corrupted incompressible copy"
+
+		rm -f ${COPY}
+		${SSH} -vv -C -F $OBJ/ssh_proxy somehost "cat > ${COPY}" \
+		    < ${RAND} 2>${LOG}
+		if [ $? -ne 0 ]; then
+			fail "ssh cat > $COPY failed"
+		fi
+		cmp ${RAND} ${COPY} || fail "corrupted incompressible upload"
+		comp=`sed -n 's/.*kex: client->server .* \([^ ]*\)$/\1/p' ${LOG}`
+		trace "privsep $p compression $c negotiated $comp"
+		case "$comp" in
+		zlib*)
+			grep "compress: .*sending stored" ${LOG} >/dev/null ||\
+			    fail "zlib did not back off on incompressible data"
+			;;
+		esac
+	done
+done
+
+rm -f ${COPY} ${RAND} ${LOG}
@@ -0,0 +1,94 @@
+#	Placed in the Public Domain.
+
+tid="ed25519 and ecdsa keys"
+
+KH=$OBJ/known_hosts
+AK=$OBJ/authorized_keys_$USER
+
+cp $OBJ/sshd_proxy $OBJ/sshd_proxy_bak
+cp $KH $KH.orig
+cp $AK $AK.orig
+
+# ECDSA keys can only be made when OpenSSL has elliptic curves
+ktypes=""
+for t in ed25519 ecdsa256 ecdsa384 ecdsa521; do
+	rm -f $OBJ/key.$t $OBJ/key.$t.pub
+	case $t in
+	ecdsa*)	opts="-t ecdsa -b `echo $t | sed 's/ecdsa//'`" ;;
+	*)	opts="-t $t" ;;
+	esac
+	if ${SSHKEYGEN} -q -N '' $opts -f $OBJ/key.$t >/dev/null 2>&1; then
+		ktypes="$ktypes $t"
+	elif [ $t = ed25519 ]; then
+		fail "ssh-keygen for $t failed"
+	else
+		trace "no $t keys"
+	fi
+done
+
+# name of the key type as ssh logs it
+logname()
+{
+	case $1 in
+	ecdsa*)	echo ECDSA ;;
+	*)	echo $1 | tr a-z A-Z ;;
+	esac
+}
+
+for t in $ktypes; do
+	n=`logname $t`
+
+	verbose "$tid: $t host key"
+	cp $OBJ/sshd_proxy_bak $OBJ/sshd_proxy
+	echo "HostKey $OBJ/key.$t" >> $OBJ/sshd_proxy
+	echo "localhost-with-alias `cat $OBJ/key.$t.pub`" > $KH
+	${SSH} -2 -v -F $OBJ/ssh_proxy somehost true 2>$OBJ/keytype.log ||\
+		fail "$t host key rejected"
+	grep "matches the $n host key" $OBJ/keytype.log >/dev/null ||\
+		fail "$t host key not used"
+
+	verbose "$tid: rsa host key known, $t offered too"
+	cp $KH.orig $KH
+	${SSH} -2 -v -F $OBJ/ssh_proxy somehost true 2>$OBJ/keytype.log ||\
+		fail "known rsa host key not chosen over $t"
+	grep "matches the RSA host key" $OBJ/keytype.log >/dev/null ||\
+		fail "rsa host key not used next to $t"
+
+	verbose "$tid: $t user key"
+	cp $OBJ/sshd_proxy_bak $OBJ/sshd_proxy
+	cat $OBJ/key.$t.pub > $AK
+	${SSH} -2 -F $OBJ/ssh_proxy -i $OBJ/key.$t somehost true ||\
+		fail "$t user key rejected"
+	cp $AK.orig $AK
+done
+
+# A known key on one curve must not make the others look known
+case "$ktypes" in
+*ecdsa256*ecdsa384*)
+	verbose "$tid: ecdsa curve preference"
+	cp $OBJ/sshd_proxy_bak $OBJ/sshd_proxy
+	echo "HostKey $OBJ/key.ecdsa384" >> $OBJ/sshd_proxy
+	(
+		cat $KH.orig
+		echo "localhost-with-alias `cat $OBJ/key.ecdsa256.pub`"
+	) > $KH
+	${SSH} -2 -F $OBJ/ssh_proxy somehost true >>$TEST_SSH_LOGFILE 2>&1 ||\
+		fail "known nistp256 key made nistp384 preferred"
+	;;
+esac
+
+verbose "$tid: curve25519 key exchange"
+cp $OBJ/sshd_proxy_bak $OBJ/sshd_proxy
+cp $KH.orig $KH
+${SSH} -2 -F $OBJ/ssh_proxy -o ConnectTrace=yes somehost true \
+    2>$OBJ/keytype.log || fail "curve25519 connect failed"
+grep "Trace: kex curve25519-sha256 " $OBJ/keytype.log >/dev/null ||\
+	fail "curve25519-sha256 not negotiated"
+
+verbose "$tid: rekey with curve25519"
+rm -f $OBJ/copy
+dd if=/bin/ls${EXEEXT} bs=1k 2>/dev/null | ${SSH} -2 -F $OBJ/ssh_proxy \
+    -o RekeyLimit=16k somehost "cat > $OBJ/copy"
+cmp /bin/ls${EXEEXT} $OBJ/copy || fail "corrupted copy after rekey"
+
+rm -f $OBJ/key.* $OBJ/keytype.log $OBJ/copy $KH.orig $AK.orig
@@ -0,0 +1,85 @@
+#	Placed in the Public Domain.
+
+tid="known_hosts index"
+
+KH=$OBJ/known_hosts
+
+rm -f $OBJ/pad $OBJ/pad.pub $KH.idx $KH.orig $KH.tmp $KH.tmp.old
+${SSHKEYGEN} -q -N '' -t rsa -b 1024 -f $OBJ/pad ||\
+	fatal "ssh-keygen for pad failed"
+cp $KH $KH.orig
+
+# pad count prefix: known_hosts lines for hosts that are not ours
+pad()
+{
+	key=`cat $OBJ/pad.pub`
+	i=0
+	while [ $i -lt $1 ]; do
+		echo "$2$i.example.com,$2$i $key"
+		i=`expr $i + 1`
+	done
+	echo "*.$2.example.org,!$2.example.org $key"
+}
+
+# connect alias: ssh through the proxy, checking the key under 'alias'
+connect()
+{
+	${SSH} -F $OBJ/ssh_proxy -o HostKeyAlias=$1 somehost true \
+	    >>$TEST_SSH_LOGFILE 2>&1
+}
+
+# All plain, well past the size from which an index is kept
+verbose "$tid: plain"
+(
+	pad 400 a
+	cat $KH.orig
+	echo "changed-alias `cat $OBJ/pad.pub`"
+	pad 400 b
+) > $KH
+connect localhost-with-alias || fail "plain: known host rejected"
+test -f $KH.idx || fail "plain: index not built"
+connect localhost-with-alias || fail "plain: known host rejected by index"
+connect unknown-alias && fail "plain: unknown host accepted"
+connect changed-alias && fail "plain: changed host key accepted"
+
+# Hashed entries before plain ones
+verbose "$tid: mixed hashed and plain"
+(
+	pad 400 c
+	echo "hashed-alias `cat $OBJ/rsa.pub`"
+) > $KH.tmp
+${SSHKEYGEN} -q -H -f $KH.tmp >/dev/null 2>&1 || fail "ssh-keygen -H failed"
+(
+	pad 400 d
+	echo "plain-alias `cat $OBJ/rsa.pub`"
+) >> $KH.tmp
+mv $KH.tmp $KH
+grep hashed-alias $KH >/dev/null && fail "mixed: entry not hashed"
+connect hashed-alias || fail "mixed: hashed host rejected"
+connect plain-alias || fail "mixed: plain host rejected"
+connect localhost-with-alias && fail "mixed: host from old file accepted"
+
+# Appended by ssh; the new line is read from the unindexed tail
+verbose "$tid: append"
+${SSH} -F $OBJ/ssh_proxy -o HostKeyAlias=new-alias \
+    -o StrictHostKeyChecking=no somehost true >>$TEST_SSH_LOGFILE 2>&1 ||\
+	fail "append: connect failed"
+grep new-alias $KH >/dev/null || fail "append: host not added"
+connect new-alias || fail "append: added host rejected"
+connect hashed-alias || fail "append: hashed host rejected"
+connect plain-alias || fail "append: plain host rejected"
+
+# Rewritten in place, so only the size and mtime give the change away
+verbose "$tid: stale index"
+(
+	pad 100 e
+	cat $KH.orig
+	pad 600 f
+) > $KH.tmp
+cat $KH.tmp > $KH
+connect localhost-with-alias || fail "stale: moved host rejected"
+connect plain-alias && fail "stale: removed host accepted"
+pad 700 g > $KH
+connect localhost-with-alias && fail "stale: removed host accepted"
+
+rm -f $OBJ/pad $OBJ/pad.pub $KH.idx $KH.orig $KH.tmp $KH.tmp.old
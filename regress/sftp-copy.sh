@@ -0,0 +1,50 @@
+#	Placed in the Public Domain.
+
+tid="sftp copy-data"
+
+DATA=/bin/ls${EXEEXT}
+BIG=${OBJ}/sftp.data
+COPY=${OBJ}/copy
+
+rm -f ${BIG} ${COPY} ${COPY}.1 ${COPY}.2
+
+# Large enough to take several copy-data chunks
+for i in 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16; do
+	cat $DATA
+done > ${BIG}
+
+verbose "$tid: cp"
+echo "cp ${BIG} ${COPY}" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+	|| fail "cp failed"
+cmp ${BIG} ${COPY} || fail "corrupted copy after cp"
+
+verbose "$tid: cp over a longer file"
+echo "cp $DATA ${COPY}" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+	|| fail "cp over a longer file failed"
+cmp $DATA ${COPY} || fail "corrupted copy after cp over a longer file"
+
+verbose "$tid: cp of an empty file"
+rm -f ${COPY}.1
+touch ${COPY}.1
+echo "cp ${COPY}.1 ${COPY}" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+	|| fail "cp of an empty file failed"
+cmp ${COPY}.1 ${COPY} || fail "corrupted copy after cp of an empty file"
+
+verbose "$tid: cp with requests in flight"
+rm -f ${COPY} ${COPY}.1
+cat << EOF | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 || fail "cp batch failed"
+	cp ${BIG} ${COPY}
+	ls ${OBJ}
+	cp ${COPY} ${COPY}.1
+	get ${COPY}.1 ${COPY}.2
+EOF
+cmp ${BIG} ${COPY}.1 || fail "corrupted copy of a copy"
+cmp ${BIG} ${COPY}.2 || fail "corrupted get of a copy"
+
+verbose "$tid: cp of a missing file"
+rm -f ${COPY}
+echo "cp ${COPY}.nonexistent ${COPY}" | ${SFTP} -b - -P ${SFTPSERVER} \
+	>/dev/null 2>&1 && fail "cp of a missing file succeeded"
+test -f ${COPY} && fail "cp of a missing file created the target"
+
+rm -f ${BIG} ${COPY} ${COPY}.1 ${COPY}.2
@@ -0,0 +1,95 @@
+#	Placed in the Public Domain.
+
+tid="sftp resume and sparse"
+
+DATA=/bin/ls${EXEEXT}
+BIG=${OBJ}/sftp.data
+COPY=${OBJ}/copy
+SPARSE=${OBJ}/sparse
+
+rm -rf ${BIG} ${COPY} ${COPY}.dd ${SPARSE}.*
+
+# Several 256KB check-file blocks worth of data
+for i in 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16; do
+	cat $DATA
+done > ${BIG}
+
+# partial size: make a prefix of ${BIG} of that many KB in ${COPY}
+partial()
+{
+	rm -f ${COPY}
+	dd if=${BIG} of=${COPY} bs=1k count=$1 2>/dev/null
+}
+
+# spoil offset: overwrite one byte of ${COPY} at that offset
+spoil()
+{
+	echo X | dd of=${COPY} bs=1 seek=$1 count=1 conv=notrunc 2>/dev/null
+}
+
+for cmd in get put; do
+	# the server is local, so both directions copy ${BIG} to ${COPY}
+	args="${BIG} ${COPY}"
+
+	verbose "$tid: $cmd -a of a prefix"
+	partial 1024
+	echo "$cmd -a $args" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+		|| fail "$cmd -a failed"
+	cmp ${BIG} ${COPY} || fail "corrupted copy after $cmd -a of a prefix"
+
+	verbose "$tid: $cmd -a with a bad tail block"
+	partial 1024
+	spoil 600000
+	echo "$cmd -a $args" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+		|| fail "$cmd -a failed"
+	cmp ${BIG} ${COPY} || fail "corrupted copy after $cmd -a of bad tail"
+
+	verbose "$tid: $cmd -a of a modified file"
+	partial 1024
+	spoil 10
+	echo "$cmd -a $args" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+		|| fail "$cmd -a failed"
+	cmp ${BIG} ${COPY} || fail "corrupted copy after $cmd -a of modified"
+
+	verbose "$tid: $cmd -a of a complete file"
+	echo "$cmd -a $args" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+		|| fail "$cmd -a failed"
+	cmp ${BIG} ${COPY} || fail "corrupted copy after $cmd -a of complete"
+done
+
+verbose "$tid: reget and reput"
+partial 300
+echo "reget ${BIG} ${COPY}" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+	|| fail "reget failed"
+cmp ${BIG} ${COPY} || fail "corrupted copy after reget"
+partial 300
+echo "reput ${BIG} ${COPY}" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+	|| fail "reput failed"
+cmp ${BIG} ${COPY} || fail "corrupted copy after reput"
+
+# Leading, inner and trailing holes
+dd if=$DATA of=${SPARSE}.1 bs=1k seek=1024 count=64 2>/dev/null
+dd if=/dev/null of=${SPARSE}.1 bs=1k seek=3072 2>/dev/null
+dd if=$DATA of=${SPARSE}.2 bs=1k count=64 2>/dev/null
+dd if=$DATA of=${SPARSE}.2 bs=1k seek=2048 count=64 2>/dev/null
+dd if=/dev/null of=${SPARSE}.3 bs=1k seek=1024 2>/dev/null
+
+verbose "$tid: put of sparse files"
+for i in 1 2 3; do
+	rm -f ${COPY}
+	echo "put ${SPARSE}.$i ${COPY}" | ${SFTP} -P ${SFTPSERVER} \
+		>/dev/null 2>&1 || fail "put of sparse file $i failed"
+	cmp ${SPARSE}.$i ${COPY} || fail "corrupted copy of sparse file $i"
+done
+
+verbose "$tid: batched put of sparse files"
+rm -rf ${COPY}.dd
+mkdir ${COPY}.dd
+echo "put ${SPARSE}.* ${COPY}.dd" | ${SFTP} -P ${SFTPSERVER} >/dev/null 2>&1 \
+	|| fail "batched put of sparse files failed"
+for i in 1 2 3; do
+	cmp ${SPARSE}.$i ${COPY}.dd/sparse.$i || \
+		fail "corrupted batched copy of sparse file $i"
+done
+
+rm -rf ${BIG} ${COPY} ${COPY}.dd ${SPARSE}.*
@@ -83,11 +83,17 @@
 #endif
 #include <sys/wait.h>
 #include <sys/uio.h>
+#ifdef HAVE_SYS_SENDFILE_H
+# include <sys/sendfile.h>
+#endif
 
 #include <ctype.h>
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
 #include <pwd.h>
 #include <signal.h>
 #include <stdarg.h>
@@ -112,6 +118,7 @@ extern char *__progname;
 int do_cmd(char *host, char *remuser, char *cmd, int *fdin, int *fdout);
 
 void bwlimit(int);
+size_t bwchunk(size_t);
 
 /* Struct for addargs */
 arglist args;
@@ -257,9 +264,24 @@ do_cmd(char *host, char *remuser, char *cmd, int *fdin, int *fdout)
 	return 0;
 }
 
+/*
+ * File data moves in blocks of at least COPY_BUFLEN, and goes straight
+ * between the file and the ssh pipe with sendfile(2) or splice(2) where
+ * the descriptors allow it.
+ */
+#define COPY_BUFLEN	(1024 * 1024)
+
+#if defined(HAVE_SENDFILE) && defined(HAVE_SYS_SENDFILE_H)
+# define USE_SENDFILE
+#endif
+#if defined(HAVE_SPLICE) && defined(SPLICE_F_MOVE)
+# define USE_SPLICE
+#endif
+
 typedef struct {
 	size_t cnt;
-	char *buf;
+	char *buf;		/* page aligned, within base */
+	char *base;
 } BUF;
 
 BUF *allocbuf(BUF *, int, int);
@@ -278,6 +300,12 @@ char cmd[CMDNEEDS];		/* must hold "rcp -r -p -d\0" */
 
 int response(void);
 void rsource(char *, struct stat *);
+#ifdef USE_SENDFILE
+size_t send_file(int, size_t);
+#endif
+#ifdef USE_SPLICE
+size_t receive_file(int, size_t);
+#endif
 void sink(int, char *[]);
 void source(int, char *[]);
 void tolocal(int, char *[]);
@@ -585,6 +613,9 @@ source(int argc, char **argv)
 	off_t i, amt, statbytes;
 	size_t result;
 	int fd = -1, haderr, indx;
+#ifdef USE_SENDFILE
+	static int zerocopy = 1;
+#endif
 	char *last, *name, buf[2048], encname[MAXPATHLEN];
 	int len;
 
@@ -607,6 +638,9 @@ syserr:			run_err("%s: %s", name, strerror(errno));
 		unset_nonblock(fd);
 		switch (stb.st_mode & S_IFMT) {
 		case S_IFREG:
+#ifdef HAVE_POSIX_FADVISE
+			(void) posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
 			break;
 		case S_IFDIR:
 			if (iamrecursive) {
@@ -645,7 +679,7 @@ syserr:			run_err("%s: %s", name, strerror(errno));
 		(void) atomicio(vwrite, remout, buf, strlen(buf));
 		if (response() < 0)
 			goto next;
-		if ((bp = allocbuf(&buffer, fd, 2048)) == NULL) {
+		if ((bp = allocbuf(&buffer, fd, COPY_BUFLEN)) == NULL) {
 next:			if (fd != -1) {
 				(void) close(fd);
 				fd = -1;
@@ -655,10 +689,29 @@ next:			if (fd != -1) {
 		if (showprogress)
 			start_progress_meter(curfile, stb.st_size, &statbytes);
 		/* Keep writing after an error so that we stay sync'd up. */
-		for (haderr = i = 0; i < stb.st_size; i += bp->cnt) {
-			amt = bp->cnt;
+		for (haderr = i = 0; i < stb.st_size; i += amt) {
+			amt = bwchunk(bp->cnt);
 			if (i + amt > stb.st_size)
 				amt = stb.st_size - i;
+#ifdef USE_SENDFILE
+			if (!haderr && zerocopy) {
+				result = send_file(fd, amt);
+				if (result != 0 ||
+				    (errno != EINVAL && errno != ENOSYS)) {
+					statbytes += result;
+					if (result != amt) {
+						haderr = errno;
+						(void) atomicio(vwrite, remout,
+						    bp->buf, amt - result);
+					}
+					if (limit_rate)
+						bwlimit(amt);
+					continue;
+				}
+				/* not for these descriptors */
+				zerocopy = 0;
+			}
+#endif
 			if (!haderr) {
 				result = atomicio(read, fd, bp->buf, amt);
 				if (result != amt)
@@ -744,59 +797,138 @@ rsource(char *name, struct stat *statp)
 	(void) response();
 }
 
+/*
+ * With -l, data is sent and received in slices of about 1/BWLIMIT_HZ
+ * second at the limit, and paid for from a token bucket: credit builds
+ * up at limit_rate bits a second, to at most BWLIMIT_BURST slices, and
+ * any debt is slept off.
+ */
+#define BWLIMIT_HZ	20
+#define BWLIMIT_BURST	2
+#define BWLIMIT_MIN	2048
+
+size_t
+bwchunk(size_t len)
+{
+	size_t slice;
+
+	if (!limit_rate)
+		return len;
+	slice = limit_rate / 8 / BWLIMIT_HZ;
+	if (slice < BWLIMIT_MIN)
+		slice = BWLIMIT_MIN;
+	return MIN(len, slice);
+}
+
 void
 bwlimit(int amount)
 {
-	static struct timeval bwstart, bwend;
-	static int lamt, thresh = 16384;
-	u_int64_t waitlen;
+	static struct timeval last;
+	static double tokens;
+	struct timeval now, elapsed;
 	struct timespec ts, rm;
-
-	if (!timerisset(&bwstart)) {
-		gettimeofday(&bwstart, NULL);
-		return;
+	double burst, wait;
+
+	gettimeofday(&now, NULL);
+	if (timerisset(&last)) {
+		timersub(&now, &last, &elapsed);
+		tokens += (elapsed.tv_sec + elapsed.tv_usec / 1000000.0) *
+		    limit_rate;
+		burst = (double)bwchunk(SIZE_T_MAX) * 8 * BWLIMIT_BURST;
+		if (tokens > burst)
+			tokens = burst;
 	}
+	last = now;
 
-	lamt += amount;
-	if (lamt < thresh)
-		return;
-
-	gettimeofday(&bwend, NULL);
-	timersub(&bwend, &bwstart, &bwend);
-	if (!timerisset(&bwend))
+	tokens -= (double)amount * 8;
+	if (tokens >= 0)
 		return;
 
-	lamt *= 8;
-	waitlen = (double)1000000L * lamt / limit_rate;
-
-	bwstart.tv_sec = waitlen / 1000000L;
-	bwstart.tv_usec = waitlen % 1000000L;
-
-	if (timercmp(&bwstart, &bwend, >)) {
-		timersub(&bwstart, &bwend, &bwend);
+	wait = -tokens / limit_rate;
+	ts.tv_sec = (time_t)wait;
+	ts.tv_nsec = (long)((wait - ts.tv_sec) * 1000000000.0);
+	while (nanosleep(&ts, &rm) == -1) {
+		if (errno != EINTR)
+			break;
+		ts = rm;
+	}
+}
 
-		/* Adjust the wait time */
-		if (bwend.tv_sec) {
-			thresh /= 2;
-			if (thresh < 2048)
-				thresh = 2048;
-		} else if (bwend.tv_usec < 100) {
-			thresh *= 2;
-			if (thresh > 32768)
-				thresh = 32768;
+#ifdef USE_SENDFILE
+/*
+ * Send 'amt' bytes from the file position of 'fd' to remout in the
+ * kernel.  Returns the number of bytes sent, short with errno set if
+ * something went wrong: nothing with EINVAL or ENOSYS if sendfile(2)
+ * can not be used for these descriptors.
+ */
+size_t
+send_file(int fd, size_t amt)
+{
+	struct pollfd pfd;
+	size_t pos = 0;
+	ssize_t res;
+
+	pfd.fd = remout;
+	pfd.events = POLLOUT;
+	while (pos < amt) {
+		res = sendfile(remout, fd, NULL, amt - pos);
+		if (res == -1) {
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN) {
+				(void)poll(&pfd, 1, -1);
+				continue;
+			}
+			return pos;
 		}
-
-		TIMEVAL_TO_TIMESPEC(&bwend, &ts);
-		while (nanosleep(&ts, &rm) == -1) {
-			if (errno != EINTR)
-				break;
-			ts = rm;
+		if (res == 0) {
+			/* the file has shrunk */
+			errno = EIO;
+			return pos;
 		}
+		pos += res;
 	}
+	return pos;
+}
+#endif /* USE_SENDFILE */
 
-	lamt = 0;
-	gettimeofday(&bwstart, NULL);
+#ifdef USE_SPLICE
+/*
+ * Move 'amt' bytes from remin to the file position of 'ofd' in the
+ * kernel.  Returns the number of bytes moved, short with errno set if
+ * something went wrong: nothing with EINVAL or ENOSYS if remin is not
+ * a pipe or the kernel can not splice to the file.
+ */
+size_t
+receive_file(int ofd, size_t amt)
+{
+	struct pollfd pfd;
+	size_t pos = 0;
+	ssize_t res;
+
+	pfd.fd = remin;
+	pfd.events = POLLIN;
+	while (pos < amt) {
+		res = splice(remin, NULL, ofd, NULL, amt - pos,
+		    SPLICE_F_MOVE|SPLICE_F_MORE);
+		if (res == -1) {
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN) {
+				(void)poll(&pfd, 1, -1);
+				continue;
+			}
+			return pos;
+		}
+		if (res == 0) {
+			errno = EPIPE;
+			return pos;
+		}
+		pos += res;
+	}
+	return pos;
 }
+#endif /* USE_SPLICE */
 
 void
 sink(int argc, char **argv)
@@ -814,6 +946,9 @@ sink(int argc, char **argv)
 	off_t size, statbytes;
 	int setimes, targisdir, wrerrno = 0;
 	char ch, *cp, *np, *targ, *why, *vect[1], buf[2048];
+#ifdef USE_SPLICE
+	static int zerocopy = 1;
+#endif
 	struct timeval tv[2];
 
 #define	atime	tv[0]
@@ -974,7 +1109,7 @@ bad:			run_err("%s: %s", np, strerror(errno));
 			continue;
 		}
 		(void) atomicio(vwrite, remout, "", 1);
-		if ((bp = allocbuf(&buffer, ofd, 4096)) == NULL) {
+		if ((bp = allocbuf(&buffer, ofd, COPY_BUFLEN)) == NULL) {
 			(void) close(ofd);
 			continue;
 		}
@@ -984,25 +1119,41 @@ bad:			run_err("%s: %s", np, strerror(errno));
 		statbytes = 0;
 		if (showprogress)
 			start_progress_meter(curfile, size, &statbytes);
-		for (count = i = 0; i < size; i += 4096) {
-			amt = 4096;
+		for (count = i = 0; i < size; i += amt) {
+			amt = bwchunk(bp->cnt - count);
 			if (i + amt > size)
 				amt = size - i;
-			count += amt;
-			do {
-				j = atomicio(read, remin, cp, amt);
-				if (j == 0) {
-					run_err("%s", j ? strerror(errno) :
-					    "dropped connection");
-					exit(1);
+#ifdef USE_SPLICE
+			if (zerocopy && wrerr == NO && count == 0) {
+				j = receive_file(ofd, amt);
+				if (j != 0 ||
+				    (errno != EINVAL && errno != ENOSYS)) {
+					statbytes += j;
+					if (j != (size_t)amt) {
+						/* read the rest to stay sync'd */
+						wrerr = YES;
+						wrerrno = errno;
+						amt = j;
+					}
+					if (limit_rate)
+						bwlimit(amt);
+					continue;
 				}
-				amt -= j;
-				cp += j;
-				statbytes += j;
-			} while (amt > 0);
+				/* not for these descriptors */
+				zerocopy = 0;
+			}
+#endif
+			count += amt;
+			j = atomicio(read, remin, cp, amt);
+			if (j != (size_t)amt) {
+				run_err("%s", "dropped connection");
+				exit(1);
+			}
+			cp += j;
+			statbytes += j;
 
 			if (limit_rate)
-				bwlimit(4096);
+				bwlimit(amt);
 
 			if (count == bp->cnt) {
 				/* Keep reading so we stay sync'd up. */
@@ -1197,6 +1348,7 @@ BUF *
 allocbuf(BUF *bp, int fd, int blksize)
 {
 	size_t size;
+	long align;
 #ifdef HAVE_STRUCT_STAT_ST_BLKSIZE
 	struct stat stb;
 
@@ -1212,10 +1364,14 @@ allocbuf(BUF *bp, int fd, int blksize)
 #endif /* HAVE_STRUCT_STAT_ST_BLKSIZE */
 	if (bp->cnt >= size)
 		return (bp);
-	if (bp->buf == NULL)
-		bp->buf = xmalloc(size);
-	else
-		bp->buf = xrealloc(bp->buf, 1, size);
+#ifdef _SC_PAGESIZE
+	if ((align = sysconf(_SC_PAGESIZE)) <= 0)
+#endif
+		align = 4096;
+	if (bp->base != NULL)
+		xfree(bp->base);
+	bp->base = xmalloc(size + align);
+	bp->buf = bp->base + (align - (size_t)bp->base % align) % align;
 	memset(bp->buf, 0, size);
 	bp->cnt = size;
 	return (bp);
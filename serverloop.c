@@ -839,7 +839,8 @@ server_loop2(Authctxt *authctxt)
 
 		rekeying = (xxx_kex != NULL && !xxx_kex->done);
 
-		if (!rekeying && packet_not_very_much_data_to_write())
+		/* keeps flowing while rekeying, see packet_send2() */
+		if (packet_not_very_much_data_to_write())
 			channel_output_poll();
 		wait_until_can_do_something(&readset, &writeset, &max_fd,
 		    &nalloc, 0);
@@ -851,13 +852,11 @@ server_loop2(Authctxt *authctxt)
 		}
 
 		collect_children();
-		if (!rekeying) {
-			channel_after_select(readset, writeset);
-			if (packet_need_rekeying()) {
-				debug("need rekeying");
-				xxx_kex->done = 0;
-				kex_send_kexinit(xxx_kex);
-			}
+		channel_after_select(readset, writeset);
+		if (!rekeying && packet_need_rekeying()) {
+			debug("need rekeying");
+			xxx_kex->done = 0;
+			kex_send_kexinit(xxx_kex);
 		}
 		process_input(readset);
 		if (connection_closed)
@@ -39,8 +39,11 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
+#include <openssl/evp.h>
+
 #include "xmalloc.h"
 #include "buffer.h"
 #include "log.h"
@@ -65,8 +68,178 @@ struct sftp_conn {
 	u_int num_requests;
 	u_int version;
 	u_int msg_id;
+#define SFTP_EXT_STATVFS	0x00000001
+#define SFTP_EXT_FSTATVFS	0x00000002
+#define SFTP_EXT_FSYNC		0x00000004
+#define SFTP_EXT_LIMITS		0x00000008
+#define SFTP_EXT_COPY_DATA	0x00000010
+#define SFTP_EXT_CHECK_FILE	0x00000020
+	u_int exts;
+	u_int download_max;	/* from limits@openssh.com, 0 if unknown */
+	u_int upload_max;
+};
+
+/*
+ * Transfer window.  The number of requests in flight and their size
+ * start from the -R and -B values and follow the link: the window opens
+ * while each round of replies arrives faster than the best round so
+ * far, and closes again when round trip times climb well above the
+ * lowest seen without any gain in rate, i.e. when the extra requests
+ * only sit in queues.  Requests grow once the window is at its widest.
+ * The data in flight stays under WINDOW_MEM_MAX.
+ */
+#define WINDOW_MEM_MAX		(16 * 1024 * 1024)
+#define WINDOW_REQ_MAX		256
+#define WINDOW_REQ_MIN		2
+#define WINDOW_BUFLEN_MAX	(64 * 1024)
+#define WINDOW_BUFLEN_MIN	8192
+
+struct xfer_window {
+	u_int num_req;		/* requests to keep in flight */
+	u_int buflen;		/* size of each request */
+	u_int min_req, max_req;
+	u_int min_buflen, max_buflen;
+	int slow_start;
+	double rtt_min, rtt_avg;	/* seconds */
+	double rate_best;		/* bytes/s */
+	double round_start;
+	u_int round_replies;
+	u_int64_t round_bytes;
+
+	/* statistics */
+	double start;
+	u_int64_t bytes;
+	u_int replies, peak_req, peak_buflen, grown, shrunk;
 };
 
+static double
+window_now(void)
+{
+	struct timeval tv;
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+		return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+#endif
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+/*
+ * 'limit' is the largest request the server has said it will take, or 0
+ * if it has not told us.
+ */
+static void
+window_init(struct xfer_window *w, struct sftp_conn *conn, u_int limit)
+{
+	memset(w, 0, sizeof(*w));
+	w->num_req = conn->num_requests;
+	w->buflen = conn->transfer_buflen;
+	w->min_req = MIN(WINDOW_REQ_MIN, w->num_req);
+	w->max_req = MAX(WINDOW_REQ_MAX, w->num_req);
+	/* v0 servers may not take more than we were told to use */
+	w->max_buflen = conn->version == 0 ? w->buflen :
+	    MAX(WINDOW_BUFLEN_MAX, w->buflen);
+	if (limit != 0) {
+		w->max_buflen = limit;
+		w->buflen = MIN(w->buflen, limit);
+	}
+	w->min_buflen = MIN(WINDOW_BUFLEN_MIN, w->buflen);
+	w->slow_start = 1;
+	w->start = w->round_start = window_now();
+	w->peak_req = w->num_req;
+	w->peak_buflen = w->buflen;
+}
+
+static void
+window_clamp(struct xfer_window *w)
+{
+	w->num_req = MAX(w->min_req, MIN(w->num_req, w->max_req));
+	w->buflen = MAX(w->min_buflen, MIN(w->buflen, w->max_buflen));
+	if ((u_int64_t)w->num_req * w->buflen > WINDOW_MEM_MAX)
+		w->num_req = MAX(w->min_req, WINDOW_MEM_MAX / w->buflen);
+	w->peak_req = MAX(w->peak_req, w->num_req);
+	w->peak_buflen = MAX(w->peak_buflen, w->buflen);
+}
+
+static void
+window_adapt(struct xfer_window *w, double now)
+{
+	double rate = w->round_bytes / MAX(now - w->round_start, 1e-6);
+	/* ignore delay that is noise on a fast local link */
+	int queued = w->rtt_avg > 2 * w->rtt_min &&
+	    w->rtt_avg - w->rtt_min > 0.005;
+
+	if (rate > w->rate_best * 1.1) {
+		w->rate_best = rate;
+		if (w->num_req < w->max_req &&
+		    (u_int64_t)w->num_req * w->buflen < WINDOW_MEM_MAX)
+			w->num_req = w->slow_start ? w->num_req * 2 :
+			    w->num_req + 1;
+		else
+			w->buflen *= 2;
+		w->grown++;
+	} else {
+		w->slow_start = 0;
+		w->rate_best = MAX(rate, w->rate_best * 0.95);
+		if (queued) {
+			if (w->num_req > w->min_req)
+				w->num_req -= MAX(1, w->num_req / 4);
+			else
+				w->buflen /= 2;
+			w->shrunk++;
+		}
+	}
+	window_clamp(w);
+	debug3("Window %u x %u rate %.0f rtt %.1f/%.1f ms", w->num_req,
+	    w->buflen, rate, w->rtt_min * 1000, w->rtt_avg * 1000);
+
+	w->round_start = now;
+	w->round_replies = 0;
+	w->round_bytes = 0;
+}
+
+/* Account a reply to a request of len bytes sent at the given time. */
+static void
+window_reply(struct xfer_window *w, double sent, u_int len)
+{
+	double now = window_now(), rtt = now - sent;
+
+	if (w->replies == 0 || rtt < w->rtt_min)
+		w->rtt_min = rtt;
+	w->rtt_avg = w->replies == 0 ? rtt : (7 * w->rtt_avg + rtt) / 8;
+	w->replies++;
+	w->bytes += len;
+	w->round_bytes += len;
+	/* a round is a window's worth of replies */
+	if (++w->round_replies >= w->num_req)
+		window_adapt(w, now);
+}
+
+/* The server gave back less than asked: it will not do more. */
+static void
+window_limit(struct xfer_window *w, u_int len)
+{
+	w->max_buflen = MAX(MIN_READ_SIZE, len);
+	w->min_buflen = MIN(w->min_buflen, w->max_buflen);
+	window_clamp(w);
+}
+
+static void
+window_report(struct xfer_window *w, const char *path)
+{
+	double elapsed = MAX(window_now() - w->start, 1e-6);
+
+	debug("Transferred %s: %llu bytes in %.1f seconds, "
+	    "%.1f KB/s, %u requests", path, (unsigned long long)w->bytes,
+	    elapsed, w->bytes / elapsed / 1024, w->replies);
+	debug("Window: %u x %u bytes at end, peak %u x %u, "
+	    "grown %u shrunk %u times, rtt min %.1f avg %.1f ms", w->num_req,
+	    w->buflen, w->peak_req, w->peak_buflen, w->grown, w->shrunk,
+	    w->rtt_min * 1000, w->rtt_avg * 1000);
+}
+
 static void
 send_msg(int fd, Buffer *m)
 {
@@ -236,10 +409,60 @@ get_decode_stat(int fd, u_int expected_id, int quiet)
 	return(a);
 }
 
+/*
+ * Ask the server for the largest requests it takes; READ and WRITE are
+ * then sized to fit.
+ */
+static void
+get_limits(struct sftp_conn *conn)
+{
+	Buffer msg;
+	u_int type, id;
+	u_int64_t packet_max, read_max, write_max, handles_max;
+
+	buffer_init(&msg);
+	id = conn->msg_id++;
+	buffer_put_char(&msg, SSH2_FXP_EXTENDED);
+	buffer_put_int(&msg, id);
+	buffer_put_cstring(&msg, "limits@openssh.com");
+	send_msg(conn->fd_out, &msg);
+	debug3("Sent message limits@openssh.com I:%u", id);
+
+	buffer_clear(&msg);
+	get_msg(conn->fd_in, &msg);
+	type = buffer_get_char(&msg);
+	if ((id = buffer_get_int(&msg)) != conn->msg_id - 1)
+		fatal("ID mismatch (%u != %u)", id, conn->msg_id - 1);
+	if (type == SSH2_FXP_STATUS) {
+		debug("Couldn't get server limits: %s",
+		    fx2txt(buffer_get_int(&msg)));
+		buffer_free(&msg);
+		return;
+	} else if (type != SSH2_FXP_EXTENDED_REPLY)
+		fatal("Expected SSH2_FXP_EXTENDED_REPLY(%u) packet, got %u",
+		    SSH2_FXP_EXTENDED_REPLY, type);
+	packet_max = buffer_get_int64(&msg);
+	read_max = buffer_get_int64(&msg);
+	write_max = buffer_get_int64(&msg);
+	handles_max = buffer_get_int64(&msg);
+	buffer_free(&msg);
+
+	debug2("Server limits: packet %llu read %llu write %llu handles %llu",
+	    (unsigned long long)packet_max, (unsigned long long)read_max,
+	    (unsigned long long)write_max, (unsigned long long)handles_max);
+	/* 0 means no limit; also stay within what we accept back */
+	if (read_max == 0 || read_max > SFTP_MAX_MSG_LENGTH - 1024)
+		read_max = SFTP_MAX_MSG_LENGTH - 1024;
+	if (write_max == 0 || write_max > SFTP_MAX_MSG_LENGTH - 1024)
+		write_max = SFTP_MAX_MSG_LENGTH - 1024;
+	conn->download_max = read_max;
+	conn->upload_max = write_max;
+}
+
 struct sftp_conn *
 do_init(int fd_in, int fd_out, u_int transfer_buflen, u_int num_requests)
 {
-	u_int type;
+	u_int type, exts = 0;
 	int version;
 	Buffer msg;
 	struct sftp_conn *ret;
@@ -268,8 +491,30 @@ do_init(int fd_in, int fd_out, u_int transfer_buflen, u_int num_requests)
 	while (buffer_len(&msg) > 0) {
 		char *name = buffer_get_string(&msg, NULL);
 		char *value = buffer_get_string(&msg, NULL);
-
-		debug2("Init extension: \"%s\"", name);
+		int known = 1;
+
+		if (strcmp(name, "statvfs@openssh.com") == 0 &&
+		    strcmp(value, "2") == 0)
+			exts |= SFTP_EXT_STATVFS;
+		else if (strcmp(name, "fstatvfs@openssh.com") == 0 &&
+		    strcmp(value, "2") == 0)
+			exts |= SFTP_EXT_FSTATVFS;
+		else if (strcmp(name, "fsync@openssh.com") == 0 &&
+		    strcmp(value, "1") == 0)
+			exts |= SFTP_EXT_FSYNC;
+		else if (strcmp(name, "limits@openssh.com") == 0 &&
+		    strcmp(value, "1") == 0)
+			exts |= SFTP_EXT_LIMITS;
+		else if (strcmp(name, "copy-data") == 0 &&
+		    strcmp(value, "1") == 0)
+			exts |= SFTP_EXT_COPY_DATA;
+		else if (strcmp(name, "check-file-handle") == 0 &&
+		    strcmp(value, "1") == 0)
+			exts |= SFTP_EXT_CHECK_FILE;
+		else
+			known = 0;
+		debug2("Init extension: \"%s\" version %s%s", name, value,
+		    known ? "" : " (unsupported)");
 		xfree(name);
 		xfree(value);
 	}
@@ -283,11 +528,16 @@ do_init(int fd_in, int fd_out, u_int transfer_buflen, u_int num_requests)
 	ret->num_requests = num_requests;
 	ret->version = version;
 	ret->msg_id = 1;
+	ret->exts = exts;
+	ret->download_max = ret->upload_max = 0;
 
 	/* Some filexfer v.0 servers don't support large packets */
 	if (version == 0)
 		ret->transfer_buflen = MIN(ret->transfer_buflen, 20480);
 
+	if (exts & SFTP_EXT_LIMITS)
+		get_limits(ret);
+
 	return(ret);
 }
 
@@ -297,6 +547,12 @@ sftp_proto_version(struct sftp_conn *conn)
 	return(conn->version);
 }
 
+u_int
+sftp_request_count(struct sftp_conn *conn)
+{
+	return(conn->msg_id - 1);
+}
+
 int
 do_close(struct sftp_conn *conn, char *handle, u_int handle_len)
 {
@@ -733,6 +989,214 @@ do_readlink(struct sftp_conn *conn, char *path)
 	return(filename);
 }
 
+static void
+send_open_request(int fd_out, u_int id, char *path, u_int pflags, Attrib *a)
+{
+	Buffer msg;
+	Attrib junk;
+
+	if (a == NULL) {
+		attrib_clear(&junk); /* Send empty attributes */
+		a = &junk;
+	}
+	buffer_init(&msg);
+	buffer_put_char(&msg, SSH2_FXP_OPEN);
+	buffer_put_int(&msg, id);
+	buffer_put_cstring(&msg, path);
+	buffer_put_int(&msg, pflags);
+	encode_attrib(&msg, a);
+	send_msg(fd_out, &msg);
+	buffer_free(&msg);
+}
+
+static int
+get_decode_statvfs(int fd, struct sftp_statvfs *st, u_int expected_id,
+    int quiet)
+{
+	Buffer msg;
+	u_int type, id, status;
+
+	buffer_init(&msg);
+	get_msg(fd, &msg);
+
+	type = buffer_get_char(&msg);
+	id = buffer_get_int(&msg);
+
+	debug3("Received statvfs reply T:%u I:%u", type, id);
+	if (id != expected_id)
+		fatal("ID mismatch (%u != %u)", id, expected_id);
+	if (type == SSH2_FXP_STATUS) {
+		status = buffer_get_int(&msg);
+		if (quiet)
+			debug("Couldn't statvfs: %s", fx2txt(status));
+		else
+			error("Couldn't statvfs: %s", fx2txt(status));
+		buffer_free(&msg);
+		return -1;
+	} else if (type != SSH2_FXP_EXTENDED_REPLY) {
+		fatal("Expected SSH2_FXP_EXTENDED_REPLY(%u) packet, got %u",
+		    SSH2_FXP_EXTENDED_REPLY, type);
+	}
+
+	memset(st, 0, sizeof(*st));
+	st->f_bsize = buffer_get_int64(&msg);
+	st->f_frsize = buffer_get_int64(&msg);
+	st->f_blocks = buffer_get_int64(&msg);
+	st->f_bfree = buffer_get_int64(&msg);
+	st->f_bavail = buffer_get_int64(&msg);
+	st->f_files = buffer_get_int64(&msg);
+	st->f_ffree = buffer_get_int64(&msg);
+	st->f_favail = buffer_get_int64(&msg);
+	st->f_fsid = buffer_get_int64(&msg);
+	st->f_flag = buffer_get_int64(&msg);
+	st->f_namemax = buffer_get_int64(&msg);
+	buffer_free(&msg);
+
+	return 0;
+}
+
+int
+do_statvfs(struct sftp_conn *conn, char *path, struct sftp_statvfs *st,
+    int quiet)
+{
+	Buffer msg;
+	u_int id;
+
+	if ((conn->exts & SFTP_EXT_STATVFS) == 0) {
+		error("Server does not support statvfs@openssh.com extension");
+		return -1;
+	}
+
+	id = conn->msg_id++;
+	buffer_init(&msg);
+	buffer_put_char(&msg, SSH2_FXP_EXTENDED);
+	buffer_put_int(&msg, id);
+	buffer_put_cstring(&msg, "statvfs@openssh.com");
+	buffer_put_cstring(&msg, path);
+	send_msg(conn->fd_out, &msg);
+	debug3("Sent message statvfs@openssh.com I:%u P:%s", id, path);
+	buffer_free(&msg);
+
+	return get_decode_statvfs(conn->fd_in, st, id, quiet);
+}
+
+int
+do_fsync(struct sftp_conn *conn, char *handle, u_int handle_len)
+{
+	Buffer msg;
+	u_int status, id;
+
+	if ((conn->exts & SFTP_EXT_FSYNC) == 0) {
+		error("Server does not support fsync@openssh.com extension");
+		return -1;
+	}
+
+	id = conn->msg_id++;
+	buffer_init(&msg);
+	buffer_put_char(&msg, SSH2_FXP_EXTENDED);
+	buffer_put_int(&msg, id);
+	buffer_put_cstring(&msg, "fsync@openssh.com");
+	buffer_put_string(&msg, handle, handle_len);
+	send_msg(conn->fd_out, &msg);
+	debug3("Sent message fsync@openssh.com I:%u", id);
+	buffer_free(&msg);
+
+	status = get_status(conn->fd_in, id);
+	if (status != SSH2_FX_OK)
+		error("Couldn't sync file: %s", fx2txt(status));
+
+	return(status);
+}
+
+/*
+ * Copy remote 'oldpath' to 'newpath' with the copy-data extension, so
+ * the data stays on the server.
+ */
+int
+do_copy(struct sftp_conn *conn, char *oldpath, char *newpath)
+{
+	Attrib junk, *a;
+	Buffer msg;
+	char *old_handle, *new_handle;
+	u_int old_handle_len, new_handle_len, status, id;
+	u_int64_t size;
+
+	if ((conn->exts & SFTP_EXT_COPY_DATA) == 0) {
+		error("Server does not support copy-data extension");
+		return -1;
+	}
+
+	if ((a = do_stat(conn, oldpath, 0)) == NULL)
+		return -1;
+	if ((a->flags & SSH2_FILEXFER_ATTR_PERMISSIONS) &&
+	    !S_ISREG(a->perm)) {
+		error("Cannot copy non-regular file: %s", oldpath);
+		return -1;
+	}
+	size = (a->flags & SSH2_FILEXFER_ATTR_SIZE) ? a->size : 0;
+	a->flags &= SSH2_FILEXFER_ATTR_PERMISSIONS;
+	a->perm &= 0777;
+
+	/* Open the source for reading */
+	id = conn->msg_id++;
+	attrib_clear(&junk);
+	send_open_request(conn->fd_out, id, oldpath, SSH2_FXF_READ, &junk);
+	debug3("Sent message SSH2_FXP_OPEN I:%u P:%s", id, oldpath);
+	if ((old_handle = get_handle(conn->fd_in, id,
+	    &old_handle_len)) == NULL)
+		return -1;
+
+	/*
+	 * Not truncated on open: if both paths are the same file, the
+	 * server refuses the overlapping copy and the data is left alone.
+	 * The target is cut to length once the copy has succeeded.
+	 */
+	id = conn->msg_id++;
+	send_open_request(conn->fd_out, id, newpath,
+	    SSH2_FXF_WRITE|SSH2_FXF_CREAT, a);
+	debug3("Sent message SSH2_FXP_OPEN I:%u P:%s", id, newpath);
+	if ((new_handle = get_handle(conn->fd_in, id,
+	    &new_handle_len)) == NULL) {
+		do_close(conn, old_handle, old_handle_len);
+		xfree(old_handle);
+		return -1;
+	}
+
+	/* Copy the whole file: length 0 means up to end of file */
+	id = conn->msg_id++;
+	buffer_init(&msg);
+	buffer_put_char(&msg, SSH2_FXP_EXTENDED);
+	buffer_put_int(&msg, id);
+	buffer_put_cstring(&msg, "copy-data");
+	buffer_put_string(&msg, old_handle, old_handle_len);
+	buffer_put_int64(&msg, 0);
+	buffer_put_int64(&msg, 0);
+	buffer_put_string(&msg, new_handle, new_handle_len);
+	buffer_put_int64(&msg, 0);
+	send_msg(conn->fd_out, &msg);
+	debug3("Sent message copy-data \"%s\" -> \"%s\"", oldpath, newpath);
+	buffer_free(&msg);
+
+	status = get_status(conn->fd_in, id);
+	if (status != SSH2_FX_OK)
+		error("Couldn't copy file \"%s\" to \"%s\": %s", oldpath,
+		    newpath, fx2txt(status));
+	else {
+		attrib_clear(&junk);
+		junk.flags |= SSH2_FILEXFER_ATTR_SIZE;
+		junk.size = size;
+		status = do_fsetstat(conn, new_handle, new_handle_len, &junk);
+	}
+
+	do_close(conn, old_handle, old_handle_len);
+	if (do_close(conn, new_handle, new_handle_len) != SSH2_FX_OK)
+		status = SSH2_FX_FAILURE;
+	xfree(old_handle);
+	xfree(new_handle);
+
+	return(status == SSH2_FX_OK ? 0 : -1);
+}
+
 static void
 send_read_request(int fd_out, u_int id, u_int64_t offset, u_int len,
     char *handle, u_int handle_len)
@@ -750,22 +1214,171 @@ send_read_request(int fd_out, u_int id, u_int64_t offset, u_int len,
 	buffer_free(&msg);
 }
 
+/*
+ * Resuming a transfer.  The last RESUME_CHECK_LEN bytes of the partial
+ * file may have gaps left by requests that were in flight when the
+ * transfer stopped, so they are compared in RESUME_CHECK_BLOCK blocks
+ * with hashes from the server's check-file-handle extension and the
+ * transfer resumes at the first block that differs.  If even the first
+ * block differs, the file has changed and is sent again from the start.
+ */
+#define RESUME_CHECK_LEN	WINDOW_MEM_MAX
+#define RESUME_CHECK_BLOCK	(256 * 1024)
+
+static const EVP_MD *
+resume_md(const char *name)
+{
+	if (strcmp(name, "sha256") == 0)
+		return EVP_sha256();
+	if (strcmp(name, "sha1") == 0)
+		return EVP_sha1();
+	if (strcmp(name, "md5") == 0)
+		return EVP_md5();
+	return NULL;
+}
+
+/*
+ * Returns the offset at which to resume a transfer into a file that
+ * already holds 'size' bytes: 'fd' is the local copy and 'handle' the
+ * remote one.
+ */
+static u_int64_t
+resume_offset(struct sftp_conn *conn, char *handle, u_int handle_len,
+    int fd, u_int64_t size, const char *path)
+{
+	Buffer msg;
+	EVP_MD_CTX *ctx;
+	const EVP_MD *md;
+	u_char digest[EVP_MAX_MD_SIZE], *buf;
+	char *alg;
+	u_int type, id, status, dlen, hlen;
+	u_int64_t start, block, off, end;
+	ssize_t n;
+
+	if (size == 0)
+		return 0;
+	if ((conn->exts & SFTP_EXT_CHECK_FILE) == 0) {
+		logit("Resuming \"%s\" at %llu without checking its tail: "
+		    "server does not support check-file-handle", path,
+		    (unsigned long long)size);
+		return size;
+	}
+	start = size > RESUME_CHECK_LEN ? size - RESUME_CHECK_LEN : 0;
+
+	id = conn->msg_id++;
+	buffer_init(&msg);
+	buffer_put_char(&msg, SSH2_FXP_EXTENDED);
+	buffer_put_int(&msg, id);
+	buffer_put_cstring(&msg, "check-file-handle");
+	buffer_put_string(&msg, handle, handle_len);
+	buffer_put_cstring(&msg, "sha256,sha1,md5");
+	buffer_put_int64(&msg, start);
+	buffer_put_int64(&msg, size - start);
+	buffer_put_int(&msg, RESUME_CHECK_BLOCK);
+	send_msg(conn->fd_out, &msg);
+	debug3("Sent message check-file-handle I:%u O:%llu", id,
+	    (unsigned long long)start);
+
+	buffer_clear(&msg);
+	get_msg(conn->fd_in, &msg);
+	type = buffer_get_char(&msg);
+	if ((id = buffer_get_int(&msg)) != conn->msg_id - 1)
+		fatal("ID mismatch (%u != %u)", id, conn->msg_id - 1);
+	if (type == SSH2_FXP_STATUS) {
+		status = buffer_get_int(&msg);
+		logit("Resuming \"%s\" at %llu without checking its tail: %s",
+		    path, (unsigned long long)size, fx2txt(status));
+		buffer_free(&msg);
+		return size;
+	} else if (type != SSH2_FXP_EXTENDED_REPLY)
+		fatal("Expected SSH2_FXP_EXTENDED_REPLY(%u) packet, got %u",
+		    SSH2_FXP_EXTENDED_REPLY, type);
+	xfree(buffer_get_string(&msg, NULL));	/* "check-file" */
+	alg = buffer_get_string(&msg, NULL);
+	if ((md = resume_md(alg)) == NULL)
+		fatal("Server used unrequested hash \"%s\"", alg);
+	xfree(alg);
+	hlen = EVP_MD_size(md);
+	if (buffer_len(&msg) != (size - start + RESUME_CHECK_BLOCK - 1) /
+	    RESUME_CHECK_BLOCK * hlen)
+		fatal("Bad check-file reply length %u", buffer_len(&msg));
+
+	buf = xmalloc(64 * 1024);
+	ctx = EVP_MD_CTX_create();
+	for (block = start; block < size; block = end) {
+		end = MIN(block + RESUME_CHECK_BLOCK, size);
+		EVP_DigestInit(ctx, md);
+		for (off = block; off < end; off += n) {
+			n = pread(fd, buf, MIN(end - off, 64 * 1024), off);
+			if (n == -1 && (errno == EINTR || errno == EAGAIN))
+				n = 0;
+			else if (n <= 0)
+				break;
+			else
+				EVP_DigestUpdate(ctx, buf, n);
+		}
+		EVP_DigestFinal(ctx, digest, &dlen);
+		if (off < end || memcmp(digest, buffer_ptr(&msg), hlen) != 0)
+			break;
+		buffer_consume(&msg, hlen);
+	}
+	EVP_MD_CTX_destroy(ctx);
+	xfree(buf);
+	buffer_free(&msg);
+
+	if (block == start) {
+		logit("\"%s\" has changed, transferring it again", path);
+		return 0;
+	}
+	debug("Resuming \"%s\" at %llu of %llu", path,
+	    (unsigned long long)block, (unsigned long long)size);
+	return block;
+}
+
+/*
+ * Find the next run of data at or after '*offset' in a local file, so
+ * that the holes of a sparse file are skipped rather than sent as
+ * zeroes.  Sets '*offset' and '*end' to the bounds of the run, with the
+ * file positioned at its start; returns 0 if only a hole is left.
+ */
+static int
+sparse_next(int fd, u_int64_t *offset, u_int64_t *end)
+{
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+	off_t data, hole;
+
+	if ((data = lseek(fd, *offset, SEEK_DATA)) == -1 && errno == ENXIO)
+		return 0;
+	if (data != -1 && (hole = lseek(fd, data, SEEK_HOLE)) != -1) {
+		*offset = data;
+		*end = hole;
+		return lseek(fd, data, SEEK_SET) != -1;
+	}
+#endif
+	/* no holes to be found: read up to end of file */
+	*end = ~(u_int64_t)0;
+	return lseek(fd, *offset, SEEK_SET) != -1;
+}
+
 int
 do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
-    int pflag)
+    int pflag, int fflag, int aflag)
 {
 	Attrib junk, *a;
 	Buffer msg;
 	char *handle;
+	struct stat st;
 	int local_fd, status = 0, write_error;
 	int read_error, write_errno;
 	u_int64_t offset, size;
-	u_int handle_len, mode, type, id, buflen, num_req, max_req;
+	u_int handle_len, mode, type, id, num_req, max_req;
 	off_t progress_counter;
+	struct xfer_window w;
 	struct request {
 		u_int id;
 		u_int len;
 		u_int64_t offset;
+		double sent;
 		TAILQ_ENTRY(request) tq;
 	};
 	TAILQ_HEAD(reqhead, request) requests;
@@ -794,7 +1407,6 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 	else
 		size = 0;
 
-	buflen = conn->transfer_buflen;
 	buffer_init(&msg);
 
 	/* Send open request */
@@ -814,20 +1426,44 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 		return(-1);
 	}
 
-	local_fd = open(local_path, O_WRONLY | O_CREAT | O_TRUNC,
-	    mode | S_IWRITE);
+	/* a partial file is read back to check it */
+	local_fd = open(local_path, O_CREAT |
+	    (aflag ? O_RDWR : O_WRONLY | O_TRUNC), mode | S_IWRITE);
 	if (local_fd == -1) {
 		error("Couldn't open local file \"%s\" for writing: %s",
 		    local_path, strerror(errno));
+		do_close(conn, handle, handle_len);
+		buffer_free(&msg);
+		xfree(handle);
+		return(-1);
+	}
+
+	/* Carry on from what is already here if asked */
+	offset = 0;
+	if (aflag && fstat(local_fd, &st) == -1) {
+		error("Couldn't fstat local file \"%s\": %s", local_path,
+		    strerror(errno));
+		status = -1;
+	} else if (aflag && (u_int64_t)st.st_size > size) {
+		error("Unable to resume download of \"%s\": local file is "
+		    "larger than remote", local_path);
+		status = -1;
+	} else if (aflag)
+		offset = resume_offset(conn, handle, handle_len, local_fd,
+		    st.st_size, local_path);
+	if (status == -1) {
+		do_close(conn, handle, handle_len);
+		close(local_fd);
 		buffer_free(&msg);
 		xfree(handle);
 		return(-1);
 	}
 
 	/* Read from remote and write to local */
-	write_error = read_error = write_errno = num_req = offset = 0;
+	write_error = read_error = write_errno = num_req = 0;
 	max_req = 1;
-	progress_counter = 0;
+	progress_counter = offset;
+	window_init(&w, conn, conn->download_max);
 
 	if (showprogress && size != 0)
 		start_progress_meter(remote_path, size, &progress_counter);
@@ -850,13 +1486,14 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 		while (num_req < max_req) {
 			debug3("Request range %llu -> %llu (%d/%d)",
 			    (unsigned long long)offset,
-			    (unsigned long long)offset + buflen - 1,
+			    (unsigned long long)offset + w.buflen - 1,
 			    num_req, max_req);
 			req = xmalloc(sizeof(*req));
 			req->id = conn->msg_id++;
-			req->len = buflen;
+			req->len = w.buflen;
 			req->offset = offset;
-			offset += buflen;
+			req->sent = window_now();
+			offset += w.buflen;
 			num_req++;
 			TAILQ_INSERT_TAIL(&requests, req, tq);
 			send_read_request(conn->fd_out, req->id, req->offset,
@@ -904,6 +1541,7 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 			}
 			progress_counter += len;
 			xfree(data);
+			window_reply(&w, req->sent, len);
 
 			if (len == req->len) {
 				TAILQ_REMOVE(&requests, req, tq);
@@ -919,11 +1557,13 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 				req->id = conn->msg_id++;
 				req->len -= len;
 				req->offset += len;
+				req->sent = window_now();
 				send_read_request(conn->fd_out, req->id,
 				    req->offset, req->len, handle, handle_len);
 				/* Reduce the request size */
-				if (len < buflen)
-					buflen = MAX(MIN_READ_SIZE, len);
+				if (len < w.buflen &&
+				    (size == 0 || req->offset < size))
+					window_limit(&w, len);
 			}
 			if (max_req > 0) { /* max_req = 0 iff EOF received */
 				if (size > 0 && offset > size) {
@@ -933,9 +1573,10 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 					    (unsigned long long)offset,
 					    num_req);
 					max_req = 1;
-				} else if (max_req <= conn->num_requests) {
+				} else if (max_req < w.num_req) {
 					++max_req;
-				}
+				} else
+					max_req = w.num_req;
 			}
 			break;
 		default:
@@ -946,6 +1587,7 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 
 	if (showprogress && size)
 		stop_progress_meter();
+	window_report(&w, remote_path);
 
 	/* Sanity check */
 	if (TAILQ_FIRST(&requests) != NULL)
@@ -962,6 +1604,11 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 		do_close(conn, handle, handle_len);
 	} else {
 		status = do_close(conn, handle, handle_len);
+		if (fflag && fsync(local_fd) == -1) {
+			error("Couldn't sync file \"%s\": %s", local_path,
+			    strerror(errno));
+			status = -1;
+		}
 
 		/* Override umask and utimes if asked */
 #ifdef HAVE_FCHMOD
@@ -990,21 +1637,23 @@ do_download(struct sftp_conn *conn, char *remote_path, char *local_path,
 
 int
 do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
-    int pflag)
+    int pflag, int fflag, int aflag)
 {
 	int local_fd, status;
-	u_int handle_len, id, type;
-	u_int64_t offset;
+	u_int handle_len, id, type, pflags;
+	u_int64_t offset, data_end, remote_size = 0;
 	char *handle, *data;
 	Buffer msg;
 	struct stat sb;
-	Attrib a;
+	Attrib a, junk, *ra;
 	u_int32_t startid;
 	u_int32_t ackid;
+	struct xfer_window w;
 	struct outstanding_ack {
 		u_int id;
 		u_int len;
 		u_int64_t offset;
+		double sent;
 		TAILQ_ENTRY(outstanding_ack) tq;
 	};
 	TAILQ_HEAD(ackhead, outstanding_ack) acks;
@@ -1036,6 +1685,22 @@ do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
 	if (!pflag)
 		a.flags &= ~SSH2_FILEXFER_ATTR_ACMODTIME;
 
+	/* Carry on from what the server already has if asked */
+	pflags = SSH2_FXF_WRITE|SSH2_FXF_CREAT|SSH2_FXF_TRUNC;
+	if (aflag) {
+		if ((ra = do_stat(conn, remote_path, 1)) != NULL &&
+		    (ra->flags & SSH2_FILEXFER_ATTR_SIZE))
+			remote_size = ra->size;
+		if (remote_size > (u_int64_t)sb.st_size) {
+			error("Unable to resume upload of \"%s\": remote file "
+			    "is larger than local", local_path);
+			close(local_fd);
+			return(-1);
+		}
+		/* the tail is read back to check it */
+		pflags = SSH2_FXF_READ|SSH2_FXF_WRITE|SSH2_FXF_CREAT;
+	}
+
 	buffer_init(&msg);
 
 	/* Send open request */
@@ -1043,7 +1708,7 @@ do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
 	buffer_put_char(&msg, SSH2_FXP_OPEN);
 	buffer_put_int(&msg, id);
 	buffer_put_cstring(&msg, remote_path);
-	buffer_put_int(&msg, SSH2_FXF_WRITE|SSH2_FXF_CREAT|SSH2_FXF_TRUNC);
+	buffer_put_int(&msg, pflags);
 	encode_attrib(&msg, &a);
 	send_msg(conn->fd_out, &msg);
 	debug3("Sent message SSH2_FXP_OPEN I:%u P:%s", id, remote_path);
@@ -1058,10 +1723,27 @@ do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
 	}
 
 	startid = ackid = id + 1;
-	data = xmalloc(conn->transfer_buflen);
+	window_init(&w, conn, conn->upload_max);
+	data = xmalloc(w.max_buflen);
 
 	/* Read from local and write to remote */
-	offset = 0;
+	offset = resume_offset(conn, handle, handle_len, local_fd,
+	    remote_size, remote_path);
+	data_end = offset;
+	/* holes are not written, so drop what is to be replaced */
+	if (offset < remote_size) {
+		attrib_clear(&junk);
+		junk.flags |= SSH2_FILEXFER_ATTR_SIZE;
+		junk.size = offset;
+		if (do_fsetstat(conn, handle, handle_len, &junk) !=
+		    SSH2_FX_OK) {
+			do_close(conn, handle, handle_len);
+			close(local_fd);
+			xfree(data);
+			status = -1;
+			goto done;
+		}
+	}
 	if (showprogress)
 		start_progress_meter(local_path, sb.st_size, &offset);
 
@@ -1076,8 +1758,12 @@ do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
 		 */
 		if (interrupted)
 			len = 0;
+		else if (offset >= data_end &&
+		    !sparse_next(local_fd, &offset, &data_end))
+			len = 0;
 		else do
-			len = read(local_fd, data, conn->transfer_buflen);
+			len = read(local_fd, data, MIN(w.buflen,
+			    data_end - offset));
 		while ((len == -1) && (errno == EINTR || errno == EAGAIN));
 
 		if (len == -1)
@@ -1089,6 +1775,7 @@ do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
 			ack->id = ++id;
 			ack->offset = offset;
 			ack->len = len;
+			ack->sent = window_now();
 			TAILQ_INSERT_TAIL(&acks, ack, tq);
 
 			buffer_clear(&msg);
@@ -1100,14 +1787,17 @@ do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
 			send_msg(conn->fd_out, &msg);
 			debug3("Sent message SSH2_FXP_WRITE I:%u O:%llu S:%u",
 			    id, (unsigned long long)offset, len);
+			/* keep later requests clear of the write ids */
+			if (id >= conn->msg_id)
+				conn->msg_id = id + 1;
 		} else if (TAILQ_FIRST(&acks) == NULL)
 			break;
 
 		if (ack == NULL)
 			fatal("Unexpected ACK %u", id);
 
-		if (id == startid || len == 0 ||
-		    id - ackid >= conn->num_requests) {
+		while (id == startid || len == 0 ||
+		    id - ackid >= w.num_req) {
 			u_int r_id;
 
 			buffer_clear(&msg);
@@ -1145,13 +1835,18 @@ do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
 			}
 			debug3("In write loop, ack for %u %u bytes at %llu",
 			    ack->id, ack->len, (unsigned long long)ack->offset);
+			window_reply(&w, ack->sent, ack->len);
 			++ackid;
 			xfree(ack);
+			/* more than one ack only if the window has shrunk */
+			if (id == startid || len == 0)
+				break;
 		}
 		offset += len;
 	}
 	if (showprogress)
 		stop_progress_meter();
+	window_report(&w, local_path);
 	xfree(data);
 
 	if (close(local_fd) == -1) {
@@ -1162,10 +1857,29 @@ do_upload(struct sftp_conn *conn, char *local_path, char *remote_path,
 		goto done;
 	}
 
+	/* A hole at the end of a sparse file is made by extending it */
+	if (!interrupted && offset < (u_int64_t)sb.st_size) {
+		attrib_clear(&junk);
+		junk.flags |= SSH2_FILEXFER_ATTR_SIZE;
+		junk.size = sb.st_size;
+		if (do_fsetstat(conn, handle, handle_len, &junk) !=
+		    SSH2_FX_OK) {
+			do_close(conn, handle, handle_len);
+			status = -1;
+			goto done;
+		}
+	}
+
 	/* Override umask and utimes if asked */
 	if (pflag)
 		do_fsetstat(conn, handle, handle_len, &a);
 
+	if (fflag && do_fsync(conn, handle, handle_len) != SSH2_FX_OK) {
+		do_close(conn, handle, handle_len);
+		status = -1;
+		goto done;
+	}
+
 	status = do_close(conn, handle, handle_len);
 
 done:
@@ -1173,3 +1887,805 @@ done:
 	buffer_free(&msg);
 	return(status);
 }
+
+/*
+ * Batched transfers.  Up to BATCH_FILES_MAX files are open at once and
+ * their requests share one transfer window and one stream of request
+ * ids: the STAT, OPEN and CLOSE of one file go out while data for the
+ * files ahead of it is still in flight, so a tree of small files is not
+ * held up by a round trip per request.  Data requests go to the oldest
+ * open file first, so files still finish roughly in order.
+ */
+#define BATCH_FILES_MAX		8
+
+enum batch_state {
+	BATCH_WAITING,		/* not started */
+	BATCH_OPENING,		/* OPEN (and STAT) sent */
+	BATCH_DATA,		/* reading or writing */
+	BATCH_CLOSING		/* CLOSE sent */
+};
+
+struct batch_file {
+	int upload;
+	char *local_path, *remote_path;
+	enum batch_state state;
+	int failed;
+	int eof;		/* no more data requests to send */
+	u_int pending;		/* requests in flight */
+	char *handle;
+	u_int handle_len;
+	int local_fd;
+	u_int64_t offset;	/* of the next data request */
+	u_int64_t data_end;	/* upload: end of the data run being sent */
+	Attrib a;		/* download: from STAT; upload: to set */
+	int have_attrib;
+	TAILQ_ENTRY(batch_file) tq;
+};
+
+struct batch_req {
+	u_int id;
+	u_int type;
+	struct batch_file *f;
+	u_int64_t offset;
+	u_int len;
+	double sent;
+	TAILQ_ENTRY(batch_req) tq;
+};
+
+struct sftp_batch {
+	struct sftp_conn *conn;
+	int pflag, fflag;
+	u_int nfiles, nactive, nfailed, ndata;
+	TAILQ_HEAD(, batch_file) waiting;
+	TAILQ_HEAD(, batch_file) active;
+	TAILQ_HEAD(, batch_req) reqs;
+	struct xfer_window w;
+	char *data;
+};
+
+struct sftp_batch *
+do_batch_init(struct sftp_conn *conn, int pflag, int fflag)
+{
+	struct sftp_batch *b;
+
+	b = xcalloc(1, sizeof(*b));
+	b->conn = conn;
+	b->pflag = pflag;
+	b->fflag = fflag;
+	TAILQ_INIT(&b->waiting);
+	TAILQ_INIT(&b->active);
+	TAILQ_INIT(&b->reqs);
+	return b;
+}
+
+static void
+batch_add(struct sftp_batch *b, int upload, char *local_path,
+    char *remote_path)
+{
+	struct batch_file *f;
+
+	f = xcalloc(1, sizeof(*f));
+	f->upload = upload;
+	f->local_path = xstrdup(local_path);
+	f->remote_path = xstrdup(remote_path);
+	f->state = BATCH_WAITING;
+	f->local_fd = -1;
+	TAILQ_INSERT_TAIL(&b->waiting, f, tq);
+	b->nfiles++;
+}
+
+void
+do_batch_download(struct sftp_batch *b, char *remote_path, char *local_path)
+{
+	batch_add(b, 0, local_path, remote_path);
+}
+
+void
+do_batch_upload(struct sftp_batch *b, char *local_path, char *remote_path)
+{
+	batch_add(b, 1, local_path, remote_path);
+}
+
+static struct batch_req *
+batch_req(struct sftp_batch *b, struct batch_file *f, u_int type)
+{
+	struct batch_req *r;
+
+	r = xcalloc(1, sizeof(*r));
+	r->id = b->conn->msg_id++;
+	r->type = type;
+	r->f = f;
+	r->sent = window_now();
+	TAILQ_INSERT_TAIL(&b->reqs, r, tq);
+	f->pending++;
+	return r;
+}
+
+static void
+batch_close(struct sftp_batch *b, struct batch_file *f)
+{
+	struct batch_req *r;
+	Buffer msg;
+	Attrib a;
+
+	f->state = BATCH_CLOSING;
+	if (f->handle == NULL)
+		return;
+	/* a hole at the end of a sparse file is made by extending it */
+	if (f->upload && !f->failed && !interrupted && f->offset < f->a.size) {
+		attrib_clear(&a);
+		a.flags |= SSH2_FILEXFER_ATTR_SIZE;
+		a.size = f->a.size;
+		r = batch_req(b, f, SSH2_FXP_FSETSTAT);
+		r->len = 1;	/* the file is incomplete if this fails */
+		send_string_attrs_request(b->conn->fd_out, r->id,
+		    SSH2_FXP_FSETSTAT, f->handle, f->handle_len, &a);
+	}
+	if (f->upload && b->pflag && !f->failed) {
+		r = batch_req(b, f, SSH2_FXP_FSETSTAT);
+		send_string_attrs_request(b->conn->fd_out, r->id,
+		    SSH2_FXP_FSETSTAT, f->handle, f->handle_len, &f->a);
+	}
+	if (f->upload && b->fflag && !f->failed) {
+		if (b->conn->exts & SFTP_EXT_FSYNC) {
+			r = batch_req(b, f, SSH2_FXP_EXTENDED);
+			buffer_init(&msg);
+			buffer_put_char(&msg, SSH2_FXP_EXTENDED);
+			buffer_put_int(&msg, r->id);
+			buffer_put_cstring(&msg, "fsync@openssh.com");
+			buffer_put_string(&msg, f->handle, f->handle_len);
+			send_msg(b->conn->fd_out, &msg);
+			buffer_free(&msg);
+			debug3("Sent message fsync@openssh.com I:%u", r->id);
+		} else {
+			error("Server does not support fsync@openssh.com "
+			    "extension");
+			f->failed = 1;
+		}
+	}
+	r = batch_req(b, f, SSH2_FXP_CLOSE);
+	send_string_request(b->conn->fd_out, r->id, SSH2_FXP_CLOSE,
+	    f->handle, f->handle_len);
+	debug3("Sent message SSH2_FXP_CLOSE I:%u", r->id);
+}
+
+/* All replies are in: tidy up locally. */
+static void
+batch_finish(struct sftp_batch *b, struct batch_file *f)
+{
+	u_int mode;
+
+	if (!f->upload && f->local_fd != -1 && !f->failed && b->pflag) {
+		mode = (f->a.flags & SSH2_FILEXFER_ATTR_PERMISSIONS) ?
+		    f->a.perm & 0777 : 0666;
+#ifdef HAVE_FCHMOD
+		if (fchmod(f->local_fd, mode) == -1)
+#else
+		if (chmod(f->local_path, mode) == -1)
+#endif /* HAVE_FCHMOD */
+			error("Couldn't set mode on \"%s\": %s",
+			    f->local_path, strerror(errno));
+		if (f->a.flags & SSH2_FILEXFER_ATTR_ACMODTIME) {
+			struct timeval tv[2];
+			tv[0].tv_sec = f->a.atime;
+			tv[1].tv_sec = f->a.mtime;
+			tv[0].tv_usec = tv[1].tv_usec = 0;
+			if (utimes(f->local_path, tv) == -1)
+				error("Can't set times on \"%s\": %s",
+				    f->local_path, strerror(errno));
+		}
+	}
+	if (!f->upload && f->local_fd != -1 && !f->failed && b->fflag &&
+	    fsync(f->local_fd) == -1) {
+		error("Couldn't sync file \"%s\": %s", f->local_path,
+		    strerror(errno));
+		f->failed = 1;
+	}
+	if (f->local_fd != -1 && close(f->local_fd) == -1 && f->upload) {
+		error("Couldn't close local file \"%s\": %s",
+		    f->local_path, strerror(errno));
+		f->failed = 1;
+	}
+	f->local_fd = -1;
+	if (f->failed)
+		b->nfailed++;
+	if (f->handle != NULL)
+		xfree(f->handle);
+	TAILQ_REMOVE(&b->active, f, tq);
+	b->nactive--;
+	xfree(f->local_path);
+	xfree(f->remote_path);
+	xfree(f);
+}
+
+static void
+batch_start(struct sftp_batch *b, struct batch_file *f)
+{
+	struct batch_req *r;
+	struct stat sb;
+
+	TAILQ_INSERT_TAIL(&b->active, f, tq);
+	b->nactive++;
+	f->state = BATCH_OPENING;
+	if (!f->upload) {
+		r = batch_req(b, f, SSH2_FXP_STAT);
+		send_string_request(b->conn->fd_out, r->id,
+		    b->conn->version == 0 ? SSH2_FXP_STAT_VERSION_0 :
+		    SSH2_FXP_STAT, f->remote_path, strlen(f->remote_path));
+		r = batch_req(b, f, SSH2_FXP_OPEN);
+		send_open_request(b->conn->fd_out, r->id, f->remote_path,
+		    SSH2_FXF_READ, NULL);
+		debug3("Sent message SSH2_FXP_OPEN I:%u P:%s", r->id,
+		    f->remote_path);
+		return;
+	}
+
+	if ((f->local_fd = open(f->local_path, O_RDONLY, 0)) == -1) {
+		error("Couldn't open local file \"%s\" for reading: %s",
+		    f->local_path, strerror(errno));
+		goto fail;
+	}
+	if (fstat(f->local_fd, &sb) == -1) {
+		error("Couldn't fstat local file \"%s\": %s",
+		    f->local_path, strerror(errno));
+		goto fail;
+	}
+	if (!S_ISREG(sb.st_mode)) {
+		error("%s is not a regular file", f->local_path);
+		goto fail;
+	}
+	stat_to_attrib(&sb, &f->a);
+	f->a.flags &= ~SSH2_FILEXFER_ATTR_SIZE;
+	f->a.flags &= ~SSH2_FILEXFER_ATTR_UIDGID;
+	f->a.perm &= 0777;
+	if (!b->pflag)
+		f->a.flags &= ~SSH2_FILEXFER_ATTR_ACMODTIME;
+	r = batch_req(b, f, SSH2_FXP_OPEN);
+	send_open_request(b->conn->fd_out, r->id, f->remote_path,
+	    SSH2_FXF_WRITE|SSH2_FXF_CREAT|SSH2_FXF_TRUNC, &f->a);
+	debug3("Sent message SSH2_FXP_OPEN I:%u P:%s", r->id, f->remote_path);
+	return;
+
+ fail:
+	f->failed = 1;
+	batch_finish(b, f);
+}
+
+/* Move a file along once its outstanding requests allow it. */
+static void
+batch_check(struct sftp_batch *b, struct batch_file *f)
+{
+	if (f->state == BATCH_DATA && f->eof && f->pending == 0)
+		batch_close(b, f);
+	if (f->state == BATCH_CLOSING && f->pending == 0)
+		batch_finish(b, f);
+}
+
+/* The OPEN (and for a download, STAT) replies are in. */
+static void
+batch_opened(struct sftp_batch *b, struct batch_file *f)
+{
+	u_int mode;
+
+	if (!f->failed && !f->upload) {
+		mode = (f->a.flags & SSH2_FILEXFER_ATTR_PERMISSIONS) ?
+		    f->a.perm & 0777 : 0666;
+		f->local_fd = open(f->local_path, O_WRONLY | O_CREAT | O_TRUNC,
+		    mode | S_IWRITE);
+		if (f->local_fd == -1) {
+			error("Couldn't open local file \"%s\" for writing: %s",
+			    f->local_path, strerror(errno));
+			f->failed = 1;
+		}
+	}
+	if (f->failed)
+		batch_close(b, f);
+	else
+		f->state = BATCH_DATA;
+}
+
+/* Send data requests for the open files, oldest first. */
+static void
+batch_fill(struct sftp_batch *b)
+{
+	struct batch_file *f, *next;
+	struct batch_req *r;
+	Buffer msg;
+	int len;
+
+	for (f = TAILQ_FIRST(&b->active); f != NULL; f = next) {
+		next = TAILQ_NEXT(f, tq);
+		if (f->state != BATCH_DATA)
+			continue;
+		if (interrupted)
+			f->eof = 1;
+		while (!f->eof && b->ndata < b->w.num_req) {
+			if (!f->upload) {
+				/* one request at a time after the expected EOF */
+				if ((f->a.flags & SSH2_FILEXFER_ATTR_SIZE) &&
+				    f->offset >= f->a.size && f->pending > 0)
+					break;
+				r = batch_req(b, f, SSH2_FXP_READ);
+				r->offset = f->offset;
+				r->len = b->w.buflen;
+				send_read_request(b->conn->fd_out, r->id,
+				    r->offset, r->len, f->handle, f->handle_len);
+			} else {
+				len = 0;
+				if (f->offset < f->data_end ||
+				    sparse_next(f->local_fd, &f->offset,
+				    &f->data_end)) {
+					do
+						len = read(f->local_fd, b->data,
+						    MIN(b->w.buflen,
+						    f->data_end - f->offset));
+					while (len == -1 &&
+					    (errno == EINTR || errno == EAGAIN));
+				}
+				if (len == -1)
+					fatal("Couldn't read from \"%s\": %s",
+					    f->local_path, strerror(errno));
+				if (len == 0) {
+					f->eof = 1;
+					break;
+				}
+				r = batch_req(b, f, SSH2_FXP_WRITE);
+				r->offset = f->offset;
+				r->len = len;
+				buffer_init(&msg);
+				buffer_put_char(&msg, SSH2_FXP_WRITE);
+				buffer_put_int(&msg, r->id);
+				buffer_put_string(&msg, f->handle,
+				    f->handle_len);
+				buffer_put_int64(&msg, r->offset);
+				buffer_put_string(&msg, b->data, len);
+				send_msg(b->conn->fd_out, &msg);
+				buffer_free(&msg);
+			}
+			debug3("Sent %s I:%u O:%llu S:%u for %s",
+			    f->upload ? "write" : "read", r->id,
+			    (unsigned long long)r->offset, r->len,
+			    f->remote_path);
+			f->offset += r->len;
+			b->ndata++;
+		}
+		batch_check(b, f);
+	}
+}
+
+/* Handle the reply to r, which has been taken off the queue. */
+static void
+batch_reply(struct sftp_batch *b, struct batch_req *r, u_int type,
+    Buffer *msg)
+{
+	struct batch_file *f = r->f;
+	u_int status = SSH2_FX_OK, len;
+	Attrib *a;
+	char *data;
+
+	if (type == SSH2_FXP_STATUS)
+		status = buffer_get_int(msg);
+
+	switch (r->type) {
+	case SSH2_FXP_STAT:
+		if (type == SSH2_FXP_STATUS) {
+			error("Couldn't stat remote file: %s", fx2txt(status));
+			f->failed = 1;
+			break;
+		} else if (type != SSH2_FXP_ATTRS)
+			fatal("Expected SSH2_FXP_ATTRS(%u) packet, got %u",
+			    SSH2_FXP_ATTRS, type);
+		a = decode_attrib(msg);
+		f->a = *a;
+		if ((f->a.flags & SSH2_FILEXFER_ATTR_PERMISSIONS) &&
+		    !S_ISREG(f->a.perm)) {
+			error("Cannot download non-regular file: %s",
+			    f->remote_path);
+			f->failed = 1;
+		}
+		break;
+	case SSH2_FXP_OPEN:
+		if (type == SSH2_FXP_STATUS) {
+			error("Couldn't get handle: %s", fx2txt(status));
+			f->failed = 1;
+			break;
+		} else if (type != SSH2_FXP_HANDLE)
+			fatal("Expected SSH2_FXP_HANDLE(%u) packet, got %u",
+			    SSH2_FXP_HANDLE, type);
+		f->handle = buffer_get_string(msg, &f->handle_len);
+		break;
+	case SSH2_FXP_READ:
+		b->ndata--;
+		if (type == SSH2_FXP_STATUS) {
+			if (status != SSH2_FX_EOF && !f->failed) {
+				error("Couldn't read from remote file "
+				    "\"%s\" : %s", f->remote_path,
+				    fx2txt(status));
+				f->failed = 1;
+			}
+			f->eof = 1;
+			break;
+		} else if (type != SSH2_FXP_DATA)
+			fatal("Expected SSH2_FXP_DATA(%u) packet, got %u",
+			    SSH2_FXP_DATA, type);
+		data = buffer_get_string(msg, &len);
+		if (len > r->len)
+			fatal("Received more data than asked for "
+			    "%u > %u", len, r->len);
+		if (!f->failed &&
+		    (lseek(f->local_fd, r->offset, SEEK_SET) == -1 ||
+		    atomicio(vwrite, f->local_fd, data, len) != len)) {
+			error("Couldn't write to \"%s\": %s", f->local_path,
+			    strerror(errno));
+			f->failed = f->eof = 1;
+		}
+		xfree(data);
+		window_reply(&b->w, r->sent, len);
+		if (len < r->len && !f->failed) {
+			/* Resend the request for the missing data */
+			if (!(f->a.flags & SSH2_FILEXFER_ATTR_SIZE) ||
+			    r->offset + len < f->a.size)
+				window_limit(&b->w, len);
+			r->id = b->conn->msg_id++;
+			r->offset += len;
+			r->len -= len;
+			r->sent = window_now();
+			TAILQ_INSERT_TAIL(&b->reqs, r, tq);
+			f->pending++;
+			b->ndata++;
+			send_read_request(b->conn->fd_out, r->id, r->offset,
+			    r->len, f->handle, f->handle_len);
+			return;
+		}
+		break;
+	case SSH2_FXP_WRITE:
+		b->ndata--;
+		if (type != SSH2_FXP_STATUS)
+			fatal("Expected SSH2_FXP_STATUS(%d) packet, got %d",
+			    SSH2_FXP_STATUS, type);
+		if (status != SSH2_FX_OK) {
+			if (!f->failed)
+				error("Couldn't write to remote file "
+				    "\"%s\": %s", f->remote_path,
+				    fx2txt(status));
+			f->failed = f->eof = 1;
+			break;
+		}
+		window_reply(&b->w, r->sent, r->len);
+		break;
+	case SSH2_FXP_FSETSTAT:
+	case SSH2_FXP_EXTENDED:
+	case SSH2_FXP_CLOSE:
+		if (type != SSH2_FXP_STATUS)
+			fatal("Expected SSH2_FXP_STATUS(%u) packet, got %u",
+			    SSH2_FXP_STATUS, type);
+		if (status == SSH2_FX_OK)
+			break;
+		if (r->type == SSH2_FXP_FSETSTAT) {
+			error("Couldn't fsetstat: %s", fx2txt(status));
+			if (r->len != 0)
+				f->failed = 1;
+		} else if (r->type == SSH2_FXP_EXTENDED) {
+			error("Couldn't sync file: %s", fx2txt(status));
+			f->failed = 1;
+		} else {
+			error("Couldn't close file: %s", fx2txt(status));
+			f->failed = 1;
+		}
+		break;
+	}
+	xfree(r);
+
+	if (f->state == BATCH_OPENING && f->pending == 0)
+		batch_opened(b, f);
+}
+
+/*
+ * Run the queued transfers and free the batch.  Returns -1 if any file
+ * failed.
+ */
+int
+do_batch_run(struct sftp_batch *b)
+{
+	struct batch_file *f;
+	struct batch_req *r;
+	Buffer msg;
+	u_int type, id, nfiles = b->nfiles, limit, max = 0;
+	char what[32];
+	int ret;
+
+	/* requests are sized for both directions if the batch has both */
+	TAILQ_FOREACH(f, &b->waiting, tq) {
+		limit = f->upload ? b->conn->upload_max :
+		    b->conn->download_max;
+		if (limit != 0)
+			max = max == 0 ? limit : MIN(max, limit);
+	}
+	window_init(&b->w, b->conn, max);
+	b->data = xmalloc(b->w.max_buflen);
+	buffer_init(&msg);
+
+	for (;;) {
+		while (!interrupted && b->nactive < BATCH_FILES_MAX &&
+		    (f = TAILQ_FIRST(&b->waiting)) != NULL) {
+			TAILQ_REMOVE(&b->waiting, f, tq);
+			batch_start(b, f);
+		}
+		batch_fill(b);
+		if (TAILQ_EMPTY(&b->reqs))
+			break;
+
+		buffer_clear(&msg);
+		get_msg(b->conn->fd_in, &msg);
+		type = buffer_get_char(&msg);
+		id = buffer_get_int(&msg);
+		debug3("Received reply T:%u I:%u", type, id);
+
+		TAILQ_FOREACH(r, &b->reqs, tq)
+			if (r->id == id)
+				break;
+		if (r == NULL)
+			fatal("Unexpected reply %u", id);
+		TAILQ_REMOVE(&b->reqs, r, tq);
+		f = r->f;
+		f->pending--;
+		batch_reply(b, r, type, &msg);
+		batch_check(b, f);
+	}
+
+	/* Files not started because of an interrupt */
+	while ((f = TAILQ_FIRST(&b->waiting)) != NULL) {
+		TAILQ_REMOVE(&b->waiting, f, tq);
+		xfree(f->local_path);
+		xfree(f->remote_path);
+		xfree(f);
+	}
+	if (TAILQ_FIRST(&b->active) != NULL)
+		fatal("Transfer complete, but files still open");
+
+	snprintf(what, sizeof(what), "%u files", nfiles);
+	window_report(&b->w, what);
+	ret = b->nfailed > 0 ? -1 : 0;
+	buffer_free(&msg);
+	xfree(b->data);
+	xfree(b);
+	return ret;
+}
+
+/*
+ * Pipelined requests that answer with a status (or, for a STAT, with
+ * attributes).  Each request is sent as soon as it is queued; replies
+ * are matched to their request by id, either when PIPE_MAX requests
+ * are outstanding or in do_pipe_wait().  Failures are reported against
+ * the path they were for.
+ */
+#define PIPE_MAX	128
+
+struct pipe_req {
+	u_int id;
+	u_int type;
+	char *path, *path2;
+	Attrib *a;		/* STAT result */
+	int *okp;
+	TAILQ_ENTRY(pipe_req) tq;
+};
+
+struct sftp_pipe {
+	struct sftp_conn *conn;
+	u_int nreqs, nfailed;
+	TAILQ_HEAD(, pipe_req) reqs;
+};
+
+struct sftp_pipe *
+do_pipe_init(struct sftp_conn *conn)
+{
+	struct sftp_pipe *p;
+
+	p = xcalloc(1, sizeof(*p));
+	p->conn = conn;
+	TAILQ_INIT(&p->reqs);
+	return p;
+}
+
+/* Collect one reply. */
+static void
+pipe_reply(struct sftp_pipe *p)
+{
+	struct pipe_req *r;
+	Buffer msg;
+	u_int type, id, status = SSH2_FX_OK;
+	Attrib *a;
+
+	buffer_init(&msg);
+	get_msg(p->conn->fd_in, &msg);
+	type = buffer_get_char(&msg);
+	id = buffer_get_int(&msg);
+
+	TAILQ_FOREACH(r, &p->reqs, tq)
+		if (r->id == id)
+			break;
+	if (r == NULL)
+		fatal("Unexpected reply %u", id);
+	TAILQ_REMOVE(&p->reqs, r, tq);
+	p->nreqs--;
+
+	if (type == SSH2_FXP_STATUS)
+		status = buffer_get_int(&msg);
+	else if (type != SSH2_FXP_ATTRS || r->type != SSH2_FXP_STAT)
+		fatal("Expected SSH2_FXP_STATUS(%u) packet, got %u",
+		    SSH2_FXP_STATUS, type);
+	debug3("Pipelined reply T:%u I:%u S:%u", type, id, status);
+
+	if (type == SSH2_FXP_ATTRS) {
+		a = decode_attrib(&msg);
+		*r->a = *a;
+	} else if (status != SSH2_FX_OK) {
+		p->nfailed++;
+		switch (r->type) {
+		case SSH2_FXP_REMOVE:
+			error("Couldn't delete file \"%s\": %s", r->path,
+			    fx2txt(status));
+			break;
+		case SSH2_FXP_MKDIR:
+			error("Couldn't create directory \"%s\": %s", r->path,
+			    fx2txt(status));
+			break;
+		case SSH2_FXP_RMDIR:
+			error("Couldn't remove directory \"%s\": %s", r->path,
+			    fx2txt(status));
+			break;
+		case SSH2_FXP_SETSTAT:
+			error("Couldn't setstat on \"%s\": %s", r->path,
+			    fx2txt(status));
+			break;
+		case SSH2_FXP_RENAME:
+			error("Couldn't rename file \"%s\" to \"%s\": %s",
+			    r->path, r->path2, fx2txt(status));
+			break;
+		case SSH2_FXP_SYMLINK:
+			error("Couldn't symlink file \"%s\" to \"%s\": %s",
+			    r->path, r->path2, fx2txt(status));
+			break;
+		case SSH2_FXP_STAT:
+			error("Couldn't stat remote file \"%s\": %s", r->path,
+			    fx2txt(status));
+			break;
+		}
+	}
+	if (r->okp != NULL)
+		*r->okp = type == SSH2_FXP_ATTRS || status == SSH2_FX_OK;
+	buffer_free(&msg);
+	xfree(r->path);
+	if (r->path2 != NULL)
+		xfree(r->path2);
+	xfree(r);
+}
+
+static struct pipe_req *
+pipe_req(struct sftp_pipe *p, u_int type, char *path, char *path2)
+{
+	struct pipe_req *r;
+
+	while (p->nreqs >= PIPE_MAX)
+		pipe_reply(p);
+	r = xcalloc(1, sizeof(*r));
+	r->id = p->conn->msg_id++;
+	r->type = type;
+	r->path = xstrdup(path);
+	r->path2 = path2 == NULL ? NULL : xstrdup(path2);
+	TAILQ_INSERT_TAIL(&p->reqs, r, tq);
+	p->nreqs++;
+	return r;
+}
+
+void
+do_pipe_rm(struct sftp_pipe *p, char *path)
+{
+	struct pipe_req *r = pipe_req(p, SSH2_FXP_REMOVE, path, NULL);
+
+	send_string_request(p->conn->fd_out, r->id, SSH2_FXP_REMOVE, path,
+	    strlen(path));
+}
+
+void
+do_pipe_mkdir(struct sftp_pipe *p, char *path, Attrib *a)
+{
+	struct pipe_req *r = pipe_req(p, SSH2_FXP_MKDIR, path, NULL);
+
+	send_string_attrs_request(p->conn->fd_out, r->id, SSH2_FXP_MKDIR,
+	    path, strlen(path), a);
+}
+
+void
+do_pipe_rmdir(struct sftp_pipe *p, char *path)
+{
+	struct pipe_req *r = pipe_req(p, SSH2_FXP_RMDIR, path, NULL);
+
+	send_string_request(p->conn->fd_out, r->id, SSH2_FXP_RMDIR, path,
+	    strlen(path));
+}
+
+void
+do_pipe_setstat(struct sftp_pipe *p, char *path, Attrib *a)
+{
+	struct pipe_req *r = pipe_req(p, SSH2_FXP_SETSTAT, path, NULL);
+
+	send_string_attrs_request(p->conn->fd_out, r->id, SSH2_FXP_SETSTAT,
+	    path, strlen(path), a);
+}
+
+/* Fill in 'a' with the attributes of 'path'; '*okp' says if it worked. */
+void
+do_pipe_stat(struct sftp_pipe *p, char *path, Attrib *a, int *okp)
+{
+	struct pipe_req *r = pipe_req(p, SSH2_FXP_STAT, path, NULL);
+
+	r->a = a;
+	r->okp = okp;
+	*okp = 0;
+	send_string_request(p->conn->fd_out, r->id,
+	    p->conn->version == 0 ? SSH2_FXP_STAT_VERSION_0 : SSH2_FXP_STAT,
+	    path, strlen(path));
+}
+
+static void
+pipe_two_paths(struct sftp_pipe *p, u_int type, char *path1, char *path2)
+{
+	struct pipe_req *r = pipe_req(p, type, path1, path2);
+	Buffer msg;
+
+	buffer_init(&msg);
+	buffer_put_char(&msg, type);
+	buffer_put_int(&msg, r->id);
+	buffer_put_cstring(&msg, path1);
+	buffer_put_cstring(&msg, path2);
+	send_msg(p->conn->fd_out, &msg);
+	buffer_free(&msg);
+}
+
+void
+do_pipe_rename(struct sftp_pipe *p, char *oldpath, char *newpath)
+{
+	pipe_two_paths(p, SSH2_FXP_RENAME, oldpath, newpath);
+}
+
+void
+do_pipe_symlink(struct sftp_pipe *p, char *oldpath, char *newpath)
+{
+	if (p->conn->version < 3) {
+		error("This server does not support the symlink operation");
+		p->nfailed++;
+		return;
+	}
+	pipe_two_paths(p, SSH2_FXP_SYMLINK, oldpath, newpath);
+}
+
+/* Number of requests that have failed so far. */
+u_int
+do_pipe_failed(struct sftp_pipe *p)
+{
+	return p->nfailed;
+}
+
+/*
+ * Collect all outstanding replies.  Returns -1 if any request failed
+ * since the last call, 0 otherwise.
+ */
+int
+do_pipe_wait(struct sftp_pipe *p)
+{
+	int ret;
+
+	while (p->nreqs > 0)
+		pipe_reply(p);
+	ret = p->nfailed > 0 ? -1 : 0;
+	p->nfailed = 0;
+	return ret;
+}
+
+void
+do_pipe_free(struct sftp_pipe *p)
+{
+	do_pipe_wait(p);
+	xfree(p);
+}
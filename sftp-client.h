@@ -29,6 +29,24 @@ struct SFTP_DIRENT {
 	Attrib a;
 };
 
+/*
+ * Used for statvfs responses on the wire from the server, because the
+ * server's native format may be larger than the client's.
+ */
+struct sftp_statvfs {
+	u_int64_t f_bsize;
+	u_int64_t f_frsize;
+	u_int64_t f_blocks;
+	u_int64_t f_bfree;
+	u_int64_t f_bavail;
+	u_int64_t f_files;
+	u_int64_t f_ffree;
+	u_int64_t f_favail;
+	u_int64_t f_fsid;
+	u_int64_t f_flag;
+	u_int64_t f_namemax;
+};
+
 /*
  * Initialise a SSH filexfer connection. Returns NULL on error or
  * a pointer to a initialized sftp_conn struct on success.
@@ -37,6 +55,9 @@ struct sftp_conn *do_init(int, int, u_int, u_int);
 
 u_int sftp_proto_version(struct sftp_conn *);
 
+/* Number of requests sent over the connection so far */
+u_int sftp_request_count(struct sftp_conn *);
+
 /* Close file referred to by 'handle' */
 int do_close(struct sftp_conn *, char *, u_int);
 
@@ -82,18 +103,58 @@ int do_symlink(struct sftp_conn *, char *, char *);
 /* Return target of symlink 'path' - caller must free result */
 char *do_readlink(struct sftp_conn *, char *);
 
+/* Get statistics for filesystem hosting file at "path" */
+int do_statvfs(struct sftp_conn *, char *, struct sftp_statvfs *, int);
+
+/* Flush the data of open file 'handle' to disk */
+int do_fsync(struct sftp_conn *, char *, u_int);
+
+/* Copy remote 'oldpath' to 'newpath' without moving the data */
+int do_copy(struct sftp_conn *, char *, char *);
+
 /* XXX: add callbacks to do_download/do_upload so we can do progress meter */
 
 /*
  * Download 'remote_path' to 'local_path'. Preserve permissions and times
- * if 'pflag' is set
+ * if 'pflag' is set, flush the file to disk if 'fflag' is set, resume a
+ * partial download if 'aflag' is set
  */
-int do_download(struct sftp_conn *, char *, char *, int);
+int do_download(struct sftp_conn *, char *, char *, int, int, int);
 
 /*
  * Upload 'local_path' to 'remote_path'. Preserve permissions and times
- * if 'pflag' is set
+ * if 'pflag' is set, flush the file to disk if 'fflag' is set, resume a
+ * partial upload if 'aflag' is set.  Holes in sparse files are skipped
+ */
+int do_upload(struct sftp_conn *, char *, char *, int, int, int);
+
+/*
+ * Transfer several files at once.  Files queued on a batch with
+ * do_batch_download() and do_batch_upload() are transferred together
+ * over the connection by do_batch_run(), which frees the batch and
+ * returns -1 if any of them failed.  Permissions and times are preserved
+ * if 'pflag' is set, and files are flushed to disk if 'fflag' is set.
+ */
+struct sftp_batch *do_batch_init(struct sftp_conn *, int, int);
+void do_batch_download(struct sftp_batch *, char *, char *);
+void do_batch_upload(struct sftp_batch *, char *, char *);
+int do_batch_run(struct sftp_batch *);
+
+/*
+ * Pipelined metadata requests.  Each is sent when queued and its status
+ * collected later; do_pipe_wait() waits for all of them and returns -1
+ * if any failed since it was last called.
  */
-int do_upload(struct sftp_conn *, char *, char *, int);
+struct sftp_pipe *do_pipe_init(struct sftp_conn *);
+void do_pipe_rm(struct sftp_pipe *, char *);
+void do_pipe_mkdir(struct sftp_pipe *, char *, Attrib *);
+void do_pipe_rmdir(struct sftp_pipe *, char *);
+void do_pipe_setstat(struct sftp_pipe *, char *, Attrib *);
+void do_pipe_stat(struct sftp_pipe *, char *, Attrib *, int *);
+void do_pipe_rename(struct sftp_pipe *, char *, char *);
+void do_pipe_symlink(struct sftp_pipe *, char *, char *);
+u_int do_pipe_failed(struct sftp_pipe *);
+int do_pipe_wait(struct sftp_pipe *);
+void do_pipe_free(struct sftp_pipe *);
 
 #endif
@@ -182,26 +182,48 @@ fx2txt(int status)
 
 /*
  * drwxr-xr-x    5 markus   markus       1024 Jan 13 18:39 .ssh
+ *
+ * ls_file_buf() formats into buf and returns the length of the result;
+ * ls_file() returns an allocated copy.
  */
-char *
-ls_file(const char *name, const struct stat *st, int remote)
+size_t
+ls_file_buf(char *buf, size_t len, const char *name, const struct stat *st,
+    int remote)
 {
-	int ulen, glen, sz = 0;
+	static uid_t last_uid = (uid_t)-1;
+	static gid_t last_gid = (gid_t)-1;
+	static char last_user[64], last_group[64];
+	int ulen, glen, sz = 0, r;
 	struct passwd *pw;
 	struct group *gr;
 	struct tm *ltime = localtime(&st->st_mtime);
 	char *user, *group;
-	char buf[1024], mode[11+1], tbuf[12+1], ubuf[11+1], gbuf[11+1];
+	char mode[11+1], tbuf[12+1], ubuf[11+1], gbuf[11+1];
 
 	strmode(st->st_mode, mode);
-	if (!remote && (pw = getpwuid(st->st_uid)) != NULL) {
-		user = pw->pw_name;
+	if (remote) {
+		snprintf(ubuf, sizeof ubuf, "%u", (u_int)st->st_uid);
+		user = ubuf;
+	} else if (st->st_uid == last_uid) {
+		user = last_user;
+	} else if ((pw = getpwuid(st->st_uid)) != NULL) {
+		/* a directory's entries mostly share an owner */
+		strlcpy(last_user, pw->pw_name, sizeof last_user);
+		last_uid = st->st_uid;
+		user = last_user;
 	} else {
 		snprintf(ubuf, sizeof ubuf, "%u", (u_int)st->st_uid);
 		user = ubuf;
 	}
-	if (!remote && (gr = getgrgid(st->st_gid)) != NULL) {
-		group = gr->gr_name;
+	if (remote) {
+		snprintf(gbuf, sizeof gbuf, "%u", (u_int)st->st_gid);
+		group = gbuf;
+	} else if (st->st_gid == last_gid) {
+		group = last_group;
+	} else if ((gr = getgrgid(st->st_gid)) != NULL) {
+		strlcpy(last_group, gr->gr_name, sizeof last_group);
+		last_gid = st->st_gid;
+		group = last_group;
 	} else {
 		snprintf(gbuf, sizeof gbuf, "%u", (u_int)st->st_gid);
 		group = gbuf;
@@ -216,8 +238,19 @@ ls_file(const char *name, const struct stat *st, int remote)
 		tbuf[0] = '\0';
 	ulen = MAX(strlen(user), 8);
 	glen = MAX(strlen(group), 8);
-	snprintf(buf, sizeof buf, "%s %3u %-*s %-*s %8llu %s %s", mode,
+	r = snprintf(buf, len, "%s %3u %-*s %-*s %8llu %s %s", mode,
 	    (u_int)st->st_nlink, ulen, user, glen, group,
 	    (unsigned long long)st->st_size, tbuf, name);
+	if (r < 0)
+		r = 0;
+	return MIN((size_t)r, len - 1);
+}
+
+char *
+ls_file(const char *name, const struct stat *st, int remote)
+{
+	char buf[1024];
+
+	ls_file_buf(buf, sizeof buf, name, st, remote);
 	return xstrdup(buf);
 }
@@ -47,5 +47,6 @@ void	 attrib_to_stat(const Attrib *, struct stat *);
 Attrib	*decode_attrib(Buffer *);
 void	 encode_attrib(Buffer *, const Attrib *);
 char	*ls_file(const char *, const struct stat *, int);
+size_t	 ls_file_buf(char *, size_t, const char *, const struct stat *, int);
 
 const char *fx2txt(int);
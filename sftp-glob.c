@@ -23,6 +23,7 @@
 #endif
 
 #include <dirent.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "xmalloc.h"
@@ -39,22 +40,109 @@ struct SFTP_OPENDIR {
 	int offset;
 };
 
+/*
+ * Listings fetched during one remote_glob().  glob() lstat()s each match
+ * after reading its directory: the attributes that came with the listing
+ * answer that without another round trip per file.
+ */
+struct glob_dir {
+	char *path;
+	SFTP_DIRENT **dir;	/* sorted by filename */
+	u_int n;
+};
+
 static struct {
 	struct sftp_conn *conn;
+	struct glob_dir *dirs;
+	u_int ndirs;
 } cur;
 
+static int
+dirent_cmp(const void *a, const void *b)
+{
+	return strcmp((*(SFTP_DIRENT * const *)a)->filename,
+	    (*(SFTP_DIRENT * const *)b)->filename);
+}
+
+/* The first len bytes of path as a directory name, for lookups. */
+static char *
+dir_key(const char *path, size_t len)
+{
+	char *key;
+
+	while (len > 1 && path[len - 1] == '/')
+		len--;
+	if (len == 0)
+		return xstrdup(".");
+	key = xmalloc(len + 1);
+	memcpy(key, path, len);
+	key[len] = '\0';
+	return key;
+}
+
+static struct glob_dir *
+dir_find(const char *key)
+{
+	u_int i;
+
+	for (i = 0; i < cur.ndirs; i++)
+		if (strcmp(cur.dirs[i].path, key) == 0)
+			return &cur.dirs[i];
+	return NULL;
+}
+
+/* Attributes of path from a listing of its directory, if we have one. */
+static Attrib *
+dir_lookup(const char *path)
+{
+	struct glob_dir *d;
+	SFTP_DIRENT key, *keyp = &key, **found;
+	const char *name;
+	char *dir;
+
+	if ((name = strrchr(path, '/')) == NULL) {
+		dir = xstrdup(".");
+		name = path;
+	} else {
+		dir = dir_key(path, name == path ? 1 : (size_t)(name - path));
+		name++;
+	}
+	d = dir_find(dir);
+	xfree(dir);
+	if (d == NULL || *name == '\0')
+		return NULL;
+	key.filename = (char *)name;
+	found = bsearch(&keyp, d->dir, d->n, sizeof(*d->dir), dirent_cmp);
+	return found == NULL ? NULL : &(*found)->a;
+}
+
 static void *
 fudge_opendir(const char *path)
 {
 	struct SFTP_OPENDIR *r;
+	struct glob_dir *d;
+	SFTP_DIRENT **dir;
+	char *key;
+
+	key = dir_key(path, strlen(path));
+	if ((d = dir_find(key)) == NULL) {
+		if (do_readdir(cur.conn, (char *)path, &dir)) {
+			xfree(key);
+			return(NULL);
+		}
+		cur.dirs = xrealloc(cur.dirs, cur.ndirs + 1,
+		    sizeof(*cur.dirs));
+		d = &cur.dirs[cur.ndirs++];
+		d->path = key;
+		d->dir = dir;
+		for (d->n = 0; dir[d->n] != NULL; d->n++)
+			;
+		qsort(d->dir, d->n, sizeof(*d->dir), dirent_cmp);
+	} else
+		xfree(key);
 
 	r = xmalloc(sizeof(*r));
-
-	if (do_readdir(cur.conn, (char *)path, &r->dir)) {
-		xfree(r);
-		return(NULL);
-	}
-
+	r->dir = d->dir;
 	r->offset = 0;
 
 	return((void *)r);
@@ -102,7 +190,7 @@ fudge_readdir(struct SFTP_OPENDIR *od)
 static void
 fudge_closedir(struct SFTP_OPENDIR *od)
 {
-	free_sftp_dirents(od->dir);
+	/* the listing stays cached until remote_glob() returns */
 	xfree(od);
 }
 
@@ -111,7 +199,8 @@ fudge_lstat(const char *path, struct stat *st)
 {
 	Attrib *a;
 
-	if (!(a = do_lstat(cur.conn, (char *)path, 0)))
+	if ((a = dir_lookup(path)) == NULL &&
+	    (a = do_lstat(cur.conn, (char *)path, 0)) == NULL)
 		return(-1);
 
 	attrib_to_stat(a, st);
@@ -124,7 +213,11 @@ fudge_stat(const char *path, struct stat *st)
 {
 	Attrib *a;
 
-	if (!(a = do_stat(cur.conn, (char *)path, 0)))
+	/* a listing has lstat() attributes: only good if not a symlink */
+	if ((a = dir_lookup(path)) == NULL ||
+	    !(a->flags & SSH2_FILEXFER_ATTR_PERMISSIONS) || S_ISLNK(a->perm))
+		a = do_stat(cur.conn, (char *)path, 0);
+	if (a == NULL)
 		return(-1);
 
 	attrib_to_stat(a, st);
@@ -136,6 +229,9 @@ int
 remote_glob(struct sftp_conn *conn, const char *pattern, int flags,
     int (*errfunc)(const char *, int), glob_t *pglob)
 {
+	int r;
+	u_int i;
+
 	pglob->gl_opendir = fudge_opendir;
 	pglob->gl_readdir = (struct dirent *(*)(void *))fudge_readdir;
 	pglob->gl_closedir = (void (*)(void *))fudge_closedir;
@@ -145,5 +241,14 @@ remote_glob(struct sftp_conn *conn, const char *pattern, int flags,
 	memset(&cur, 0, sizeof(cur));
 	cur.conn = conn;
 
-	return(glob(pattern, flags | GLOB_ALTDIRFUNC, errfunc, pglob));
+	r = glob(pattern, flags | GLOB_ALTDIRFUNC, errfunc, pglob);
+
+	for (i = 0; i < cur.ndirs; i++) {
+		xfree(cur.dirs[i].path);
+		free_sftp_dirents(cur.dirs[i].dir);
+	}
+	if (cur.dirs != NULL)
+		xfree(cur.dirs);
+	memset(&cur, 0, sizeof(cur));
+	return(r);
 }
@@ -0,0 +1,261 @@
+/*
+ * Placed in the public domain.
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+#include "openbsd-compat/sys-queue.h"
+
+#include <openssl/evp.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+#include <signal.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "log.h"
+#include "misc.h"
+#include "sftp-server-io.h"
+
+/*
+ * Requests are queued on "todo" for the workers and on "done" once they
+ * have finished.  A byte is written to the notify pipe for each finished
+ * request so the main loop's select() wakes up.  The workers only do
+ * file I/O: memory, logging and replies stay with the main thread.
+ */
+static TAILQ_HEAD(, SftpIo) todo = TAILQ_HEAD_INITIALIZER(todo);
+static TAILQ_HEAD(, SftpIo) done = TAILQ_HEAD_INITIALIZER(done);
+static u_int nworkers = 0;
+static int notify[2] = { -1, -1 };
+
+#ifdef HAVE_PTHREAD
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work = PTHREAD_COND_INITIALIZER;
+#endif
+
+/*
+ * Copy up to len bytes between two files, in the kernel where it can be
+ * done.  Returns the number of bytes copied, 0 at end of file or -1.
+ */
+static ssize_t
+copy_range(int in, u_int64_t ioff, int out, u_int64_t ooff, size_t len,
+    char *buf, size_t buflen)
+{
+	ssize_t n, w, done;
+#ifdef HAVE_COPY_FILE_RANGE
+	off_t ro = ioff, wo = ooff;
+
+	n = copy_file_range(in, &ro, out, &wo, len, 0);
+	if (n >= 0 || (errno != ENOSYS && errno != EXDEV && errno != EINVAL
+# ifdef EOPNOTSUPP
+	    && errno != EOPNOTSUPP
+# endif
+	    ))
+		return n;
+#endif
+	if ((n = pread(in, buf, MIN(len, buflen), ioff)) <= 0)
+		return n;
+	for (done = 0; done < n; done += w)
+		if ((w = pwrite(out, buf + done, n - done, ooff + done)) == -1)
+			return -1;
+	return n;
+}
+
+static void
+sftp_io_copy(SftpIo *io)
+{
+	ssize_t n;
+
+	io->err = 0;
+	for (io->copied = 0; io->copied < io->total; io->copied += n) {
+		n = copy_range(io->fd, io->off + io->copied, io->ofd,
+		    io->ooff + io->copied,
+		    MIN(io->total - io->copied, 1024 * 1024 * 1024),
+		    io->buf, io->len);
+		if (n == -1 && errno == EINTR)
+			n = 0;
+		else if (n == -1) {
+			io->err = errno;
+			break;
+		} else if (n == 0)
+			break;		/* end of file */
+	}
+	io->ret = io->err != 0 ? -1 : 0;
+}
+
+static void
+sftp_io_hash(SftpIo *io)
+{
+	EVP_MD_CTX *ctx = io->mdctx;
+	u_int64_t left;
+	u_int dlen;
+	ssize_t n = 0;
+
+	io->err = 0;
+	io->copied = 0;
+	io->dlen = 0;
+	/* a file shorter than asked is hashed up to its end */
+	do {
+		EVP_DigestInit(ctx, io->md);
+		for (left = MIN(io->block, io->total - io->copied); left > 0;
+		    left -= n, io->copied += n) {
+			n = pread(io->fd, io->buf, MIN(left, io->len),
+			    io->off + io->copied);
+			if (n == -1 && errno == EINTR)
+				n = 0;
+			else if (n <= 0)
+				break;
+			else
+				EVP_DigestUpdate(ctx, io->buf, n);
+		}
+		EVP_DigestFinal(ctx, io->digests + io->dlen, &dlen);
+		io->dlen += dlen;
+	} while (n > 0 && io->copied < io->total);
+	if (n == -1)
+		io->err = errno;
+	io->ret = n == -1 ? -1 : 0;
+}
+
+static void
+sftp_io_run(SftpIo *io)
+{
+	if (io->op == SFTP_IO_COPY) {
+		sftp_io_copy(io);
+		return;
+	}
+	if (io->op == SFTP_IO_HASH) {
+		sftp_io_hash(io);
+		return;
+	}
+	do {
+		if (io->op == SFTP_IO_READ)
+			io->ret = pread(io->fd, io->buf, io->len, io->off);
+		else
+			io->ret = pwrite(io->fd, io->buf, io->len, io->off);
+	} while (io->ret == -1 && errno == EINTR);
+	io->err = io->ret == -1 ? errno : 0;
+}
+
+#ifdef HAVE_PTHREAD
+/* ARGSUSED */
+static void *
+sftp_io_worker(void *arg)
+{
+	SftpIo *io;
+
+	for (;;) {
+		pthread_mutex_lock(&lock);
+		while ((io = TAILQ_FIRST(&todo)) == NULL)
+			pthread_cond_wait(&work, &lock);
+		TAILQ_REMOVE(&todo, io, queue);
+		pthread_mutex_unlock(&lock);
+
+		sftp_io_run(io);
+
+		pthread_mutex_lock(&lock);
+		TAILQ_INSERT_TAIL(&done, io, queue);
+		pthread_mutex_unlock(&lock);
+		while (write(notify[1], "", 1) == -1 && errno == EINTR)
+			;
+	}
+	/* NOTREACHED */
+	return NULL;
+}
+#endif
+
+/*
+ * Start up to n worker threads.  With none, requests are run
+ * synchronously.
+ */
+void
+sftp_io_init(u_int n)
+{
+#ifdef HAVE_PTHREAD
+	pthread_t tid;
+	sigset_t set, oset;
+	u_int i;
+
+	if (n == 0)
+		return;
+	if (pipe(notify) == -1) {
+		error("%s: pipe: %s", __func__, strerror(errno));
+		return;
+	}
+	set_nonblock(notify[0]);
+	/* signals are for the main thread */
+	sigfillset(&set);
+	pthread_sigmask(SIG_BLOCK, &set, &oset);
+	for (i = 0; i < n; i++) {
+		if (pthread_create(&tid, NULL, sftp_io_worker, NULL) != 0) {
+			error("%s: pthread_create failed", __func__);
+			break;
+		}
+		pthread_detach(tid);
+	}
+	pthread_sigmask(SIG_SETMASK, &oset, NULL);
+	nworkers = i;
+	if (nworkers == 0) {
+		close(notify[0]);
+		close(notify[1]);
+		notify[0] = notify[1] = -1;
+	}
+	debug("%s: %u I/O threads", __func__, nworkers);
+#endif
+}
+
+/* Descriptor that becomes readable when requests have finished, or -1. */
+int
+sftp_io_fd(void)
+{
+	return notify[0];
+}
+
+void
+sftp_io_submit(SftpIo *io)
+{
+	if (nworkers == 0) {
+		sftp_io_run(io);
+		TAILQ_INSERT_TAIL(&done, io, queue);
+		return;
+	}
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&lock);
+	TAILQ_INSERT_TAIL(&todo, io, queue);
+	pthread_cond_signal(&work);
+	pthread_mutex_unlock(&lock);
+#endif
+}
+
+/* Returns a finished request, or NULL if none is ready yet. */
+SftpIo *
+sftp_io_done(void)
+{
+	SftpIo *io;
+#ifdef HAVE_PTHREAD
+	char buf[128];
+#endif
+
+	if (nworkers == 0) {
+		if ((io = TAILQ_FIRST(&done)) != NULL)
+			TAILQ_REMOVE(&done, io, queue);
+		return io;
+	}
+#ifdef HAVE_PTHREAD
+	/* any completion signalled after this is found by the next call */
+	while (read(notify[0], buf, sizeof(buf)) > 0)
+		;
+	pthread_mutex_lock(&lock);
+	if ((io = TAILQ_FIRST(&done)) != NULL)
+		TAILQ_REMOVE(&done, io, queue);
+	pthread_mutex_unlock(&lock);
+	return io;
+#else
+	return NULL;
+#endif
+}
@@ -0,0 +1,59 @@
+/*
+ * Placed in the public domain.
+ */
+
+#ifndef SFTP_SERVER_IO_H
+#define SFTP_SERVER_IO_H
+
+/*
+ * File I/O engine for sftp-server.  READ and WRITE requests are run by a
+ * pool of threads with pread(2)/pwrite(2) and handed back to the main
+ * loop as they complete, so one slow request does not hold up the
+ * others.  So are whole copy-data and check-file requests (SFTP_IO_COPY,
+ * SFTP_IO_HASH), which may take far longer.  Without thread support they
+ * run inside sftp_io_submit().
+ */
+
+#define SFTP_IO_READ	1
+#define SFTP_IO_WRITE	2
+#define SFTP_IO_COPY	3
+#define SFTP_IO_HASH	4
+
+typedef struct SftpIo SftpIo;
+struct SftpIo {
+	int		 op;
+	u_int32_t	 id;		/* request id */
+	int		 handle;
+	int		 fd;
+	u_int64_t	 off;
+	u_int		 len;
+	char		*buf;
+	ssize_t		 ret;		/* result of pread/pwrite */
+	int		 err;		/* errno if ret is -1 */
+	/* SFTP_IO_COPY: len bytes of buf are a bounce buffer */
+	int		 ohandle;
+	int		 ofd;
+	u_int64_t	 ooff;
+	u_int64_t	 total;		/* copy this much, or to EOF */
+	u_int64_t	 copied;	/* result; err is set if short */
+	/* SFTP_IO_HASH: one digest per 'block' of 'total' bytes */
+	const void	*md;		/* EVP_MD */
+	void		*mdctx;		/* EVP_MD_CTX */
+	const char	*mdname;
+	u_int64_t	 block;
+	u_char		*digests;
+	u_int		 dmax;		/* room in digests */
+	u_int		 dlen;		/* result: bytes of digests */
+	TAILQ_ENTRY(SftpIo) queue;	/* engine queues */
+	/* for the caller */
+	TAILQ_ENTRY(SftpIo) next;
+	u_int64_t	 at;
+	u_int		 sent;
+};
+
+void	 sftp_io_init(u_int);
+void	 sftp_io_submit(SftpIo *);
+SftpIo	*sftp_io_done(void);
+int	 sftp_io_fd(void);
+
+#endif				/* SFTP_SERVER_IO_H */
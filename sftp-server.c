@@ -20,6 +20,11 @@
 #include <sys/types.h>
 #include <sys/param.h>
 #include <sys/stat.h>
+#ifdef HAVE_SYS_STATVFS_H
+#include <sys/statvfs.h>
+#endif
+#include <sys/uio.h>
+#include "openbsd-compat/sys-queue.h"
 #ifdef HAVE_SYS_TIME_H
 # include <sys/time.h>
 #endif
@@ -36,6 +41,8 @@
 #include <unistd.h>
 #include <stdarg.h>
 
+#include <openssl/evp.h>
+
 #include "xmalloc.h"
 #include "buffer.h"
 #include "log.h"
@@ -44,6 +51,7 @@
 
 #include "sftp.h"
 #include "sftp-common.h"
+#include "sftp-server-io.h"
 
 /* helper */
 #define get_int64()			buffer_get_int64(&iqueue);
@@ -64,6 +72,45 @@ Buffer oqueue;
 /* Version of client */
 int version;
 
+/* largest READ served */
+#define SFTP_READ_MAX		(64 * 1024)
+
+/* file I/O threads, and requests allowed in flight */
+#define SFTP_IO_THREADS		8
+#define SFTP_IO_MAX		64
+
+/*
+ * NAME replies to READDIR are filled until they pass this size; one more
+ * entry (name, long name and attributes) always fits below the limit.
+ */
+#define SFTP_READDIR_MAX	(SFTP_MAX_MSG_LENGTH - 4096)
+
+/* space in oqueue for the reply to a request in flight, beyond its data */
+#define SFTP_IO_REPLY_SPACE	64
+
+/* file I/O requests in flight, and the oqueue space their replies need */
+static TAILQ_HEAD(, SftpIo) io_inflight = TAILQ_HEAD_INITIALIZER(io_inflight);
+static u_int io_count = 0;
+static u_int io_reserved = 0;
+
+/*
+ * READ data is not copied into oqueue.  The DATA header is queued there
+ * and the read buffer waits on io_output, to be written from where
+ * pread() left it once oqueue has drained up to its "at" position.
+ * oqueue_in and oqueue_out count the bytes ever put into and taken out
+ * of oqueue.
+ */
+static TAILQ_HEAD(, SftpIo) io_output = TAILQ_HEAD_INITIALIZER(io_output);
+static u_int io_output_len = 0;
+static u_int64_t oqueue_in = 0, oqueue_out = 0;
+
+/* READ requests kept for reuse, with their buffers */
+static TAILQ_HEAD(, SftpIo) io_free = TAILQ_HEAD_INITIALIZER(io_free);
+static u_int io_nfree = 0;
+
+/* iovecs handed to one writev() */
+#define SFTP_OUTPUT_IOV		32
+
 /* portable attributes, etc. */
 
 typedef struct Stat Stat;
@@ -362,6 +409,7 @@ send_msg(Buffer *m)
 	buffer_put_int(&oqueue, mlen);
 	buffer_append(&oqueue, buffer_ptr(m), mlen);
 	buffer_consume(m, mlen);
+	oqueue_in += 4 + mlen;
 }
 
 static const char *
@@ -415,11 +463,100 @@ send_data_or_handle(char type, u_int32_t id, const char *data, int dlen)
 	buffer_free(&msg);
 }
 
+static SftpIo *
+io_get_read(void)
+{
+	SftpIo *io;
+
+	if ((io = TAILQ_FIRST(&io_free)) != NULL) {
+		TAILQ_REMOVE(&io_free, io, next);
+		io_nfree--;
+	} else {
+		io = xcalloc(1, sizeof(*io));
+		io->buf = xmalloc(SFTP_READ_MAX);
+	}
+	io->op = SFTP_IO_READ;
+	return io;
+}
+
+static void
+io_put(SftpIo *io)
+{
+	if (io->op == SFTP_IO_READ && io_nfree < SFTP_IO_MAX) {
+		TAILQ_INSERT_HEAD(&io_free, io, next);
+		io_nfree++;
+		return;
+	}
+	xfree(io->buf);
+	xfree(io);
+}
+
+/* Queue the header of a DATA reply; the data follows from io->buf. */
 static void
-send_data(u_int32_t id, const char *data, int dlen)
+send_data(SftpIo *io)
 {
-	debug("request %u: sent data len %d", id, dlen);
-	send_data_or_handle(SSH2_FXP_DATA, id, data, dlen);
+	debug("request %u: sent data len %d", io->id, (int)io->ret);
+	buffer_put_int(&oqueue, 1 + 4 + 4 + io->ret);
+	buffer_put_char(&oqueue, SSH2_FXP_DATA);
+	buffer_put_int(&oqueue, io->id);
+	buffer_put_int(&oqueue, io->ret);
+	oqueue_in += 4 + 1 + 4 + 4;
+	io->at = oqueue_in;
+	io->sent = 0;
+	TAILQ_INSERT_TAIL(&io_output, io, next);
+	io_output_len += io->ret;
+}
+
+/*
+ * Write out oqueue and the read buffers interleaved with it.  Returns
+ * the result of writev().
+ */
+static ssize_t
+send_output(int out)
+{
+	struct iovec iov[SFTP_OUTPUT_IOV];
+	SftpIo *io;
+	u_char *p = buffer_ptr(&oqueue);
+	u_int64_t pos = oqueue_out;
+	int niov = 0;
+	ssize_t len, left, n;
+
+	TAILQ_FOREACH(io, &io_output, next) {
+		if (niov + 2 > SFTP_OUTPUT_IOV)
+			break;
+		if (io->at > pos) {
+			iov[niov].iov_base = p;
+			iov[niov++].iov_len = io->at - pos;
+			p += io->at - pos;
+			pos = io->at;
+		}
+		iov[niov].iov_base = io->buf + io->sent;
+		iov[niov++].iov_len = io->ret - io->sent;
+	}
+	if (io == NULL && pos < oqueue_in) {
+		iov[niov].iov_base = p;
+		iov[niov++].iov_len = oqueue_in - pos;
+	}
+	if ((len = writev(out, iov, niov)) <= 0)
+		return len;
+
+	for (left = len; left > 0; left -= n) {
+		io = TAILQ_FIRST(&io_output);
+		if (io == NULL || io->at > oqueue_out) {
+			n = io == NULL ? left : MIN(left, io->at - oqueue_out);
+			buffer_consume(&oqueue, n);
+			oqueue_out += n;
+			continue;
+		}
+		n = MIN(left, io->ret - io->sent);
+		io->sent += n;
+		io_output_len -= n;
+		if (io->sent == io->ret) {
+			TAILQ_REMOVE(&io_output, io, next);
+			io_put(io);
+		}
+	}
+	return len;
 }
 
 static void
@@ -480,6 +617,23 @@ process_init(void)
 	buffer_init(&msg);
 	buffer_put_char(&msg, SSH2_FXP_VERSION);
 	buffer_put_int(&msg, SSH2_FILEXFER_VERSION);
+	/* extension name and version */
+#ifdef HAVE_STATVFS
+	buffer_put_cstring(&msg, "statvfs@openssh.com");
+	buffer_put_cstring(&msg, "2");
+#endif
+#ifdef HAVE_FSTATVFS
+	buffer_put_cstring(&msg, "fstatvfs@openssh.com");
+	buffer_put_cstring(&msg, "2");
+#endif
+	buffer_put_cstring(&msg, "fsync@openssh.com");
+	buffer_put_cstring(&msg, "1");
+	buffer_put_cstring(&msg, "limits@openssh.com");
+	buffer_put_cstring(&msg, "1");
+	buffer_put_cstring(&msg, "copy-data");
+	buffer_put_cstring(&msg, "1");
+	buffer_put_cstring(&msg, "check-file-handle");
+	buffer_put_cstring(&msg, "1");
 	send_msg(&msg);
 	buffer_free(&msg);
 }
@@ -533,12 +687,242 @@ process_close(void)
 	send_status(id, status);
 }
 
+/* oqueue space the reply to a request in flight may need */
+static u_int
+io_reply_space(SftpIo *io)
+{
+	if (io->op == SFTP_IO_READ)
+		return SFTP_IO_REPLY_SPACE + io->len;
+	if (io->op == SFTP_IO_HASH)
+		return SFTP_IO_REPLY_SPACE + io->dmax;
+	return SFTP_IO_REPLY_SPACE;
+}
+
+static void
+io_start(SftpIo *io)
+{
+	TAILQ_INSERT_TAIL(&io_inflight, io, next);
+	io_count++;
+	io_reserved += io_reply_space(io);
+	sftp_io_submit(io);
+}
+
+static void
+send_check_file(SftpIo *io)
+{
+	Buffer msg;
+
+	buffer_init(&msg);
+	buffer_put_char(&msg, SSH2_FXP_EXTENDED_REPLY);
+	buffer_put_int(&msg, io->id);
+	buffer_put_cstring(&msg, "check-file");
+	buffer_put_cstring(&msg, io->mdname);
+	buffer_append(&msg, io->digests, io->dlen);
+	send_msg(&msg);
+	buffer_free(&msg);
+}
+
+/* Send the reply for a finished READ, WRITE, copy-data or check-file. */
+static void
+io_finish(SftpIo *io)
+{
+	int status;
+
+	TAILQ_REMOVE(&io_inflight, io, next);
+	io_count--;
+	io_reserved -= io_reply_space(io);
+
+	if (io->op == SFTP_IO_READ) {
+		if (io->ret < 0) {
+			send_status(io->id, errno_to_portable(io->err));
+		} else if (io->ret == 0) {
+			send_status(io->id, SSH2_FX_EOF);
+		} else {
+			handle_update_read(io->handle, io->ret);
+			send_data(io);
+			return;
+		}
+	} else if (io->op == SFTP_IO_COPY) {
+		handle_update_read(io->handle, io->copied);
+		handle_update_write(io->ohandle, io->copied);
+		if (io->ret < 0)
+			status = errno_to_portable(io->err);
+		else if (io->copied < io->total)
+			status = SSH2_FX_EOF;
+		else
+			status = SSH2_FX_OK;
+		send_status(io->id, status);
+	} else if (io->op == SFTP_IO_HASH) {
+		if (io->ret < 0)
+			send_status(io->id, errno_to_portable(io->err));
+		else
+			send_check_file(io);
+		EVP_MD_CTX_destroy(io->mdctx);
+		xfree(io->digests);
+	} else {
+		if (io->ret < 0) {
+			error("process_write: write failed");
+			status = errno_to_portable(io->err);
+		} else if ((size_t)io->ret == io->len) {
+			status = SSH2_FX_OK;
+			handle_update_write(io->handle, io->ret);
+		} else {
+			debug2("nothing at all written");
+			status = SSH2_FX_FAILURE;
+		}
+		send_status(io->id, status);
+	}
+	io_put(io);
+}
+
+static void
+io_collect(void)
+{
+	SftpIo *io;
+
+	while ((io = sftp_io_done()) != NULL)
+		io_finish(io);
+}
+
+/*
+ * Whether a READ or WRITE has to wait for requests in flight on the same
+ * handle: a write for any that overlap it, a read for overlapping writes.
+ * Either waits for a copy-data from or to its handle, a write for a
+ * check-file of its handle.
+ */
+static int
+io_conflict(int op, int handle, u_int64_t off, u_int len)
+{
+	SftpIo *io;
+
+	TAILQ_FOREACH(io, &io_inflight, next) {
+		if (io->op == SFTP_IO_COPY &&
+		    (io->handle == handle || io->ohandle == handle))
+			return 1;
+		if (io->op == SFTP_IO_HASH && io->handle == handle &&
+		    op == SFTP_IO_WRITE)
+			return 1;
+		if (io->handle != handle ||
+		    (op == SFTP_IO_READ && io->op == SFTP_IO_READ))
+			continue;
+		if (off < io->off + io->len && io->off < off + len)
+			return 1;
+	}
+	return 0;
+}
+
+/* Whether file I/O is in flight on 'handle', or any READ or WRITE if -1 */
+static int
+io_busy(int handle)
+{
+	SftpIo *io;
+
+	TAILQ_FOREACH(io, &io_inflight, next) {
+		if (handle == -1) {
+			if (io->op == SFTP_IO_READ || io->op == SFTP_IO_WRITE)
+				return 1;
+		} else if (io->handle == handle ||
+		    (io->op == SFTP_IO_COPY && io->ohandle == handle))
+			return 1;
+	}
+	return 0;
+}
+
+/* The handle in the string at 'pos' of a request, or -1 */
+static int
+peek_handle(const u_char *msg, u_int msg_len, u_int pos)
+{
+	u_int hlen;
+
+	if (msg_len < pos + 4 || (hlen = get_u32(msg + pos)) >= 256 ||
+	    msg_len < pos + 4 + hlen)
+		return -1;
+	return handle_from_string((const char *)msg + pos + 4, hlen);
+}
+
+/* Whether EXTENDED request 'msg' may start, given I/O in flight */
+static int
+extended_ready(const u_char *msg, u_int msg_len)
+{
+	u_int nlen, hlen, pos;
+
+	if (msg_len < 8 || (nlen = get_u32(msg + 4)) > msg_len - 8)
+		return 1;	/* malformed; let the request fail */
+	pos = 8 + nlen;
+#define EXT_IS(s) (nlen == sizeof(s) - 1 && memcmp(msg + 8, s, nlen) == 0)
+	if (EXT_IS("copy-data")) {
+		if (io_count >= SFTP_IO_MAX ||
+		    io_busy(peek_handle(msg, msg_len, pos)))
+			return 0;
+		/* skip read handle, offset and length to the write handle */
+		if (msg_len < pos + 4 || (hlen = get_u32(msg + pos)) >= 256)
+			return 1;
+		pos += 4 + hlen + 16;
+		return !io_busy(peek_handle(msg, msg_len, pos));
+	}
+	if (EXT_IS("check-file-handle"))
+		return io_count < SFTP_IO_MAX &&
+		    !io_busy(peek_handle(msg, msg_len, pos));
+	if (EXT_IS("fsync@openssh.com") || EXT_IS("fstatvfs@openssh.com"))
+		return !io_busy(peek_handle(msg, msg_len, pos));
+#undef EXT_IS
+	return !io_busy(-1);
+}
+
+/*
+ * Whether the request at the head of iqueue may start now.  Requests on
+ * a handle wait for the file I/O on that handle; READ and WRITE only for
+ * conflicting I/O.  Requests by path wait for READs and WRITEs in flight,
+ * so they see their effects, but not for a copy-data or check-file, which
+ * may take long and only hold up requests on their own handles.
+ */
+static int
+request_ready(u_int type, const u_char *msg, u_int msg_len)
+{
+	u_int hlen, len;
+	u_int64_t off;
+	int handle;
+
+	if (io_count == 0)
+		return 1;
+	switch (type) {
+	case SSH2_FXP_READ:
+	case SSH2_FXP_WRITE:
+		break;
+	case SSH2_FXP_CLOSE:
+	case SSH2_FXP_FSTAT:
+	case SSH2_FXP_FSETSTAT:
+	case SSH2_FXP_READDIR:
+		return !io_busy(peek_handle(msg, msg_len, 4));
+	case SSH2_FXP_EXTENDED:
+		return extended_ready(msg, msg_len);
+	default:
+		return !io_busy(-1);
+	}
+	if (io_count >= SFTP_IO_MAX)
+		return 0;
+
+	/* peek at id, handle, offset and length */
+	if (msg_len < 8 || (hlen = get_u32(msg + 4)) >= 256 ||
+	    msg_len < 8 + hlen + 12)
+		return 1;	/* malformed; let the request fail */
+	handle = handle_from_string((const char *)msg + 8, hlen);
+	if (handle_to_fd(handle) < 0)
+		return 1;
+	off = get_u64(msg + 8 + hlen);
+	len = get_u32(msg + 8 + hlen + 8);
+	if (type == SSH2_FXP_READ)
+		len = MIN(len, SFTP_READ_MAX);
+	return !io_conflict(type == SSH2_FXP_READ ? SFTP_IO_READ :
+	    SFTP_IO_WRITE, handle, off, len);
+}
+
 static void
 process_read(void)
 {
-	char buf[64*1024];
+	SftpIo *io;
 	u_int32_t id, len;
-	int handle, fd, ret, status = SSH2_FX_FAILURE;
+	int handle, fd;
 	u_int64_t off;
 
 	id = get_int();
@@ -548,39 +932,32 @@ process_read(void)
 
 	debug("request %u: read \"%s\" (handle %d) off %llu len %d",
 	    id, handle_to_name(handle), handle, (unsigned long long)off, len);
-	if (len > sizeof buf) {
-		len = sizeof buf;
+	if (len > SFTP_READ_MAX) {
+		len = SFTP_READ_MAX;
 		debug2("read change len %d", len);
 	}
 	fd = handle_to_fd(handle);
-	if (fd >= 0) {
-		if (lseek(fd, off, SEEK_SET) < 0) {
-			error("process_read: seek failed");
-			status = errno_to_portable(errno);
-		} else {
-			ret = read(fd, buf, len);
-			if (ret < 0) {
-				status = errno_to_portable(errno);
-			} else if (ret == 0) {
-				status = SSH2_FX_EOF;
-			} else {
-				send_data(id, buf, ret);
-				status = SSH2_FX_OK;
-				handle_update_read(handle, ret);
-			}
-		}
+	if (fd < 0) {
+		send_status(id, SSH2_FX_FAILURE);
+		return;
 	}
-	if (status != SSH2_FX_OK)
-		send_status(id, status);
+	io = io_get_read();
+	io->id = id;
+	io->handle = handle;
+	io->fd = fd;
+	io->off = off;
+	io->len = len;
+	io_start(io);
 }
 
 static void
 process_write(void)
 {
+	SftpIo *io;
 	u_int32_t id;
 	u_int64_t off;
 	u_int len;
-	int handle, fd, ret, status = SSH2_FX_FAILURE;
+	int handle, fd;
 	char *data;
 
 	id = get_int();
@@ -591,26 +968,20 @@ process_write(void)
 	debug("request %u: write \"%s\" (handle %d) off %llu len %d",
 	    id, handle_to_name(handle), handle, (unsigned long long)off, len);
 	fd = handle_to_fd(handle);
-	if (fd >= 0) {
-		if (lseek(fd, off, SEEK_SET) < 0) {
-			status = errno_to_portable(errno);
-			error("process_write: seek failed");
-		} else {
-/* XXX ATOMICIO ? */
-			ret = write(fd, data, len);
-			if (ret < 0) {
-				error("process_write: write failed");
-				status = errno_to_portable(errno);
-			} else if ((size_t)ret == len) {
-				status = SSH2_FX_OK;
-				handle_update_write(handle, ret);
-			} else {
-				debug2("nothing at all written");
-			}
-		}
+	if (fd < 0) {
+		send_status(id, SSH2_FX_FAILURE);
+		xfree(data);
+		return;
 	}
-	send_status(id, status);
-	xfree(data);
+	io = xcalloc(1, sizeof(*io));
+	io->op = SFTP_IO_WRITE;
+	io->id = id;
+	io->handle = handle;
+	io->fd = fd;
+	io->off = off;
+	io->len = len;
+	io->buf = data;
+	io_start(io);
 }
 
 static void
@@ -832,14 +1203,42 @@ process_opendir(void)
 	xfree(path);
 }
 
+/*
+ * Stat a directory entry: relative to the open directory where fstatat()
+ * is available, by its full path otherwise.
+ */
+static int
+readdir_stat(DIR *dirp, const char *path, const char *name, struct stat *st)
+{
+#if defined(HAVE_FSTATAT) && defined(HAVE_DIRFD) && defined(AT_SYMLINK_NOFOLLOW)
+	return fstatat(dirfd(dirp), name, st, AT_SYMLINK_NOFOLLOW);
+#else
+	char pathname[MAXPATHLEN];
+	int r;
+
+	r = snprintf(pathname, sizeof pathname, "%s%s%s", path,
+	    strcmp(path, "/") ? "/" : "", name);
+	if (r < 0 || (size_t)r >= sizeof(pathname)) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+	return lstat(pathname, st);
+#endif
+}
+
 static void
 process_readdir(void)
 {
+	static Buffer msg;
+	static int msg_init = 0;
 	DIR *dirp;
 	struct dirent *dp;
-	char *path;
-	int handle;
+	struct stat st;
+	Attrib a;
+	char *path, long_name[1024];
+	int handle, count = 0;
 	u_int32_t id;
+	size_t len;
 
 	id = get_int();
 	handle = get_handle();
@@ -849,42 +1248,40 @@ process_readdir(void)
 	path = handle_to_name(handle);
 	if (dirp == NULL || path == NULL) {
 		send_status(id, SSH2_FX_FAILURE);
+		return;
+	}
+
+	/*
+	 * Entries are encoded straight into the reply, which is kept between
+	 * calls, until it is too full for one more.  The count is filled
+	 * in at the end.
+	 */
+	if (!msg_init) {
+		buffer_init(&msg);
+		msg_init = 1;
+	}
+	buffer_clear(&msg);
+	buffer_put_char(&msg, SSH2_FXP_NAME);
+	buffer_put_int(&msg, id);
+	buffer_put_int(&msg, 0);
+	while (buffer_len(&msg) < SFTP_READDIR_MAX &&
+	    (dp = readdir(dirp)) != NULL) {
+		if (readdir_stat(dirp, path, dp->d_name, &st) < 0)
+			continue;
+		stat_to_attrib(&st, &a);
+		len = ls_file_buf(long_name, sizeof(long_name), dp->d_name,
+		    &st, 0);
+		buffer_put_cstring(&msg, dp->d_name);
+		buffer_put_string(&msg, long_name, len);
+		encode_attrib(&msg, &a);
+		count++;
+	}
+	if (count > 0) {
+		put_u32((u_char *)buffer_ptr(&msg) + 1 + 4, count);
+		debug("request %u: sent names count %d", id, count);
+		send_msg(&msg);
 	} else {
-		struct stat st;
-		char pathname[MAXPATHLEN];
-		Stat *stats;
-		int nstats = 10, count = 0, i;
-
-		stats = xcalloc(nstats, sizeof(Stat));
-		while ((dp = readdir(dirp)) != NULL) {
-			if (count >= nstats) {
-				nstats *= 2;
-				stats = xrealloc(stats, nstats, sizeof(Stat));
-			}
-/* XXX OVERFLOW ? */
-			snprintf(pathname, sizeof pathname, "%s%s%s", path,
-			    strcmp(path, "/") ? "/" : "", dp->d_name);
-			if (lstat(pathname, &st) < 0)
-				continue;
-			stat_to_attrib(&st, &(stats[count].attrib));
-			stats[count].name = xstrdup(dp->d_name);
-			stats[count].long_name = ls_file(dp->d_name, &st, 0);
-			count++;
-			/* send up to 100 entries in one message */
-			/* XXX check packet size instead */
-			if (count == 100)
-				break;
-		}
-		if (count > 0) {
-			send_names(id, count, stats);
-			for (i = 0; i < count; i++) {
-				xfree(stats[i].name);
-				xfree(stats[i].long_name);
-			}
-		} else {
-			send_status(id, SSH2_FX_EOF);
-		}
-		xfree(stats);
+		send_status(id, SSH2_FX_EOF);
 	}
 }
 
@@ -1072,6 +1469,255 @@ process_symlink(void)
 	xfree(newpath);
 }
 
+#if defined(HAVE_STATVFS) || defined(HAVE_FSTATVFS)
+static void
+send_statvfs(u_int32_t id, const struct statvfs *st)
+{
+	Buffer msg;
+	u_int64_t flag = 0, fsid = 0;
+
+	/* f_fsid is a struct on some platforms */
+	memcpy(&fsid, &st->f_fsid, MIN(sizeof(fsid), sizeof(st->f_fsid)));
+#ifdef ST_RDONLY
+	if (st->f_flag & ST_RDONLY)
+		flag |= SSH2_FXE_STATVFS_ST_RDONLY;
+#endif
+#ifdef ST_NOSUID
+	if (st->f_flag & ST_NOSUID)
+		flag |= SSH2_FXE_STATVFS_ST_NOSUID;
+#endif
+	buffer_init(&msg);
+	buffer_put_char(&msg, SSH2_FXP_EXTENDED_REPLY);
+	buffer_put_int(&msg, id);
+	buffer_put_int64(&msg, st->f_bsize);
+	buffer_put_int64(&msg, st->f_frsize);
+	buffer_put_int64(&msg, st->f_blocks);
+	buffer_put_int64(&msg, st->f_bfree);
+	buffer_put_int64(&msg, st->f_bavail);
+	buffer_put_int64(&msg, st->f_files);
+	buffer_put_int64(&msg, st->f_ffree);
+	buffer_put_int64(&msg, st->f_favail);
+	buffer_put_int64(&msg, fsid);
+	buffer_put_int64(&msg, flag);
+	buffer_put_int64(&msg, st->f_namemax);
+	send_msg(&msg);
+	buffer_free(&msg);
+}
+#endif
+
+#ifdef HAVE_STATVFS
+static void
+process_extended_statvfs(u_int32_t id)
+{
+	struct statvfs st;
+	char *path;
+
+	path = get_string(NULL);
+	debug3("request %u: statvfs", id);
+	logit("statvfs \"%s\"", path);
+	if (statvfs(path, &st) != 0)
+		send_status(id, errno_to_portable(errno));
+	else
+		send_statvfs(id, &st);
+	xfree(path);
+}
+#endif
+
+#ifdef HAVE_FSTATVFS
+static void
+process_extended_fstatvfs(u_int32_t id)
+{
+	struct statvfs st;
+	int handle, fd;
+
+	handle = get_handle();
+	debug("request %u: fstatvfs \"%s\" (handle %u)",
+	    id, handle_to_name(handle), handle);
+	if ((fd = handle_to_fd(handle)) < 0)
+		send_status(id, SSH2_FX_FAILURE);
+	else if (fstatvfs(fd, &st) != 0)
+		send_status(id, errno_to_portable(errno));
+	else
+		send_statvfs(id, &st);
+}
+#endif
+
+static void
+process_extended_fsync(u_int32_t id)
+{
+	int handle, fd, status = SSH2_FX_FAILURE;
+
+	handle = get_handle();
+	debug("request %u: fsync \"%s\" (handle %u)",
+	    id, handle_to_name(handle), handle);
+	/* file I/O has finished before any extended request starts */
+	if ((fd = handle_to_fd(handle)) >= 0)
+		status = fsync(fd) == -1 ? errno_to_portable(errno) :
+		    SSH2_FX_OK;
+	send_status(id, status);
+}
+
+static void
+process_extended_limits(u_int32_t id)
+{
+	Buffer msg;
+
+	debug3("request %u: limits", id);
+	buffer_init(&msg);
+	buffer_put_char(&msg, SSH2_FXP_EXTENDED_REPLY);
+	buffer_put_int(&msg, id);
+	buffer_put_int64(&msg, SFTP_MAX_MSG_LENGTH);
+	buffer_put_int64(&msg, SFTP_READ_MAX);
+	/* room for the WRITE header and handle */
+	buffer_put_int64(&msg, SFTP_MAX_MSG_LENGTH - 1024);
+	buffer_put_int64(&msg, sizeof(handles) / sizeof(Handle));
+	send_msg(&msg);
+	buffer_free(&msg);
+}
+
+/*
+ * copy-data from draft-ietf-secsh-filexfer-extensions: copy len bytes
+ * (0 means up to end of file) between two open handles without the data
+ * passing through the client.
+ */
+static void
+process_extended_copy_data(u_int32_t id)
+{
+	SftpIo *io;
+	struct stat rst, wst;
+	u_int64_t roff, len, woff;
+	int rhandle, whandle, rfd, wfd;
+
+	rhandle = get_handle();
+	roff = get_int64();
+	len = get_int64();
+	whandle = get_handle();
+	woff = get_int64();
+
+	debug("request %u: copy-data \"%s\" (handle %d) off %llu len %llu "
+	    "to \"%s\" (handle %d) off %llu", id,
+	    handle_to_name(rhandle), rhandle, (unsigned long long)roff,
+	    (unsigned long long)len, handle_to_name(whandle), whandle,
+	    (unsigned long long)woff);
+	if ((rfd = handle_to_fd(rhandle)) < 0 ||
+	    (wfd = handle_to_fd(whandle)) < 0) {
+		send_status(id, SSH2_FX_FAILURE);
+		return;
+	}
+	if (fstat(rfd, &rst) == -1 || fstat(wfd, &wst) == -1) {
+		send_status(id, errno_to_portable(errno));
+		return;
+	}
+	if (len == 0)
+		len = (u_int64_t)rst.st_size > roff ? rst.st_size - roff : 0;
+	/* the ranges may not overlap within one file */
+	if (rst.st_dev == wst.st_dev && rst.st_ino == wst.st_ino &&
+	    roff < woff + len && woff < roff + len) {
+		send_status(id, SSH2_FX_FAILURE);
+		return;
+	}
+	/* the copy runs on the I/O threads; io_finish() replies */
+	io = xcalloc(1, sizeof(*io));
+	io->op = SFTP_IO_COPY;
+	io->id = id;
+	io->handle = rhandle;
+	io->fd = rfd;
+	io->off = roff;
+	io->ohandle = whandle;
+	io->ofd = wfd;
+	io->ooff = woff;
+	io->total = len;
+	io->len = SFTP_READ_MAX;
+	io->buf = xmalloc(io->len);
+	io_start(io);
+}
+
+/*
+ * check-file-handle from draft-ietf-secsh-filexfer-extensions: hash
+ * 'len' bytes (0 means up to end of file) of an open file, one hash per
+ * 'bsize' bytes or a single one if 'bsize' is 0, with the first
+ * algorithm in the client's list that we know.
+ */
+static void
+process_extended_check_file(u_int32_t id)
+{
+	static const struct {
+		const char *name;
+		const EVP_MD *(*md)(void);
+	} algs[] = {
+		{ "md5",	EVP_md5 },
+		{ "sha1",	EVP_sha1 },
+		{ "sha224",	EVP_sha224 },
+		{ "sha256",	EVP_sha256 },
+		{ "sha384",	EVP_sha384 },
+		{ "sha512",	EVP_sha512 },
+		{ NULL,		NULL }
+	};
+	const EVP_MD *md = NULL;
+	SftpIo *io;
+	struct stat st;
+	char *list, *cp;
+	const char *name = NULL;
+	u_int64_t off, len, block;
+	u_int bsize, i;
+	int handle, fd;
+
+	handle = get_handle();
+	list = get_string(NULL);
+	off = get_int64();
+	len = get_int64();
+	bsize = get_int();
+
+	debug("request %u: check-file \"%s\" (handle %d) algs %s off %llu "
+	    "len %llu block %u", id, handle_to_name(handle), handle, list,
+	    (unsigned long long)off, (unsigned long long)len, bsize);
+	for (cp = list; md == NULL && (name = strsep(&cp, ",")) != NULL; )
+		for (i = 0; algs[i].name != NULL; i++)
+			if (strcmp(name, algs[i].name) == 0) {
+				md = algs[i].md();
+				name = algs[i].name;
+				break;
+			}
+	if ((fd = handle_to_fd(handle)) < 0 || fstat(fd, &st) == -1 ||
+	    (bsize != 0 && bsize < 256)) {
+		send_status(id, SSH2_FX_FAILURE);
+		goto out;
+	}
+	if (md == NULL) {
+		send_status(id, SSH2_FX_OP_UNSUPPORTED);
+		goto out;
+	}
+	if (len == 0)
+		len = (u_int64_t)st.st_size > off ? st.st_size - off : 0;
+	block = bsize != 0 ? bsize : MAX(len, 1);
+	/* the hashes must fit in one reply */
+	if ((len + block - 1) / block * EVP_MD_size(md) >
+	    SFTP_MAX_MSG_LENGTH - 1024) {
+		send_status(id, SSH2_FX_FAILURE);
+		goto out;
+	}
+
+	/* the hashing runs on the I/O threads; io_finish() replies */
+	io = xcalloc(1, sizeof(*io));
+	io->op = SFTP_IO_HASH;
+	io->id = id;
+	io->handle = handle;
+	io->fd = fd;
+	io->off = off;
+	io->total = len;
+	io->md = md;
+	io->mdctx = EVP_MD_CTX_create();
+	io->mdname = name;
+	io->block = block;
+	io->dmax = MAX((len + block - 1) / block, 1) * EVP_MD_size(md);
+	io->digests = xmalloc(io->dmax);
+	io->len = SFTP_READ_MAX;
+	io->buf = xmalloc(io->len);
+	io_start(io);
+ out:
+	xfree(list);
+}
+
 static void
 process_extended(void)
 {
@@ -1080,13 +1726,33 @@ process_extended(void)
 
 	id = get_int();
 	request = get_string(NULL);
-	send_status(id, SSH2_FX_OP_UNSUPPORTED);		/* MUST */
+#ifdef HAVE_STATVFS
+	if (strcmp(request, "statvfs@openssh.com") == 0)
+		process_extended_statvfs(id);
+	else
+#endif
+#ifdef HAVE_FSTATVFS
+	if (strcmp(request, "fstatvfs@openssh.com") == 0)
+		process_extended_fstatvfs(id);
+	else
+#endif
+	if (strcmp(request, "fsync@openssh.com") == 0)
+		process_extended_fsync(id);
+	else if (strcmp(request, "limits@openssh.com") == 0)
+		process_extended_limits(id);
+	else if (strcmp(request, "copy-data") == 0)
+		process_extended_copy_data(id);
+	else if (strcmp(request, "check-file-handle") == 0)
+		process_extended_check_file(id);
+	else
+		send_status(id, SSH2_FX_OP_UNSUPPORTED);	/* MUST */
 	xfree(request);
 }
 
 /* stolen from ssh-agent */
 
-static void
+/* Returns 1 if a request was taken off iqueue. */
+static int
 process(void)
 {
 	u_int msg_len;
@@ -1097,7 +1763,7 @@ process(void)
 
 	buf_len = buffer_len(&iqueue);
 	if (buf_len < 5)
-		return;		/* Incomplete message. */
+		return 0;	/* Incomplete message. */
 	cp = buffer_ptr(&iqueue);
 	msg_len = get_u32(cp);
 	if (msg_len > SFTP_MAX_MSG_LENGTH) {
@@ -1106,7 +1772,9 @@ process(void)
 		cleanup_exit(11);
 	}
 	if (buf_len < msg_len + 4)
-		return;
+		return 0;
+	if (msg_len < 1 || !request_ready(cp[4], cp + 5, msg_len - 1))
+		return 0;
 	buffer_consume(&iqueue, 4);
 	buf_len -= 4;
 	type = buffer_get_char(&iqueue);
@@ -1183,6 +1851,7 @@ process(void)
 		fatal("msg_len %d < consumed %d", msg_len, consumed);
 	if (msg_len > consumed)
 		buffer_consume(&iqueue, msg_len - consumed);
+	return 1;
 }
 
 /* Cleanup handler that logs active handles upon normal exit */
@@ -1211,8 +1880,8 @@ int
 main(int argc, char **argv)
 {
 	fd_set *rset, *wset;
-	int in, out, max, ch, skipargs = 0, log_stderr = 0;
-	ssize_t len, olen, set_size;
+	int in, out, io_fd, max, ch, skipargs = 0, log_stderr = 0;
+	ssize_t len, set_size;
 	SyslogFacility log_facility = SYSLOG_FACILITY_AUTH;
 	char *cp, buf[4*4096];
 
@@ -1272,6 +1941,8 @@ main(int argc, char **argv)
 	    pw->pw_name, client_addr);
 
 	handle_init();
+	sftp_io_init(SFTP_IO_THREADS);
+	io_fd = sftp_io_fd();
 
 	in = dup(STDIN_FILENO);
 	out = dup(STDOUT_FILENO);
@@ -1286,6 +1957,8 @@ main(int argc, char **argv)
 		max = in;
 	if (out > max)
 		max = out;
+	if (io_fd > max)
+		max = io_fd;
 
 	buffer_init(&iqueue);
 	buffer_init(&oqueue);
@@ -1304,11 +1977,13 @@ main(int argc, char **argv)
 		 * otherwise apply backpressure by stopping reads.
 		 */
 		if (buffer_check_alloc(&iqueue, sizeof(buf)) &&
-		    buffer_check_alloc(&oqueue, SFTP_MAX_MSG_LENGTH))
+		    buffer_check_alloc(&oqueue, SFTP_MAX_MSG_LENGTH +
+		    io_reserved + io_output_len))
 			FD_SET(in, rset);
+		if (io_fd != -1)
+			FD_SET(io_fd, rset);
 
-		olen = buffer_len(&oqueue);
-		if (olen > 0)
+		if (buffer_len(&oqueue) > 0 || !TAILQ_EMPTY(&io_output))
 			FD_SET(out, wset);
 
 		if (select(max+1, rset, wset, NULL, NULL) < 0) {
@@ -1331,23 +2006,27 @@ main(int argc, char **argv)
 				buffer_append(&iqueue, buf, len);
 			}
 		}
-		/* send oqueue to stdout */
+		/* send oqueue and read data to stdout */
 		if (FD_ISSET(out, wset)) {
-			len = write(out, buffer_ptr(&oqueue), olen);
+			len = send_output(out);
 			if (len < 0) {
 				error("write: %s", strerror(errno));
 				cleanup_exit(1);
-			} else {
-				buffer_consume(&oqueue, len);
 			}
 		}
 
 		/*
 		 * Process requests from client if we can fit the results
 		 * into the output buffer, otherwise stop processing input
-		 * and let the output queue drain.
+		 * and let the output queue drain.  Replies to file I/O in
+		 * flight have their space set aside, and read data waiting
+		 * to be written counts as if it were queued.
 		 */
-		if (buffer_check_alloc(&oqueue, SFTP_MAX_MSG_LENGTH))
-			process();
+		for (;;) {
+			io_collect();
+			if (!buffer_check_alloc(&oqueue, SFTP_MAX_MSG_LENGTH +
+			    io_reserved + io_output_len) || !process())
+				break;
+		}
 	}
 }
@@ -98,6 +98,10 @@ extern char *__progname;
 #define VIEW_FLAGS	(LS_LONG_VIEW|LS_SHORT_VIEW|LS_NUMERIC_VIEW)
 #define SORT_FLAGS	(LS_NAME_SORT|LS_TIME_SORT|LS_SIZE_SORT)
 
+/* df flags */
+#define DF_HUMAN	0x01	/* Sizes with units ala df -h */
+#define DF_INODES	0x02	/* Inode counts ala df -i */
+
 /* Commands for interactive mode */
 #define I_CHDIR		1
 #define I_CHGRP		2
@@ -122,6 +126,10 @@ extern char *__progname;
 #define I_SYMLINK	21
 #define I_VERSION	22
 #define I_PROGRESS	23
+#define I_COPY		24
+#define I_DF		25
+#define I_REGET		26
+#define I_REPUT		27
 
 struct CMD {
 	const char *c;
@@ -135,6 +143,9 @@ static const struct CMD cmds[] = {
 	{ "chgrp",	I_CHGRP },
 	{ "chmod",	I_CHMOD },
 	{ "chown",	I_CHOWN },
+	{ "copy",	I_COPY },
+	{ "cp",		I_COPY },
+	{ "df",		I_DF },
 	{ "dir",	I_LS },
 	{ "exit",	I_QUIT },
 	{ "get",	I_GET },
@@ -154,7 +165,9 @@ static const struct CMD cmds[] = {
 	{ "mput",	I_PUT },
 	{ "pwd",	I_PWD },
 	{ "quit",	I_QUIT },
+	{ "reget",	I_REGET },
 	{ "rename",	I_RENAME },
+	{ "reput",	I_REPUT },
 	{ "rm",		I_RM },
 	{ "rmdir",	I_RMDIR },
 	{ "symlink",	I_SYMLINK },
@@ -199,6 +212,9 @@ help(void)
 	printf("chgrp grp path                Change group of file 'path' to 'grp'\n");
 	printf("chmod mode path               Change permissions of file 'path' to 'mode'\n");
 	printf("chown own path                Change owner of file 'path' to 'own'\n");
+	printf("cp oldpath newpath            Copy remote file\n");
+	printf("df [-hi] [path]               Display statistics for current directory or\n");
+	printf("                              filesystem containing 'path'\n");
 	printf("help                          Display this help text\n");
 	printf("get remote-path [local-path]  Download file\n");
 	printf("lls [ls-options [path]]       Display local directory listing\n");
@@ -213,7 +229,9 @@ help(void)
 	printf("pwd                           Display remote working directory\n");
 	printf("exit                          Quit sftp\n");
 	printf("quit                          Quit sftp\n");
+	printf("reget remote-path [local-path] Resume download of file\n");
 	printf("rename oldpath newpath        Rename remote file\n");
+	printf("reput local-path [remote-path] Resume upload of file\n");
 	printf("rmdir path                    Remove remote directory\n");
 	printf("rm path                       Delete remote file\n");
 	printf("symlink oldpath newpath       Symlink remote file\n");
@@ -346,22 +364,58 @@ infer_path(const char *p, char **ifp)
 }
 
 static int
-parse_getput_flags(const char **cpp, int *pflag)
+parse_getput_flags(const char **cpp, int *pflag, int *fflag, int *aflag)
 {
 	const char *cp = *cpp;
 
 	/* Check for flags */
-	if (cp[0] == '-' && cp[1] && strchr(WHITESPACE, cp[2])) {
+	while (cp[0] == '-' && cp[1] && strchr(WHITESPACE, cp[2])) {
 		switch (cp[1]) {
 		case 'p':
 		case 'P':
 			*pflag = 1;
 			break;
+		case 'f':
+			*fflag = 1;
+			break;
+		case 'a':
+			*aflag = 1;
+			break;
 		default:
 			error("Invalid flag -%c", cp[1]);
 			return(-1);
 		}
 		cp += 2;
+		cp += strspn(cp, WHITESPACE);
+	}
+	*cpp = cp;
+
+	return(0);
+}
+
+static int
+parse_df_flags(const char **cpp, int *dflag)
+{
+	const char *cp = *cpp;
+
+	/* Defaults */
+	*dflag = 0;
+
+	/* Check for flags */
+	if (cp++[0] == '-') {
+		for (; strchr(WHITESPACE, *cp) == NULL; cp++) {
+			switch (*cp) {
+			case 'h':
+				*dflag |= DF_HUMAN;
+				break;
+			case 'i':
+				*dflag |= DF_INODES;
+				break;
+			default:
+				error("Invalid flag -%c", *cp);
+				return(-1);
+			}
+		}
 		*cpp = cp + strspn(cp, WHITESPACE);
 	}
 
@@ -523,12 +577,14 @@ remote_is_dir(struct sftp_conn *conn, char *path)
 }
 
 static int
-process_get(struct sftp_conn *conn, char *src, char *dst, char *pwd, int pflag)
+process_get(struct sftp_conn *conn, char *src, char *dst, char *pwd, int pflag,
+    int fflag, int aflag)
 {
 	char *abs_src = NULL;
 	char *abs_dst = NULL;
 	char *tmp;
 	glob_t g;
+	struct sftp_batch *batch = NULL;
 	int err = 0;
 	int i;
 
@@ -551,6 +607,13 @@ process_get(struct sftp_conn *conn, char *src, char *dst, char *pwd, int pflag)
 		goto out;
 	}
 
+	/*
+	 * Several files go as one batch, without a progress meter.
+	 * Resumed transfers go one at a time.
+	 */
+	if (g.gl_pathv[0] != NULL && g.gl_pathv[1] != NULL && !aflag)
+		batch = do_batch_init(conn, pflag, fflag);
+
 	for (i = 0; g.gl_pathv[i] && !interrupted; i++) {
 		if (infer_path(g.gl_pathv[i], &tmp)) {
 			err = -1;
@@ -576,25 +639,32 @@ process_get(struct sftp_conn *conn, char *src, char *dst, char *pwd, int pflag)
 			abs_dst = tmp;
 
 		printf("Fetching %s to %s\n", g.gl_pathv[i], abs_dst);
-		if (do_download(conn, g.gl_pathv[i], abs_dst, pflag) == -1)
+		if (batch != NULL)
+			do_batch_download(batch, g.gl_pathv[i], abs_dst);
+		else if (do_download(conn, g.gl_pathv[i], abs_dst,
+		    pflag, fflag, aflag) == -1)
 			err = -1;
 		xfree(abs_dst);
 		abs_dst = NULL;
 	}
 
 out:
+	if (batch != NULL && do_batch_run(batch) == -1)
+		err = -1;
 	xfree(abs_src);
 	globfree(&g);
 	return(err);
 }
 
 static int
-process_put(struct sftp_conn *conn, char *src, char *dst, char *pwd, int pflag)
+process_put(struct sftp_conn *conn, char *src, char *dst, char *pwd, int pflag,
+    int fflag, int aflag)
 {
 	char *tmp_dst = NULL;
 	char *abs_dst = NULL;
 	char *tmp;
 	glob_t g;
+	struct sftp_batch *batch = NULL;
 	int err = 0;
 	int i;
 
@@ -619,6 +689,13 @@ process_put(struct sftp_conn *conn, char *src, char *dst, char *pwd, int pflag)
 		goto out;
 	}
 
+	/*
+	 * Several files go as one batch, without a progress meter.
+	 * Resumed transfers go one at a time.
+	 */
+	if (g.gl_pathv[0] != NULL && g.gl_pathv[1] != NULL && !aflag)
+		batch = do_batch_init(conn, pflag, fflag);
+
 	for (i = 0; g.gl_pathv[i] && !interrupted; i++) {
 		if (!is_reg(g.gl_pathv[i])) {
 			error("skipping non-regular file %s",
@@ -649,11 +726,18 @@ process_put(struct sftp_conn *conn, char *src, char *dst, char *pwd, int pflag)
 			abs_dst = make_absolute(tmp, pwd);
 
 		printf("Uploading %s to %s\n", g.gl_pathv[i], abs_dst);
-		if (do_upload(conn, g.gl_pathv[i], abs_dst, pflag) == -1)
+		if (batch != NULL)
+			do_batch_upload(batch, g.gl_pathv[i], abs_dst);
+		else if (do_upload(conn, g.gl_pathv[i], abs_dst,
+		    pflag, fflag, aflag) == -1)
 			err = -1;
+		xfree(abs_dst);
+		abs_dst = NULL;
 	}
 
 out:
+	if (batch != NULL && do_batch_run(batch) == -1)
+		err = -1;
 	if (abs_dst)
 		xfree(abs_dst);
 	if (tmp_dst)
@@ -662,6 +746,70 @@ out:
 	return(err);
 }
 
+/* Render 'bytes' with a unit so it fits a short column */
+static void
+format_scaled(char *buf, size_t len, u_int64_t bytes)
+{
+	const char *units = "BKMGTPE";
+	double v = bytes;
+
+	while (v >= 1024 && units[1] != '\0') {
+		v /= 1024;
+		units++;
+	}
+	if (*units == 'B')
+		snprintf(buf, len, "%lluB", (unsigned long long)bytes);
+	else
+		snprintf(buf, len, "%.1f%c", v, *units);
+}
+
+static int
+do_df(struct sftp_conn *conn, char *path, int dflag)
+{
+	struct sftp_statvfs st;
+	char s_size[16], s_used[16], s_avail[16], s_root[16];
+	u_int64_t used, pct;
+
+	if (do_statvfs(conn, path, &st, 0) == -1)
+		return -1;
+	if (dflag & DF_INODES) {
+		used = st.f_files - st.f_ffree;
+		pct = st.f_files ? 100 * used / st.f_files : 0;
+		printf("     Inodes        Used       Avail      "
+		    "(root)    %%Capacity\n");
+		printf("%11llu %11llu %11llu %11llu         %3llu%%\n",
+		    (unsigned long long)st.f_files,
+		    (unsigned long long)used,
+		    (unsigned long long)st.f_favail,
+		    (unsigned long long)st.f_ffree,
+		    (unsigned long long)pct);
+		return 0;
+	}
+	used = st.f_blocks - st.f_bfree;
+	/* as df(1): the share of the space that users may fill */
+	pct = used + st.f_bavail ? 100 * used / (used + st.f_bavail) : 0;
+	if (dflag & DF_HUMAN) {
+		format_scaled(s_size, sizeof(s_size), st.f_frsize * st.f_blocks);
+		format_scaled(s_used, sizeof(s_used), st.f_frsize * used);
+		format_scaled(s_avail, sizeof(s_avail),
+		    st.f_frsize * st.f_bavail);
+		format_scaled(s_root, sizeof(s_root), st.f_frsize * st.f_bfree);
+		printf("    Size     Used    Avail   (root)    %%Capacity\n");
+		printf("%8s %8s %8s %8s         %3llu%%\n",
+		    s_size, s_used, s_avail, s_root, (unsigned long long)pct);
+	} else {
+		printf("        Size         Used        Avail       "
+		    "(root)    %%Capacity\n");
+		printf("%12llu %12llu %12llu %12llu         %3llu%%\n",
+		    (unsigned long long)(st.f_frsize * st.f_blocks / 1024),
+		    (unsigned long long)(st.f_frsize * used / 1024),
+		    (unsigned long long)(st.f_frsize * st.f_bavail / 1024),
+		    (unsigned long long)(st.f_frsize * st.f_bfree / 1024),
+		    (unsigned long long)pct);
+	}
+	return 0;
+}
+
 static int
 sdirent_comp(const void *aa, const void *bb)
 {
@@ -867,8 +1015,8 @@ do_globbed_ls(struct sftp_conn *conn, char *path, char *strip_path,
 }
 
 static int
-parse_args(const char **cpp, int *pflag, int *lflag, int *iflag,
-    unsigned long *n_arg, char **path1, char **path2)
+parse_args(const char **cpp, int *pflag, int *fflag, int *aflag, int *lflag,
+    int *iflag, unsigned long *n_arg, char **path1, char **path2)
 {
 	const char *cmd, *cp = *cpp;
 	char *cp2;
@@ -876,6 +1024,9 @@ parse_args(const char **cpp, int *pflag, int *lflag, int *iflag,
 	long l;
 	int i, cmdnum;
 
+	*iflag = *lflag = *pflag = *fflag = *aflag = *n_arg = 0;
+	*path1 = *path2 = NULL;
+
 	/* Skip leading whitespace */
 	cp = cp + strspn(cp, WHITESPACE);
 
@@ -884,7 +1035,6 @@ parse_args(const char **cpp, int *pflag, int *lflag, int *iflag,
 		return (0);
 
 	/* Check for leading '-' (disable error processing) */
-	*iflag = 0;
 	if (*cp == '-') {
 		*iflag = 1;
 		cp++;
@@ -915,12 +1065,14 @@ parse_args(const char **cpp, int *pflag, int *lflag, int *iflag,
 	}
 
 	/* Get arguments and parse flags */
-	*lflag = *pflag = *n_arg = 0;
-	*path1 = *path2 = NULL;
 	switch (cmdnum) {
+	case I_REGET:
+	case I_REPUT:
+		*aflag = 1;
+		/* FALLTHROUGH */
 	case I_GET:
 	case I_PUT:
-		if (parse_getput_flags(&cp, pflag))
+		if (parse_getput_flags(&cp, pflag, fflag, aflag))
 			return(-1);
 		/* Get first pathname (mandatory) */
 		if (get_pathname(&cp, path1))
@@ -936,6 +1088,7 @@ parse_args(const char **cpp, int *pflag, int *lflag, int *iflag,
 		break;
 	case I_RENAME:
 	case I_SYMLINK:
+	case I_COPY:
 		if (get_pathname(&cp, path1))
 			return(-1);
 		if (get_pathname(&cp, path2))
@@ -968,6 +1121,13 @@ parse_args(const char **cpp, int *pflag, int *lflag, int *iflag,
 		if (get_pathname(&cp, path1))
 			return(-1);
 		break;
+	case I_DF:
+		if (parse_df_flags(&cp, lflag))
+			return(-1);
+		/* Path is optional */
+		if (get_pathname(&cp, path1))
+			return(-1);
+		break;
 	case I_LLS:
 	case I_SHELL:
 		/* Uses the rest of the line */
@@ -1022,25 +1182,83 @@ parse_args(const char **cpp, int *pflag, int *lflag, int *iflag,
 	return(cmdnum);
 }
 
+/*
+ * Requests of batch file lines whose errors are ignored, left in flight
+ * to be collected along with those of the lines after them.
+ */
+static struct sftp_pipe *pending = NULL;
+
+static void
+pending_wait(void)
+{
+	if (pending != NULL) {
+		do_pipe_free(pending);
+		pending = NULL;
+	}
+}
+
+static struct sftp_pipe *
+pipe_get(struct sftp_conn *conn, int defer)
+{
+	if (!defer)
+		return do_pipe_init(conn);
+	if (pending == NULL)
+		pending = do_pipe_init(conn);
+	return pending;
+}
+
+/* Wait for a command's requests, unless they were deferred. */
+static int
+pipe_done(struct sftp_pipe *pipe)
+{
+	int err;
+
+	if (pipe == pending)
+		return 0;
+	err = do_pipe_wait(pipe);
+	do_pipe_free(pipe);
+	return err;
+}
+
 static int
 parse_dispatch_command(struct sftp_conn *conn, const char *cmd, char **pwd,
     int err_abort)
 {
 	char *path1, *path2, *tmp;
-	int pflag, lflag, iflag, cmdnum, i;
+	int pflag, fflag, aflag, lflag, iflag, cmdnum, i, n, defer = 0, *ok;
 	unsigned long n_arg;
 	Attrib a, *aa;
 	char path_buf[MAXPATHLEN];
 	int err = 0;
 	glob_t g;
+	struct sftp_pipe *pipe;
 
 	path1 = path2 = NULL;
-	cmdnum = parse_args(&cmd, &pflag, &lflag, &iflag, &n_arg,
-	    &path1, &path2);
+	cmdnum = parse_args(&cmd, &pflag, &fflag, &aflag, &lflag, &iflag,
+	    &n_arg, &path1, &path2);
 
 	if (iflag != 0)
 		err_abort = 0;
 
+	/*
+	 * Remote metadata commands are pipelined.  A batch file line whose
+	 * errors are ignored need not wait for its replies at all; any
+	 * other line collects those still outstanding first.  So must
+	 * remote_glob(), whose requests are synchronous.
+	 */
+	switch (cmdnum) {
+	case I_RENAME:
+	case I_SYMLINK:
+	case I_RM:
+	case I_MKDIR:
+	case I_RMDIR:
+	case I_CHMOD:
+		defer = batchmode && !err_abort;
+		break;
+	}
+	if (!defer)
+		pending_wait();
+
 	memset(&g, 0, sizeof(g));
 
 	/* Perform command */
@@ -1053,40 +1271,60 @@ parse_dispatch_command(struct sftp_conn *conn, const char *cmd, char **pwd,
 		err = -1;
 		break;
 	case I_GET:
-		err = process_get(conn, path1, path2, *pwd, pflag);
+	case I_REGET:
+		err = process_get(conn, path1, path2, *pwd, pflag, fflag,
+		    aflag);
 		break;
 	case I_PUT:
-		err = process_put(conn, path1, path2, *pwd, pflag);
+	case I_REPUT:
+		err = process_put(conn, path1, path2, *pwd, pflag, fflag,
+		    aflag);
 		break;
 	case I_RENAME:
 		path1 = make_absolute(path1, *pwd);
 		path2 = make_absolute(path2, *pwd);
-		err = do_rename(conn, path1, path2);
+		pipe = pipe_get(conn, defer);
+		do_pipe_rename(pipe, path1, path2);
+		err = pipe_done(pipe);
+		break;
+	case I_COPY:
+		path1 = make_absolute(path1, *pwd);
+		path2 = make_absolute(path2, *pwd);
+		err = do_copy(conn, path1, path2);
 		break;
 	case I_SYMLINK:
 		path2 = make_absolute(path2, *pwd);
-		err = do_symlink(conn, path1, path2);
+		pipe = pipe_get(conn, defer);
+		do_pipe_symlink(pipe, path1, path2);
+		err = pipe_done(pipe);
 		break;
 	case I_RM:
 		path1 = make_absolute(path1, *pwd);
+		pending_wait();
 		remote_glob(conn, path1, GLOB_NOCHECK, NULL, &g);
+		pipe = pipe_get(conn, defer);
 		for (i = 0; g.gl_pathv[i] && !interrupted; i++) {
 			printf("Removing %s\n", g.gl_pathv[i]);
-			err = do_rm(conn, g.gl_pathv[i]);
-			if (err != 0 && err_abort)
+			do_pipe_rm(pipe, g.gl_pathv[i]);
+			if (err_abort && do_pipe_failed(pipe) > 0)
 				break;
 		}
+		err = pipe_done(pipe);
 		break;
 	case I_MKDIR:
 		path1 = make_absolute(path1, *pwd);
 		attrib_clear(&a);
 		a.flags |= SSH2_FILEXFER_ATTR_PERMISSIONS;
 		a.perm = 0777;
-		err = do_mkdir(conn, path1, &a);
+		pipe = pipe_get(conn, defer);
+		do_pipe_mkdir(pipe, path1, &a);
+		err = pipe_done(pipe);
 		break;
 	case I_RMDIR:
 		path1 = make_absolute(path1, *pwd);
-		err = do_rmdir(conn, path1);
+		pipe = pipe_get(conn, defer);
+		do_pipe_rmdir(pipe, path1);
+		err = pipe_done(pipe);
 		break;
 	case I_CHDIR:
 		path1 = make_absolute(path1, *pwd);
@@ -1129,6 +1367,13 @@ parse_dispatch_command(struct sftp_conn *conn, const char *cmd, char **pwd,
 		path1 = make_absolute(path1, *pwd);
 		err = do_globbed_ls(conn, path1, tmp, lflag);
 		break;
+	case I_DF:
+		/* Default to current directory if no path specified */
+		if (path1 == NULL)
+			path1 = xstrdup(*pwd);
+		path1 = make_absolute(path1, *pwd);
+		err = do_df(conn, path1, lflag);
+		break;
 	case I_LCHDIR:
 		if (chdir(path1) == -1) {
 			error("Couldn't change local directory to "
@@ -1158,45 +1403,55 @@ parse_dispatch_command(struct sftp_conn *conn, const char *cmd, char **pwd,
 		attrib_clear(&a);
 		a.flags |= SSH2_FILEXFER_ATTR_PERMISSIONS;
 		a.perm = n_arg;
+		pending_wait();
 		remote_glob(conn, path1, GLOB_NOCHECK, NULL, &g);
+		pipe = pipe_get(conn, defer);
 		for (i = 0; g.gl_pathv[i] && !interrupted; i++) {
 			printf("Changing mode on %s\n", g.gl_pathv[i]);
-			err = do_setstat(conn, g.gl_pathv[i], &a);
-			if (err != 0 && err_abort)
+			do_pipe_setstat(pipe, g.gl_pathv[i], &a);
+			if (err_abort && do_pipe_failed(pipe) > 0)
 				break;
 		}
+		err = pipe_done(pipe);
 		break;
 	case I_CHOWN:
 	case I_CHGRP:
 		path1 = make_absolute(path1, *pwd);
 		remote_glob(conn, path1, GLOB_NOCHECK, NULL, &g);
-		for (i = 0; g.gl_pathv[i] && !interrupted; i++) {
-			if (!(aa = do_stat(conn, g.gl_pathv[i], 0))) {
-				if (err != 0 && err_abort)
-					break;
-				else
-					continue;
-			}
-			if (!(aa->flags & SSH2_FILEXFER_ATTR_UIDGID)) {
+		for (n = 0; g.gl_pathv[n]; n++)
+			;
+		aa = xcalloc(MAX(n, 1), sizeof(*aa));
+		ok = xcalloc(MAX(n, 1), sizeof(*ok));
+
+		/* Fetch all the current ownerships, then change them */
+		pipe = do_pipe_init(conn);
+		for (i = 0; i < n && !interrupted; i++)
+			do_pipe_stat(pipe, g.gl_pathv[i], &aa[i], &ok[i]);
+		do_pipe_wait(pipe);
+		for (i = 0; i < n && !interrupted; i++) {
+			if (!ok[i])
+				continue;
+			if (!(aa[i].flags & SSH2_FILEXFER_ATTR_UIDGID)) {
 				error("Can't get current ownership of "
 				    "remote file \"%s\"", g.gl_pathv[i]);
-				if (err != 0 && err_abort)
-					break;
-				else
-					continue;
+				continue;
 			}
-			aa->flags &= SSH2_FILEXFER_ATTR_UIDGID;
+			aa[i].flags &= SSH2_FILEXFER_ATTR_UIDGID;
 			if (cmdnum == I_CHOWN) {
 				printf("Changing owner on %s\n", g.gl_pathv[i]);
-				aa->uid = n_arg;
+				aa[i].uid = n_arg;
 			} else {
 				printf("Changing group on %s\n", g.gl_pathv[i]);
-				aa->gid = n_arg;
+				aa[i].gid = n_arg;
 			}
-			err = do_setstat(conn, g.gl_pathv[i], aa);
-			if (err != 0 && err_abort)
+			do_pipe_setstat(pipe, g.gl_pathv[i], &aa[i]);
+			if (err_abort && do_pipe_failed(pipe) > 0)
 				break;
 		}
+		err = do_pipe_wait(pipe);
+		do_pipe_free(pipe);
+		xfree(aa);
+		xfree(ok);
 		break;
 	case I_PWD:
 		printf("Remote working directory: %s\n", *pwd);
@@ -1378,6 +1633,7 @@ interactive_loop(int fd_in, int fd_out, char *file1, char *file2)
 		if (err != 0)
 			break;
 	}
+	pending_wait();
 	xfree(pwd);
 	xfree(conn);
 
@@ -74,6 +74,7 @@
 #include "compat.h"
 #include "log.h"
 #include "misc.h"
+#include "ed25519.h"
 
 #ifdef SMARTCARD
 #include "scard.h"
@@ -460,6 +461,13 @@ process_add_identity(SocketEntry *e, int version)
 	int type, success = 0, death = 0, confirm = 0;
 	char *type_name, *comment;
 	Key *k = NULL;
+	u_char *pk, *sk;
+	u_int pklen, sklen;
+#ifdef OPENSSL_HAS_ECC
+	char *curve;
+	BIGNUM *exponent;
+	EC_POINT *q;
+#endif
 
 	switch (version) {
 	case 1:
@@ -480,7 +488,6 @@ process_add_identity(SocketEntry *e, int version)
 	case 2:
 		type_name = buffer_get_string(&e->request, NULL);
 		type = key_type_from_name(type_name);
-		xfree(type_name);
 		switch (type) {
 		case KEY_DSA:
 			k = key_new_private(type);
@@ -502,10 +509,61 @@ process_add_identity(SocketEntry *e, int version)
 			/* Generate additional parameters */
 			rsa_generate_additional_parameters(k->rsa);
 			break;
+#ifdef OPENSSL_HAS_ECC
+		case KEY_ECDSA:
+			k = key_new_private(type);
+			curve = buffer_get_string(&e->request, NULL);
+			k->ecdsa_nid = key_curve_name_to_nid(curve);
+			xfree(curve);
+			if (k->ecdsa_nid == -1 ||
+			    strcmp(key_ssh_name(k), type_name) != 0) {
+				error("%s: curve does not match key type %s",
+				    __func__, type_name);
+				goto bad;
+			}
+			if ((k->ecdsa = EC_KEY_new_by_curve_name(
+			    k->ecdsa_nid)) == NULL)
+				fatal("%s: EC_KEY_new_by_curve_name failed",
+				    __func__);
+			if ((q = EC_POINT_new(EC_KEY_get0_group(k->ecdsa))) ==
+			    NULL || (exponent = BN_new()) == NULL)
+				fatal("%s: allocation failed", __func__);
+			buffer_get_ecpoint(&e->request,
+			    EC_KEY_get0_group(k->ecdsa), q);
+			buffer_get_bignum2(&e->request, exponent);
+			if (EC_KEY_set_public_key(k->ecdsa, q) != 1 ||
+			    EC_KEY_set_private_key(k->ecdsa, exponent) != 1)
+				fatal("%s: EC_KEY_set_*_key failed", __func__);
+			BN_clear_free(exponent);
+			EC_POINT_free(q);
+			if (key_ec_validate_public(EC_KEY_get0_group(k->ecdsa),
+			    EC_KEY_get0_public_key(k->ecdsa)) != 0 ||
+			    key_ec_validate_private(k->ecdsa) != 0)
+				goto bad;
+			break;
+#endif
+		case KEY_ED25519:
+			pk = buffer_get_string(&e->request, &pklen);
+			sk = buffer_get_string(&e->request, &sklen);
+			if (pklen != ED25519_PK_SZ || sklen != ED25519_SK_SZ ||
+			    memcmp(sk + ED25519_SK_SZ - ED25519_PK_SZ, pk,
+			    ED25519_PK_SZ) != 0) {
+				error("%s: bad ed25519 key", __func__);
+				memset(sk, 0, sklen);
+				xfree(sk);
+				xfree(pk);
+				goto bad;
+			}
+			k = key_new_private(type);
+			k->ed25519_pk = pk;
+			k->ed25519_sk = sk;
+			break;
 		default:
+			xfree(type_name);
 			buffer_clear(&e->request);
 			goto send;
 		}
+		xfree(type_name);
 		break;
 	}
 	/* enable blinding */
@@ -552,6 +610,12 @@ process_add_identity(SocketEntry *e, int version)
 		key_free(k);
 		xfree(comment);
 	}
+	goto send;
+bad:
+	xfree(type_name);
+	if (k != NULL)
+		key_free(k);
+	buffer_clear(&e->request);
 send:
 	buffer_put_int(&e->output, 1);
 	buffer_put_char(&e->output,
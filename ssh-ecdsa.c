@@ -0,0 +1,155 @@
+/*
+ * Placed in the public domain.
+ *
+ * ecdsa-sha2-nistp256/384/521 signatures (RFC 5656, section 3.1.2).
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <openssl/bn.h>
+#include <openssl/evp.h>
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "xmalloc.h"
+#include "buffer.h"
+#include "log.h"
+#include "key.h"
+
+#ifdef OPENSSL_HAS_ECC
+
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+
+int
+ssh_ecdsa_sign(const Key *key, u_char **sigp, u_int *lenp,
+    const u_char *data, u_int datalen)
+{
+	ECDSA_SIG *sig;
+	const EVP_MD *evp_md;
+	EVP_MD_CTX md;
+	u_char digest[EVP_MAX_MD_SIZE];
+	u_int len, dlen;
+	Buffer b, bb;
+
+	if (key == NULL || key->type != KEY_ECDSA || key->ecdsa == NULL) {
+		error("%s: no ECDSA key", __func__);
+		return -1;
+	}
+	evp_md = key_ec_nid_to_evpmd(key->ecdsa_nid);
+	EVP_DigestInit(&md, evp_md);
+	EVP_DigestUpdate(&md, data, datalen);
+	EVP_DigestFinal(&md, digest, &dlen);
+
+	sig = ECDSA_do_sign(digest, dlen, key->ecdsa);
+	memset(digest, 'd', sizeof(digest));
+
+	if (sig == NULL) {
+		error("%s: sign failed", __func__);
+		return -1;
+	}
+
+	buffer_init(&bb);
+	buffer_put_bignum2(&bb, sig->r);
+	buffer_put_bignum2(&bb, sig->s);
+	ECDSA_SIG_free(sig);
+
+	buffer_init(&b);
+	buffer_put_cstring(&b, key_ssh_name(key));
+	buffer_put_string(&b, buffer_ptr(&bb), buffer_len(&bb));
+	buffer_free(&bb);
+	len = buffer_len(&b);
+	if (lenp != NULL)
+		*lenp = len;
+	if (sigp != NULL) {
+		*sigp = xmalloc(len);
+		memcpy(*sigp, buffer_ptr(&b), len);
+	}
+	buffer_free(&b);
+	return 0;
+}
+
+int
+ssh_ecdsa_verify(const Key *key, const u_char *signature, u_int signaturelen,
+    const u_char *data, u_int datalen)
+{
+	ECDSA_SIG *sig;
+	const EVP_MD *evp_md;
+	EVP_MD_CTX md;
+	u_char digest[EVP_MAX_MD_SIZE], *sigblob;
+	u_int len, dlen;
+	int rlen, ret;
+	Buffer b, bb;
+	char *ktype;
+
+	if (key == NULL || key->type != KEY_ECDSA || key->ecdsa == NULL) {
+		error("%s: no ECDSA key", __func__);
+		return -1;
+	}
+	evp_md = key_ec_nid_to_evpmd(key->ecdsa_nid);
+
+	/* fetch signature */
+	buffer_init(&b);
+	buffer_append(&b, signature, signaturelen);
+	if ((ktype = buffer_get_string_ret(&b, NULL)) == NULL ||
+	    strcmp(key_ssh_name(key), ktype) != 0) {
+		error("%s: cannot handle type %s", __func__,
+		    ktype == NULL ? "(null)" : ktype);
+		buffer_free(&b);
+		if (ktype != NULL)
+			xfree(ktype);
+		return -1;
+	}
+	xfree(ktype);
+	sigblob = buffer_get_string_ret(&b, &len);
+	rlen = buffer_len(&b);
+	buffer_free(&b);
+	if (sigblob == NULL) {
+		error("%s: can't read signature", __func__);
+		return -1;
+	}
+	if (rlen != 0) {
+		error("%s: remaining bytes in signature %d", __func__, rlen);
+		xfree(sigblob);
+		return -1;
+	}
+
+	/* parse signature */
+	if ((sig = ECDSA_SIG_new()) == NULL)
+		fatal("%s: ECDSA_SIG_new failed", __func__);
+	buffer_init(&bb);
+	buffer_append(&bb, sigblob, len);
+	if (buffer_get_bignum2_ret(&bb, sig->r) == -1 ||
+	    buffer_get_bignum2_ret(&bb, sig->s) == -1 ||
+	    buffer_len(&bb) != 0) {
+		error("%s: malformed signature", __func__);
+		buffer_free(&bb);
+		ECDSA_SIG_free(sig);
+		memset(sigblob, 0, len);
+		xfree(sigblob);
+		return -1;
+	}
+	buffer_free(&bb);
+
+	/* clean up */
+	memset(sigblob, 0, len);
+	xfree(sigblob);
+
+	/* hash the data */
+	EVP_DigestInit(&md, evp_md);
+	EVP_DigestUpdate(&md, data, datalen);
+	EVP_DigestFinal(&md, digest, &dlen);
+
+	ret = ECDSA_do_verify(digest, dlen, sig, key->ecdsa);
+	memset(digest, 'd', sizeof(digest));
+
+	ECDSA_SIG_free(sig);
+
+	debug("%s: signature %s", __func__,
+	    ret == 1 ? "correct" : ret == 0 ? "incorrect" : "error");
+	return ret;
+}
+#endif /* OPENSSL_HAS_ECC */
@@ -0,0 +1,119 @@
+/*
+ * Placed in the public domain.
+ *
+ * ssh-ed25519 signatures (RFC 8709).
+ */
+
+#include "includes.h"
+
+#include <sys/types.h>
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "xmalloc.h"
+#include "buffer.h"
+#include "log.h"
+#include "key.h"
+#include "ed25519.h"
+
+int
+ssh_ed25519_sign(const Key *key, u_char **sigp, u_int *lenp,
+    const u_char *data, u_int datalen)
+{
+	u_char *sig;
+	unsigned long long smlen;
+	u_int len;
+	Buffer b;
+
+	if (key == NULL || key->type != KEY_ED25519 ||
+	    key->ed25519_sk == NULL) {
+		error("%s: no ED25519 key", __func__);
+		return -1;
+	}
+	sig = xmalloc(datalen + ED25519_SIG_SZ);
+	if (crypto_sign_ed25519(sig, &smlen, data, datalen,
+	    key->ed25519_sk) != 0 || smlen <= datalen) {
+		error("%s: crypto_sign_ed25519 failed", __func__);
+		xfree(sig);
+		return -1;
+	}
+	/* encode signature */
+	buffer_init(&b);
+	buffer_put_cstring(&b, "ssh-ed25519");
+	buffer_put_string(&b, sig, smlen - datalen);
+	len = buffer_len(&b);
+	if (lenp != NULL)
+		*lenp = len;
+	if (sigp != NULL) {
+		*sigp = xmalloc(len);
+		memcpy(*sigp, buffer_ptr(&b), len);
+	}
+	buffer_free(&b);
+	memset(sig, 's', smlen);
+	xfree(sig);
+	return 0;
+}
+
+int
+ssh_ed25519_verify(const Key *key, const u_char *signature, u_int signaturelen,
+    const u_char *data, u_int datalen)
+{
+	Buffer b;
+	char *ktype;
+	u_char *sigblob, *sm, *m;
+	unsigned long long smlen, mlen;
+	u_int len;
+	int rlen, ret;
+
+	if (key == NULL || key->type != KEY_ED25519 ||
+	    key->ed25519_pk == NULL) {
+		error("%s: no ED25519 key", __func__);
+		return -1;
+	}
+	buffer_init(&b);
+	buffer_append(&b, signature, signaturelen);
+	if ((ktype = buffer_get_string_ret(&b, NULL)) == NULL ||
+	    strcmp("ssh-ed25519", ktype) != 0) {
+		error("%s: cannot handle type %s", __func__,
+		    ktype == NULL ? "(null)" : ktype);
+		buffer_free(&b);
+		if (ktype != NULL)
+			xfree(ktype);
+		return -1;
+	}
+	xfree(ktype);
+	sigblob = buffer_get_string_ret(&b, &len);
+	rlen = buffer_len(&b);
+	buffer_free(&b);
+	if (sigblob == NULL) {
+		error("%s: can't read signature", __func__);
+		return -1;
+	}
+	if (rlen != 0) {
+		error("%s: remaining bytes in signature %d", __func__, rlen);
+		xfree(sigblob);
+		return -1;
+	}
+	if (len != ED25519_SIG_SZ) {
+		error("%s: bad signature length %u", __func__, len);
+		xfree(sigblob);
+		return -1;
+	}
+	/* the reference interface wants signature || message */
+	smlen = len + datalen;
+	sm = xmalloc(smlen);
+	memcpy(sm, sigblob, len);
+	memcpy(sm + len, data, datalen);
+	m = xmalloc(smlen);
+	ret = crypto_sign_ed25519_open(m, &mlen, sm, smlen,
+	    key->ed25519_pk) == 0 ? 1 : 0;
+	memset(sm, 0, smlen);
+	memset(m, 0, smlen);
+	xfree(sm);
+	xfree(m);
+	xfree(sigblob);
+
+	debug("%s: signature %s", __func__, ret == 1 ? "correct" : "incorrect");
+	return ret;
+}
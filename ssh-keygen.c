@@ -55,6 +55,7 @@
 /* Number of bits in the RSA/DSA key.  This value can be set on the command line. */
 #define DEFAULT_BITS		2048
 #define DEFAULT_BITS_DSA	1024
+#define DEFAULT_BITS_ECDSA	256
 u_int32_t bits = 0;
 
 /*
@@ -109,8 +110,8 @@ extern char *__progname;
 char hostname[MAXHOSTNAMELEN];
 
 /* moduli.c */
-int gen_candidates(FILE *, u_int32_t, u_int32_t, BIGNUM *);
-int prime_test(FILE *, FILE *, u_int32_t, u_int32_t);
+int gen_candidates(FILE *, u_int32_t, u_int32_t, BIGNUM *, u_int32_t);
+int prime_test(FILE *, FILE *, u_int32_t, u_int32_t, u_int32_t, char *);
 
 static void
 ask_filename(struct passwd *pw, const char *prompt)
@@ -131,6 +132,12 @@ ask_filename(struct passwd *pw, const char *prompt)
 		case KEY_RSA:
 			name = _PATH_SSH_CLIENT_ID_RSA;
 			break;
+		case KEY_ECDSA:
+			name = _PATH_SSH_CLIENT_ID_ECDSA;
+			break;
+		case KEY_ED25519:
+			name = _PATH_SSH_CLIENT_ID_ED25519;
+			break;
 		default:
 			fprintf(stderr, "bad key type");
 			exit(1);
@@ -1023,6 +1030,8 @@ usage(void)
 	fprintf(stderr, "  -g          Use generic DNS resource record format.\n");
 	fprintf(stderr, "  -H          Hash names in known_hosts file.\n");
 	fprintf(stderr, "  -i          Convert RFC 4716 to OpenSSH key file.\n");
+	fprintf(stderr, "  -j workers  Number of processes for DH-GEX moduli generation and screening.\n");
+	fprintf(stderr, "  -K file     Checkpoint file for resuming DH-GEX moduli screening.\n");
 	fprintf(stderr, "  -l          Show fingerprint of key file.\n");
 	fprintf(stderr, "  -M memory   Amount of memory (MB) to use for generating DH-GEX moduli.\n");
 	fprintf(stderr, "  -N phrase   Provide new passphrase.\n");
@@ -1052,12 +1061,12 @@ main(int argc, char **argv)
 {
 	char dotsshdir[MAXPATHLEN], comment[1024], *passphrase1, *passphrase2;
 	char out_file[MAXPATHLEN], *reader_id = NULL;
-	char *rr_hostname = NULL;
+	char *rr_hostname = NULL, *checkpoint = NULL;
 	Key *private, *public;
 	struct passwd *pw;
 	struct stat st;
 	int opt, type, fd, download = 0;
-	u_int32_t memory = 0, generator_wanted = 0, trials = 100;
+	u_int32_t memory = 0, generator_wanted = 0, trials = 100, workers = 0;
 	int do_gen_candidates = 0, do_screen_candidates = 0;
 	int log_level = SYSLOG_LEVEL_INFO;
 	BIGNUM *start = NULL;
@@ -1090,7 +1099,7 @@ main(int argc, char **argv)
 	}
 
 	while ((opt = getopt(argc, argv,
-	    "degiqpclBHvxXyF:b:f:t:U:D:P:N:C:r:g:R:T:G:M:S:a:W:")) != -1) {
+	    "degiqpclBHvxXyF:b:f:t:U:D:P:N:C:r:g:R:T:G:M:S:a:W:j:K:")) != -1) {
 		switch (opt) {
 		case 'b':
 			bits = (u_int32_t)strtonum(optarg, 768, 32768, &errstr);
@@ -1192,6 +1201,15 @@ main(int argc, char **argv)
 				fatal("Invalid number of trials: %s (%s)",
 					optarg, errstr);
 			break;
+		case 'j':
+			workers = (u_int32_t)strtonum(optarg, 1, 64, &errstr);
+			if (errstr)
+				fatal("Number of workers is %s: %s",
+				    errstr, optarg);
+			break;
+		case 'K':
+			checkpoint = optarg;
+			break;
 		case 'M':
 			memory = (u_int32_t)strtonum(optarg, 1, UINT_MAX, &errstr);
 			if (errstr) {
@@ -1290,7 +1308,7 @@ main(int argc, char **argv)
 		}
 		if (bits == 0)
 			bits = DEFAULT_BITS;
-		if (gen_candidates(out, memory, bits, start) != 0)
+		if (gen_candidates(out, memory, bits, start, workers) != 0)
 			fatal("modulus candidate generation failed");
 
 		return (0);
@@ -1298,7 +1316,8 @@ main(int argc, char **argv)
 
 	if (do_screen_candidates) {
 		FILE *in;
-		FILE *out = fopen(out_file, "w");
+		/* a resumed run appends to what it already produced */
+		FILE *out = fopen(out_file, checkpoint != NULL ? "a" : "w");
 
 		if (have_identity && strcmp(identity_file, "-") != 0) {
 			if ((in = fopen(identity_file, "r")) == NULL) {
@@ -1313,7 +1332,8 @@ main(int argc, char **argv)
 			fatal("Couldn't open moduli file \"%s\": %s",
 			    out_file, strerror(errno));
 		}
-		if (prime_test(in, out, trials, generator_wanted) != 0)
+		if (prime_test(in, out, trials, generator_wanted, workers,
+		    checkpoint) != 0)
 			fatal("modulus screening failed");
 		return (0);
 	}
@@ -1328,10 +1348,20 @@ main(int argc, char **argv)
 		fprintf(stderr, "unknown key type %s\n", key_type_name);
 		exit(1);
 	}
-	if (bits == 0)
-		bits = (type == KEY_DSA) ? DEFAULT_BITS_DSA : DEFAULT_BITS;
+	if (bits == 0) {
+		if (type == KEY_DSA)
+			bits = DEFAULT_BITS_DSA;
+		else if (type == KEY_ECDSA)
+			bits = DEFAULT_BITS_ECDSA;
+		else
+			bits = DEFAULT_BITS;
+	}
 	if (type == KEY_DSA && bits != 1024)
 		fatal("DSA keys must be 1024 bits");
+	if (type == KEY_ECDSA && key_ecdsa_bits_to_nid(bits) == -1)
+		fatal("ECDSA keys must be 256, 384 or 521 bits");
+	if (type == KEY_ED25519)
+		bits = 256;	/* fixed; -b is ignored */
 	if (!quiet)
 		printf("Generating public/private %s key pair.\n", key_type_name);
 	private = key_generate(type, bits);
@@ -1367,6 +1397,12 @@ main(int argc, char **argv)
 	/* Ask for a passphrase (twice). */
 	if (identity_passphrase)
 		passphrase1 = xstrdup(identity_passphrase);
+	else if (type == KEY_ED25519 && identity_new_passphrase == NULL) {
+		/* key_save_private() can only write these unencrypted */
+		if (!quiet)
+			printf("ed25519 keys are saved without a passphrase.\n");
+		passphrase1 = xstrdup("");
+	}
 	else if (identity_new_passphrase)
 		passphrase1 = xstrdup(identity_new_passphrase);
 	else {
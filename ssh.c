@@ -97,12 +97,14 @@
 #include "misc.h"
 #include "kex.h"
 #include "mac.h"
+#include "algspeed.h"
 #include "sshpty.h"
 #include "match.h"
 #include "msg.h"
 #include "monitor_fdpass.h"
 #include "uidswap.h"
 #include "version.h"
+#include "conntrace.h"
 #if defined(_TOH_) && defined(USE_PAGEANT)
 #include "auth-pageant.h"
 #endif /* _TOH_ & USE_PAGEANT */
@@ -182,6 +184,9 @@ int subsystem_flag = 0;
 /* # of replies received for global requests */
 static int client_global_request_id = 0;
 
+/* conntrace handle for the remote forwarding replies */
+static int remote_fwd_trace = -1;
+
 /* pid of proxycommand child process */
 pid_t proxy_command_pid = 0;
 
@@ -433,7 +438,8 @@ main()
 			}
 			break;
 		case 'c':
-			if (ciphers_valid(optarg)) {
+			if (strcmp(optarg, ALGSPEED_AUTO_FAST) == 0 ||
+			    ciphers_valid(optarg)) {
 				/* SSH2 only */
 				options.ciphers = xstrdup(optarg);
 				options.cipher = SSH_CIPHER_INVALID;
@@ -455,7 +461,8 @@ main()
 			}
 			break;
 		case 'm':
-			if (mac_valid(optarg))
+			if (strcmp(optarg, ALGSPEED_AUTO_FAST) == 0 ||
+			    mac_valid(optarg))
 				options.macs = xstrdup(optarg);
 			else {
 				fprintf(stderr, "Unknown mac type '%s'\n",
@@ -751,6 +758,8 @@ main()
 		control_client(options.control_path);
 #endif  /* _TOH_ */
 
+	conntrace_init(options.connect_trace);
+
 	/* Open a connection to the remote host. */
 	if (ssh_connect(host, &hostaddr, options.port,
 	    options.address_family, options.connection_attempts,
@@ -917,7 +926,9 @@ static void
 ssh_init_forwarding(void)
 {
 	int success = 0;
-	int i;
+	int i, trace;
+
+	trace = conntrace_start("forward setup");
 
 	/* Initiate local TCP/IP port forwardings. */
 	for (i = 0; i < options.num_local_forwards; i++) {
@@ -942,6 +953,8 @@ ssh_init_forwarding(void)
 		error("Could not request local forwarding.");
 
 	/* Initiate remote TCP/IP port forwardings. */
+	if (compat20 && options.num_remote_forwards > 0)
+		remote_fwd_trace = conntrace_start("remote forward replies");
 	for (i = 0; i < options.num_remote_forwards; i++) {
 		debug("Remote connections from %.200s:%d forwarded to "
 		    "local address %.200s:%d",
@@ -975,6 +988,7 @@ ssh_init_forwarding(void)
 		}
 	}			
 #endif /* _TOH_ */
+	conntrace_stop(trace);
 }
 
 static void
@@ -1160,6 +1174,8 @@ client_global_request_reply_fwd(int type, u_int32_t seq, void *ctxt)
 	i = client_global_request_id++;
 	if (i >= options.num_remote_forwards)
 		return;
+	if (i == options.num_remote_forwards - 1)
+		conntrace_stop(remote_fwd_trace);
 	debug("remote forward %s for: listen %d, connect %s:%d",
 	    type == SSH2_MSG_REQUEST_SUCCESS ? "success" : "failure",
 	    options.remote_forwards[i].listen_port,
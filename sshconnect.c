@@ -57,6 +57,7 @@
 #include "misc.h"
 #include "dns.h"
 #include "version.h"
+#include "conntrace.h"
 
 #ifdef _TOH_
 extern HWND g_hWnd;
@@ -390,7 +391,7 @@ ssh_connect(const char *host, struct sockaddr_storage * hostaddr,
 {
 	int gaierr;
 	int on = 1;
-	int sock = -1, attempt;
+	int sock = -1, attempt, trace;
 	char ntop[NI_MAXHOST], strport[NI_MAXSERV];
 	struct addrinfo hints, *ai, *aitop;
 
@@ -398,8 +399,12 @@ ssh_connect(const char *host, struct sockaddr_storage * hostaddr,
 
 	/* If a proxy command is given, connect using it. */
 #if !defined(_TOH_) || defined(_PFPROXY_)
-	if (proxy_command != NULL)
-		return ssh_proxy_connect(host, port, proxy_command);
+	if (proxy_command != NULL) {
+		trace = conntrace_start("proxy command");
+		gaierr = ssh_proxy_connect(host, port, proxy_command);
+		conntrace_stop(trace);
+		return gaierr;
+	}
 #endif /* !_TOH_ || _PFPROXY */
 
 	/* No proxy command. */
@@ -408,9 +413,11 @@ ssh_connect(const char *host, struct sockaddr_storage * hostaddr,
 	hints.ai_family = family;
 	hints.ai_socktype = SOCK_STREAM;
 	snprintf(strport, sizeof strport, "%u", port);
+	trace = conntrace_start("resolve %.32s", host);
 	if ((gaierr = getaddrinfo(host, strport, &hints, &aitop)) != 0)
 		fatal("%s: %.100s: %s", __progname, host,
 		    gai_strerror(gaierr));
+	conntrace_stop(trace);
 
 	for (attempt = 0; attempt < connection_attempts; attempt++) {
 		if (attempt > 0) {
@@ -440,12 +447,15 @@ ssh_connect(const char *host, struct sockaddr_storage * hostaddr,
 				/* Any error is already output */
 				continue;
 
+			trace = conntrace_start("connect %.32s", ntop);
 			if (timeout_connect(sock, ai->ai_addr, ai->ai_addrlen,
 			    options.connection_timeout) >= 0) {
 				/* Successful connection. */
+				conntrace_stop(trace);
 				memcpy(hostaddr, ai->ai_addr, ai->ai_addrlen);
 				break;
 			} else {
+				conntrace_stop(trace);
 				debug("connect to address %s port %s: %s",
 				    ntop, strport, strerror(errno));
 				close(sock);
@@ -488,35 +498,21 @@ ssh_exchange_identification(void)
 {
 	char buf[256], remote_version[256];	/* must be same size! */
 	int remote_major, remote_minor, mismatch;
-	int connection_in = packet_get_connection_in();
-	int connection_out = packet_get_connection_out();
 	int minor1 = PROTOCOL_MINOR_1;
-	u_int i, n;
+	int len;
+	u_int n;
 
 	/* Read other side's version identification. */
 	for (n = 0;;) {
-		for (i = 0; i < sizeof(buf) - 1; i++) {
-			size_t len = atomicio(read, connection_in, &buf[i], 1);
-
-			if (len != 1 && errno == EPIPE)
-				fatal("ssh_exchange_identification: Connection closed by remote host");
-			else if (len != 1)
-				fatal("ssh_exchange_identification: read: %.100s", strerror(errno));
-			if (buf[i] == '\r') {
-				buf[i] = '\n';
-				buf[i + 1] = 0;
-				continue;		/**XXX wait for \n */
-			}
-			if (buf[i] == '\n') {
-				buf[i + 1] = 0;
-				break;
-			}
-			if (++n > 65536)
-				fatal("ssh_exchange_identification: No banner received");
-		}
-		buf[sizeof(buf) - 1] = 0;
+		len = packet_read_ident(buf, sizeof(buf));
+		if (len == 0)
+			fatal("ssh_exchange_identification: Connection closed by remote host");
+		else if (len < 0)
+			fatal("ssh_exchange_identification: read: %.100s", strerror(errno));
 		if (strncmp(buf, "SSH-", 4) == 0)
 			break;
+		if ((n += len) > 65536)
+			fatal("ssh_exchange_identification: No banner received");
 		debug("ssh_exchange_identification: %s", buf);
 	}
 	server_version_string = xstrdup(buf);
@@ -577,8 +573,13 @@ ssh_exchange_identification(void)
 	    compat20 ? PROTOCOL_MAJOR_2 : PROTOCOL_MAJOR_1,
 	    compat20 ? PROTOCOL_MINOR_2 : minor1,
 	    SSH_VERSION);
-	if (atomicio(vwrite, connection_out, buf, strlen(buf)) != strlen(buf))
-		fatal("write: %.100s", strerror(errno));
+	/*
+	 * Protocol 2 sends it in the same write as the first KEXINIT; a
+	 * protocol 1 server has to see it before it says anything more.
+	 */
+	packet_send_ident(buf);
+	if (!compat20)
+		packet_write_wait();
 	client_version_string = xstrdup(buf);
 	chop(client_version_string);
 	chop(server_version_string);
@@ -1038,8 +1039,8 @@ fail:
 }
 
 /* returns 0 if key verifies or -1 if key does NOT verify */
-int
-verify_host_key(char *host, struct sockaddr *hostaddr, Key *host_key)
+static int
+verify_host_key_files(char *host, struct sockaddr *hostaddr, Key *host_key)
 {
 	struct stat st;
 	int flags = 0;
@@ -1078,6 +1079,18 @@ verify_host_key(char *host, struct sockaddr *hostaddr, Key *host_key)
 	    RDRW, options.user_hostfile, options.system_hostfile);
 }
 
+/* returns 0 if key verifies or -1 if key does NOT verify */
+int
+verify_host_key(char *host, struct sockaddr *hostaddr, Key *host_key)
+{
+	int r, trace;
+
+	trace = conntrace_start("host key verification");
+	r = verify_host_key_files(host, hostaddr, host_key);
+	conntrace_stop(trace);
+	return r;
+}
+
 /*
  * Starts a dialog with the server, and authenticates the current user on the
  * server.  This does not need any extra privileges.  The basic connection
@@ -1095,6 +1108,7 @@ ssh_login(Sensitive *sensitive, const char *orighost,
 {
 	char *host, *cp;
 	char *server_user, *local_user;
+	int trace;
 
 #ifndef _TOH_
 	local_user = xstrdup(pw->pw_name);
@@ -1110,7 +1124,9 @@ ssh_login(Sensitive *sensitive, const char *orighost,
 			*cp = (char)tolower(*cp);
 
 	/* Exchange protocol version identification strings with the server. */
+	trace = conntrace_start("banner exchange");
 	ssh_exchange_identification();
+	conntrace_stop(trace);
 
 	/* Put the connection into non-blocking mode. */
 	packet_set_nonblocking();
@@ -1171,7 +1187,7 @@ show_key_from_file(const char *file, const char *host, int keytype)
 static int
 show_other_keys(const char *host, Key *key)
 {
-	int type[] = { KEY_RSA1, KEY_RSA, KEY_DSA, -1};
+	int type[] = { KEY_RSA1, KEY_RSA, KEY_DSA, KEY_ECDSA, KEY_ED25519, -1};
 	int i, found = 0;
 
 	for (i = 0; type[i] != -1; i++) {
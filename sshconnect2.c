@@ -64,6 +64,9 @@
 #include "msg.h"
 #include "pathnames.h"
 #include "uidswap.h"
+#include "algspeed.h"
+#include "hostfile.h"
+#include "conntrace.h"
 
 #ifdef GSSAPI
 #include "ssh-gss.h"
@@ -73,6 +76,7 @@
 extern char *client_version_string;
 extern char *server_version_string;
 extern Options options;
+extern uid_t original_real_uid;
 
 /*
  * SSH2 key exchange
@@ -94,10 +98,75 @@ verify_host_key_callback(Key *hostkey)
 	return 0;
 }
 
+/*
+ * Moves the host key algorithms we already have a known_hosts entry for to
+ * the front of the default list, so that offering the cheaper ECDSA and
+ * Ed25519 keys first does not make an already known host look new.
+ */
+static char *
+order_hostkeyalgs(char *host)
+{
+	const char *files[4];
+	char *oavail, *avail, *alg, *hostname, *ret;
+	Buffer known, unknown;
+	Buffer *b;
+	Key *found;
+	int i, type, nid, have;
+
+	files[0] = options.user_hostfile2;
+	files[1] = options.system_hostfile2;
+	files[2] = options.user_hostfile;
+	files[3] = options.system_hostfile;
+	if (options.host_key_alias != NULL)
+		hostname = xstrdup(options.host_key_alias);
+	else
+		hostname = put_host_port(host, options.port);
+
+	buffer_init(&known);
+	buffer_init(&unknown);
+	oavail = avail = xstrdup(KEX_DEFAULT_PK_ALG);
+	while ((alg = strsep(&avail, ",")) != NULL && *alg != '\0') {
+		if ((type = key_type_from_name(alg)) == KEY_UNSPEC)
+			continue;
+		/* an ECDSA entry only vouches for its own curve */
+		nid = -1;
+		if (type == KEY_ECDSA && strncmp(alg, "ecdsa-sha2-", 11) == 0)
+			nid = key_curve_name_to_nid(alg + 11);
+		have = 0;
+		for (i = 0; i < 4 && !have &&
+		    (type != KEY_ECDSA || nid != -1); i++) {
+			found = key_new(type);
+			if (type == KEY_ECDSA)
+				have = lookup_ecdsa_key_in_hostfile(files[i],
+				    hostname, nid, found, NULL);
+			else
+				have = lookup_key_in_hostfile_by_type(files[i],
+				    hostname, type, found, NULL);
+			key_free(found);
+		}
+		b = have ? &known : &unknown;
+		if (buffer_len(b) > 0)
+			buffer_append(b, ",", 1);
+		buffer_append(b, alg, strlen(alg));
+	}
+	if (buffer_len(&known) > 0 && buffer_len(&unknown) > 0)
+		buffer_append(&known, ",", 1);
+	buffer_append(&known, buffer_ptr(&unknown), buffer_len(&unknown));
+	buffer_append(&known, "\0", 1);
+	ret = xstrdup(buffer_ptr(&known));
+	buffer_free(&known);
+	buffer_free(&unknown);
+	xfree(oavail);
+	xfree(hostname);
+	debug3("%s: prefer hostkeyalgs: %s", __func__, ret);
+	return ret;
+}
+
 void
 ssh_kex2(char *host, struct sockaddr *hostaddr)
 {
 	Kex *kex;
+	char *speedfile, *hkalgs = NULL;
 
 	xxx_host = host;
 	xxx_hostaddr = hostaddr;
@@ -106,6 +175,17 @@ ssh_kex2(char *host, struct sockaddr *hostaddr)
 		logit("No valid ciphers for protocol version 2 given, using defaults.");
 		options.ciphers = NULL;
 	}
+	speedfile = tilde_expand_filename(_PATH_SSH_USER_ALGSPEED,
+	    original_real_uid);
+	if (options.ciphers != NULL &&
+	    strcmp(options.ciphers, ALGSPEED_AUTO_FAST) == 0)
+		options.ciphers = algspeed_order(ALGSPEED_CIPHER,
+		    KEX_AUTOFAST_ENCRYPT, speedfile);
+	if (options.macs != NULL &&
+	    strcmp(options.macs, ALGSPEED_AUTO_FAST) == 0)
+		options.macs = algspeed_order(ALGSPEED_MAC,
+		    KEX_AUTOFAST_MAC, speedfile);
+	xfree(speedfile);
 	if (options.ciphers != NULL) {
 		myproposal[PROPOSAL_ENC_ALGS_CTOS] =
 		myproposal[PROPOSAL_ENC_ALGS_STOC] = options.ciphers;
@@ -116,10 +196,13 @@ ssh_kex2(char *host, struct sockaddr *hostaddr)
 	    compat_cipher_proposal(myproposal[PROPOSAL_ENC_ALGS_STOC]);
 	if (options.compression) {
 		myproposal[PROPOSAL_COMP_ALGS_CTOS] =
-		myproposal[PROPOSAL_COMP_ALGS_STOC] = "zlib@openssh.com,zlib,none";
+		myproposal[PROPOSAL_COMP_ALGS_STOC] =
+		    KEX_ZSTD_COMP "zlib@openssh.com,zlib,none";
+		packet_set_compression_level(options.compression_level);
 	} else {
 		myproposal[PROPOSAL_COMP_ALGS_CTOS] =
-		myproposal[PROPOSAL_COMP_ALGS_STOC] = "none,zlib@openssh.com,zlib";
+		myproposal[PROPOSAL_COMP_ALGS_STOC] =
+		    "none," KEX_ZSTD_COMP "zlib@openssh.com,zlib";
 	}
 	if (options.macs != NULL) {
 		myproposal[PROPOSAL_MAC_ALGS_CTOS] =
@@ -128,16 +211,28 @@ ssh_kex2(char *host, struct sockaddr *hostaddr)
 	if (options.hostkeyalgorithms != NULL)
 		myproposal[PROPOSAL_SERVER_HOST_KEY_ALGS] =
 		    options.hostkeyalgorithms;
+	else
+		myproposal[PROPOSAL_SERVER_HOST_KEY_ALGS] = hkalgs =
+		    order_hostkeyalgs(host);
 
 	if (options.rekey_limit)
 		packet_set_rekey_limit(options.rekey_limit);
 
 	/* start key exchange */
 	kex = kex_setup(myproposal);
+	if (hkalgs != NULL) {
+		/* kex_setup() has copied the proposal */
+		myproposal[PROPOSAL_SERVER_HOST_KEY_ALGS] = KEX_DEFAULT_PK_ALG;
+		xfree(hkalgs);
+	}
 	kex->kex[KEX_DH_GRP1_SHA1] = kexdh_client;
 	kex->kex[KEX_DH_GRP14_SHA1] = kexdh_client;
 	kex->kex[KEX_DH_GEX_SHA1] = kexgex_client;
 	kex->kex[KEX_DH_GEX_SHA256] = kexgex_client;
+	kex->kex[KEX_C25519_SHA256] = kexc25519_client;
+#ifdef OPENSSL_HAS_ECC
+	kex->kex[KEX_ECDH_SHA2] = kexecdh_client;
+#endif
 	kex->client_version_string=client_version_string;
 	kex->server_version_string=server_version_string;
 	kex->verify_host_key=&verify_host_key_callback;
@@ -174,9 +269,31 @@ struct identity {
 	char	*filename;		/* comment for agent-only keys */
 	int	tried;
 	int	isprivate;		/* key points to the private key */
+	int	pk_ok;			/* accepted, not yet signed with */
 };
 TAILQ_HEAD(idlist, identity);
 
+/*
+ * Publickey queries are pipelined: queries for several identities are
+ * sent at once and the server answers them in order.  Each outstanding
+ * publickey request is queued so replies can be matched to it.  Once a
+ * key is accepted the queries after it are stale; their replies are
+ * consumed without acting on them.
+ *
+ * Every rejected query counts against the server's MaxAuthTries, so the
+ * number of failures received plus requests in flight is kept within
+ * sshd's default limit; beyond that, keys are offered one at a time.
+ */
+#define PUBKEY_PROBE_BUDGET	6
+#define PUBKEY_QUEUE_MAX	(2 * PUBKEY_PROBE_BUDGET + 2)
+
+enum pk_request { PK_PROBE, PK_STALE, PK_SIGNED };
+
+struct pk_pending {
+	enum pk_request type;
+	Identity *id;
+};
+
 struct Authctxt {
 	const char *server_user;
 	const char *local_user;
@@ -188,6 +305,10 @@ struct Authctxt {
 	/* pubkey */
 	Idlist keys;
 	AuthenticationConnection *agent;
+	struct pk_pending pk_queue[PUBKEY_QUEUE_MAX];
+	u_int pk_head, pk_len;
+	int failures;
+	int trace;		/* conntrace handle of the current attempt */
 	/* hostbased */
 	Sensitive *sensitive;
 	/* kbd-interactive */
@@ -229,6 +350,7 @@ void	input_gssapi_errtok(int, u_int32_t, void *);
 void	userauth(Authctxt *, char *);
 
 static int sign_and_send_pubkey(Authctxt *, Identity *);
+static int send_pubkey_test(Authctxt *, Identity *);
 static void pubkey_prepare(Authctxt *);
 static void pubkey_cleanup(Authctxt *);
 static Key *load_identity_file(char *);
@@ -274,11 +396,12 @@ ssh_userauth2(const char *local_user, const char *server_user, char *host,
     Sensitive *sensitive)
 {
 	Authctxt authctxt;
-	int type;
+	int type, trace;
 
 	if (options.challenge_response_authentication)
 		options.kbd_interactive_authentication = 1;
 
+	trace = conntrace_start("auth service request");
 	packet_start(SSH2_MSG_SERVICE_REQUEST);
 	packet_put_cstring("ssh-userauth");
 	packet_send();
@@ -296,6 +419,7 @@ ssh_userauth2(const char *local_user, const char *server_user, char *host,
 	}
 	packet_check_eom();
 	debug("SSH2_MSG_SERVICE_ACCEPT received");
+	conntrace_stop(trace);
 
 	if (options.preferred_authentications == NULL)
 		options.preferred_authentications = authmethods_get();
@@ -317,6 +441,7 @@ ssh_userauth2(const char *local_user, const char *server_user, char *host,
 		fatal("ssh_userauth2: internal error: cannot send userauth none request");
 
 	/* initial userauth request */
+	authctxt.trace = conntrace_start("auth none");
 	userauth_none(&authctxt);
 
 	dispatch_init(&input_userauth_error);
@@ -324,6 +449,7 @@ ssh_userauth2(const char *local_user, const char *server_user, char *host,
 	dispatch_set(SSH2_MSG_USERAUTH_FAILURE, &input_userauth_failure);
 	dispatch_set(SSH2_MSG_USERAUTH_BANNER, &input_userauth_banner);
 	dispatch_run(DISPATCH_BLOCK, &authctxt.success, &authctxt);	/* loop until success */
+	conntrace_stop(authctxt.trace);
 
 	pubkey_cleanup(&authctxt);
 	dispatch_range(SSH2_MSG_USERAUTH_MIN, SSH2_MSG_USERAUTH_MAX, NULL);
@@ -356,6 +482,8 @@ userauth(Authctxt *authctxt, char *authlist)
 		    SSH2_MSG_USERAUTH_PER_METHOD_MAX, NULL);
 
 		/* and try new method */
+		conntrace_stop(authctxt->trace);
+		authctxt->trace = conntrace_start("auth %s", method->name);
 		if (method->userauth(authctxt) != 0) {
 			debug2("we sent a %s packet, wait for reply", method->name);
 			break;
@@ -404,6 +532,57 @@ input_userauth_success(int type, u_int32_t seq, void *ctxt)
 	authctxt->success = 1;			/* break out */
 }
 
+static void
+pk_push(Authctxt *authctxt, enum pk_request type, Identity *id)
+{
+	struct pk_pending *pk;
+
+	if (authctxt->pk_len >= PUBKEY_QUEUE_MAX)
+		fatal("%s: too many pending publickey requests", __func__);
+	pk = &authctxt->pk_queue[(authctxt->pk_head + authctxt->pk_len) %
+	    PUBKEY_QUEUE_MAX];
+	pk->type = type;
+	pk->id = id;
+	authctxt->pk_len++;
+}
+
+/*
+ * Take the oldest pending publickey request off the queue for a FAILURE
+ * (key == NULL) or PK_OK reply.  Returns the pending request it
+ * answered.  Returns 0 if the reply only retired a stale query and
+ * more replies are outstanding, so nothing should be sent yet.
+ */
+static int
+pk_reply(Authctxt *authctxt, Key *key)
+{
+	struct pk_pending pk;
+	u_int i;
+
+	pk = authctxt->pk_queue[authctxt->pk_head];
+	authctxt->pk_head = (authctxt->pk_head + 1) % PUBKEY_QUEUE_MAX;
+	authctxt->pk_len--;
+
+	if (pk.type == PK_STALE) {
+		if (key != NULL && key_equal(key, pk.id->key)) {
+			debug2("%s: stale query for %s accepted", __func__,
+			    pk.id->filename);
+			pk.id->pk_ok = 1;
+		}
+		return (authctxt->pk_len == 0 ? PK_STALE + 1 : 0);
+	}
+	if (pk.type == PK_PROBE && key != NULL) {
+		/* later queries are moot now that a key was accepted */
+		for (i = 0; i < authctxt->pk_len; i++) {
+			struct pk_pending *p = &authctxt->pk_queue[
+			    (authctxt->pk_head + i) % PUBKEY_QUEUE_MAX];
+
+			if (p->type == PK_PROBE)
+				p->type = PK_STALE;
+		}
+	}
+	return (pk.type + 1);
+}
+
 void
 input_userauth_failure(int type, u_int32_t seq, void *ctxt)
 {
@@ -418,10 +597,16 @@ input_userauth_failure(int type, u_int32_t seq, void *ctxt)
 	partial = packet_get_char();
 	packet_check_eom();
 
+	authctxt->failures++;
 	if (partial != 0)
 		logit("Authenticated with partial success.");
 	debug("Authentications that can continue: %s", authlist);
 
+	if (authctxt->pk_len > 0 && pk_reply(authctxt, NULL) == 0) {
+		/* reply to a stale query; more replies are on the way */
+		xfree(authlist);
+		return;
+	}
 	userauth(authctxt, authlist);
 }
 void
@@ -430,6 +615,7 @@ input_userauth_pk_ok(int type, u_int32_t seq, void *ctxt)
 	Authctxt *authctxt = ctxt;
 	Key *key = NULL;
 	Identity *id = NULL;
+	struct pk_pending pending;
 	Buffer b;
 	int pktype, sent = 0;
 	u_int alen, blen;
@@ -472,6 +658,31 @@ input_userauth_pk_ok(int type, u_int32_t seq, void *ctxt)
 	debug2("input_userauth_pk_ok: fp %s", fp);
 	xfree(fp);
 
+	if (authctxt->pk_len > 0) {
+		/* the reply is for the oldest pending query */
+		pending = authctxt->pk_queue[authctxt->pk_head];
+		if (pk_reply(authctxt, key) == 0) {
+			/* stale; more replies are on the way */
+			sent = 1;
+			goto done;
+		}
+		if (pending.type == PK_PROBE &&
+		    key_equal(key, pending.id->key)) {
+			if ((sent = sign_and_send_pubkey(authctxt,
+			    pending.id)) != 0)
+				pk_push(authctxt, PK_SIGNED, pending.id);
+		} else if (pending.type != PK_PROBE)
+			debug2("input_userauth_pk_ok: late reply for %s",
+			    pending.id->filename);
+		else
+			error("input_userauth_pk_ok: reply does not match "
+			    "query for %s", pending.id->filename);
+		/* wait for the remaining replies before going on */
+		if (!sent && authctxt->pk_len > 0)
+			sent = 1;
+		goto done;
+	}
+
 	/*
 	 * search keys in the reverse order, because last candidate has been
 	 * moved to the end of the queue.  this also avoids confusion by
@@ -1112,11 +1323,49 @@ int
 userauth_pubkey(Authctxt *authctxt)
 {
 	Identity *id;
-	int sent = 0;
+	int sent = 0, window;
+	u_int i;
 
+	/*
+	 * While a signed request or stale queries are outstanding, just
+	 * wait for their replies; queries alone can be topped up.
+	 */
+	for (i = 0; i < authctxt->pk_len; i++) {
+		if (authctxt->pk_queue[(authctxt->pk_head + i) %
+		    PUBKEY_QUEUE_MAX].type != PK_PROBE) {
+			dispatch_set(SSH2_MSG_USERAUTH_PK_OK,
+			    &input_userauth_pk_ok);
+			return (1);
+		}
+	}
+
+	/* a key accepted while its query was stale */
+	TAILQ_FOREACH(id, &authctxt->keys, next) {
+		if (id->pk_ok && authctxt->pk_len == 0) {
+			id->pk_ok = 0;
+			debug("Signing with accepted key: %s", id->filename);
+			if (sign_and_send_pubkey(authctxt, id)) {
+				pk_push(authctxt, PK_SIGNED, id);
+				return (1);
+			}
+		}
+	}
+
+	window = (datafellows & (SSH_BUG_PKAUTH|SSH_BUG_PKOK)) ? 1 :
+	    PUBKEY_PROBE_BUDGET - authctxt->failures;
 	while ((id = TAILQ_FIRST(&authctxt->keys))) {
-		if (id->tried++)
-			return (0);
+		if (id->tried)
+			break;
+		/*
+		 * keys without a public half have to be signed with
+		 * directly; never mix that with queries in flight.
+		 * Otherwise stay within the budget, but always allow
+		 * one query so keys are still offered one at a time.
+		 */
+		if (authctxt->pk_len > 0 &&
+		    (id->key == NULL || (int)authctxt->pk_len >= window))
+			break;
+		id->tried++;
 		/* move key to the end of the queue */
 		TAILQ_REMOVE(&authctxt->keys, id, next);
 		TAILQ_INSERT_TAIL(&authctxt->keys, id, next);
@@ -1127,7 +1376,8 @@ userauth_pubkey(Authctxt *authctxt)
 		 */
 		if (id->key && id->key->type != KEY_RSA1) {
 			debug("Offering public key: %s", id->filename);
-			sent = send_pubkey_test(authctxt, id);
+			if (send_pubkey_test(authctxt, id))
+				pk_push(authctxt, PK_PROBE, id);
 		} else if (id->key == NULL) {
 			debug("Trying private key: %s", id->filename);
 			id->key = load_identity_file(id->filename);
@@ -1137,11 +1387,16 @@ userauth_pubkey(Authctxt *authctxt)
 				key_free(id->key);
 				id->key = NULL;
 			}
+			if (sent)
+				return (sent);
 		}
-		if (sent)
-			return (sent);
 	}
-	return (0);
+	if (authctxt->pk_len == 0)
+		return (0);
+	if (authctxt->pk_len > 1)
+		debug2("%s: %u queries in flight", __func__, authctxt->pk_len);
+	dispatch_set(SSH2_MSG_USERAUTH_PK_OK, &input_userauth_pk_ok);
+	return (1);
 }
 
 /*
@@ -400,7 +400,6 @@ key_regeneration_alarm(int sig)
 static void
 sshd_exchange_identification(int sock_in, int sock_out)
 {
-	u_int i;
 	int mismatch;
 	int remote_major, remote_minor;
 	int major, minor;
@@ -431,27 +430,11 @@ sshd_exchange_identification(int sock_in, int sock_out)
 	}
 
 	/* Read other sides version identification. */
-	memset(buf, 0, sizeof(buf));
-	for (i = 0; i < sizeof(buf) - 1; i++) {
-		if (atomicio(read, sock_in, &buf[i], 1) != 1) {
-			logit("Did not receive identification string from %s",
-			    get_remote_ipaddr());
-			cleanup_exit(255);
-		}
-		if (buf[i] == '\r') {
-			buf[i] = 0;
-			/* Kludge for F-Secure Macintosh < 1.0.2 */
-			if (i == 12 &&
-			    strncmp(buf, "SSH-1.5-W1.0", 12) == 0)
-				break;
-			continue;
-		}
-		if (buf[i] == '\n') {
-			buf[i] = 0;
-			break;
-		}
+	if (packet_read_ident(buf, sizeof(buf)) <= 0) {
+		logit("Did not receive identification string from %s",
+		    get_remote_ipaddr());
+		cleanup_exit(255);
 	}
-	buf[sizeof(buf) - 1] = 0;
 	client_version_string = xstrdup(buf);
 
 	/*
@@ -713,7 +696,7 @@ list_hostkey_types(void)
 	Buffer b;
 	const char *p;
 	char *ret;
-	int i;
+	int i, have_ecdsa = 0;
 
 	buffer_init(&b);
 	for (i = 0; i < options.num_host_key_files; i++) {
@@ -721,8 +704,14 @@ list_hostkey_types(void)
 		if (key == NULL)
 			continue;
 		switch (key->type) {
+		case KEY_ECDSA:
+			/* get_hostkey_by_type() can only tell one apart */
+			if (have_ecdsa++)
+				break;
+			/* FALLTHROUGH */
 		case KEY_RSA:
 		case KEY_DSA:
+		case KEY_ED25519:
 			if (buffer_len(&b) > 0)
 				buffer_append(&b, ",", 1);
 			p = key_ssh_name(key);
@@ -828,6 +817,15 @@ send_rexec_state(int fd, Buffer *conf)
 	 *	bignum	iqmp			"
 	 *	bignum	p			"
 	 *	bignum	q			"
+	 *	u_int	moduli_loaded
+	 *	u_int	nmoduli		(only if moduli_loaded == 1)
+	 *	u_int	size		(repeated nmoduli times)
+	 *	bignum2	g			"
+	 *	bignum2	p			"
+	 *	u_int	dh_pool_slot	(repeated until slot is out of range)
+	 *	u_int	need			"
+	 *	bignum2	p			"
+	 *	bignum2	g			"
 	 *	string rngseed		(only if OpenSSL is not self-seeded)
 	 */
 	buffer_init(&m);
@@ -845,6 +843,9 @@ send_rexec_state(int fd, Buffer *conf)
 	} else
 		buffer_put_int(&m, 0);
 
+	dh_moduli_put(&m);
+	dh_pool_put(&m);
+
 #ifndef OPENSSL_PRNG_ONLY
 	rexec_send_rng_seed(&m);
 #endif
@@ -892,6 +893,9 @@ recv_rexec_state(int fd, Buffer *conf)
 		    sensitive_data.server_key->rsa);
 	}
 
+	dh_moduli_get(&m);
+	dh_pool_get(&m);
+
 #ifndef OPENSSL_PRNG_ONLY
 	rexec_recv_rng_seed(&m);
 #endif
@@ -1015,6 +1019,7 @@ server_accept_loop(int *sock_in, int *sock_out, int *newsock, int *config_s)
 	struct sockaddr_storage from;
 	socklen_t fromlen;
 	pid_t pid;
+	struct timeval tv, *tvp;
 
 	/* setup fd set for accept */
 	fdset = NULL;
@@ -1045,8 +1050,17 @@ server_accept_loop(int *sock_in, int *sock_out, int *newsock, int *config_s)
 			if (startup_pipes[i] != -1)
 				FD_SET(startup_pipes[i], fdset);
 
-		/* Wait in select until there is a connection. */
-		ret = select(maxfd+1, fdset, NULL, NULL, NULL);
+		/*
+		 * Wait in select until there is a connection.  While the
+		 * pool of DH keypairs is not full, only poll, and spend the
+		 * idle time precomputing keypairs for the next connections.
+		 */
+		tvp = NULL;
+		if ((options.protocol & SSH_PROTO_2) && !dh_pool_full()) {
+			tv.tv_sec = tv.tv_usec = 0;
+			tvp = &tv;
+		}
+		ret = select(maxfd+1, fdset, NULL, NULL, tvp);
 		if (ret < 0 && errno != EINTR)
 			error("select: %.100s", strerror(errno));
 		if (received_sigterm) {
@@ -1063,16 +1077,22 @@ server_accept_loop(int *sock_in, int *sock_out, int *newsock, int *config_s)
 		}
 		if (ret < 0)
 			continue;
+		if (ret == 0) {
+			dh_pool_fill();
+			continue;
+		}
 
 		for (i = 0; i < options.max_startups; i++)
 			if (startup_pipes[i] != -1 &&
 			    FD_ISSET(startup_pipes[i], fdset)) {
 				/*
-				 * the read end of the pipe is ready
-				 * if the child has closed the pipe
-				 * after successful authentication
-				 * or if the child has died
+				 * the pipe is readable if the child
+				 * asks for a DH keypair, has closed
+				 * the pipe after successful
+				 * authentication or has died
 				 */
+				if (dh_pool_serve(startup_pipes[i]) == 0)
+					continue;
 				close(startup_pipes[i]);
 				startup_pipes[i] = -1;
 				startups--;
@@ -1097,10 +1117,12 @@ server_accept_loop(int *sock_in, int *sock_out, int *newsock, int *config_s)
 				close(*newsock);
 				continue;
 			}
-			if (pipe(startup_p) == -1) {
+			if (socketpair(AF_UNIX, SOCK_STREAM, 0,
+			    startup_p) == -1) {
 				close(*newsock);
 				continue;
 			}
+			set_nonblock(startup_p[0]);
 
 			if (rexec_flag && socketpair(AF_UNIX,
 			    SOCK_STREAM, 0, config_s) == -1) {
@@ -1174,6 +1196,8 @@ server_accept_loop(int *sock_in, int *sock_out, int *newsock, int *config_s)
 				    log_stderr);
 				if (rexec_flag)
 					close(config_s[0]);
+				/* ask the listener for a keypair instead */
+				dh_pool_forget();
 				break;
 			}
 
@@ -1471,6 +1495,8 @@ main(int ac, char **av)
 			break;
 		case KEY_RSA:
 		case KEY_DSA:
+		case KEY_ECDSA:
+		case KEY_ED25519:
 			sensitive_data.have_ssh2_key = 1;
 			break;
 		}
@@ -1631,6 +1657,10 @@ main(int ac, char **av)
 			}
 		}
 
+		/* Parse the moduli once; children are handed the table */
+		if (options.protocol & SSH_PROTO_2)
+			dh_load_moduli();
+
 		/* Accept a connection and return in a forked child */
 		server_accept_loop(&sock_in, &sock_out,
 		    &newsock, config_s);
@@ -1694,6 +1724,9 @@ main(int ac, char **av)
 		    sock_in, sock_out, newsock, startup_pipe, config_s[0]);
 	}
 
+	/* Pooled DH keypairs are requested from the listener */
+	dh_pool_set_fd(startup_pipe);
+
 	/*
 	 * Disable the key regeneration alarm.  We will not regenerate the
 	 * key since we are no longer in a position to give it to anyone. We
@@ -1819,6 +1852,7 @@ main(int ac, char **av)
 	if (startup_pipe != -1) {
 		close(startup_pipe);
 		startup_pipe = -1;
+		dh_pool_set_fd(-1);
 	}
 
 #ifdef SSH_AUDIT_EVENTS
@@ -2112,8 +2146,10 @@ do_ssh2_kex(void)
 		myproposal[PROPOSAL_COMP_ALGS_STOC] = "none";
 	} else if (options.compression == COMP_DELAYED) {
 		myproposal[PROPOSAL_COMP_ALGS_CTOS] =
-		myproposal[PROPOSAL_COMP_ALGS_STOC] = "none,zlib@openssh.com";
+		myproposal[PROPOSAL_COMP_ALGS_STOC] =
+		    "none," KEX_ZSTD_COMP "zlib@openssh.com";
 	}
+	packet_set_compression_level(options.compression_level);
 
 	myproposal[PROPOSAL_SERVER_HOST_KEY_ALGS] = list_hostkey_types();
 
@@ -2123,6 +2159,10 @@ do_ssh2_kex(void)
 	kex->kex[KEX_DH_GRP14_SHA1] = kexdh_server;
 	kex->kex[KEX_DH_GEX_SHA1] = kexgex_server;
 	kex->kex[KEX_DH_GEX_SHA256] = kexgex_server;
+	kex->kex[KEX_C25519_SHA256] = kexc25519_server;
+#ifdef OPENSSL_HAS_ECC
+	kex->kex[KEX_ECDH_SHA2] = kexecdh_server;
+#endif
 	kex->server = 1;
 	kex->client_version_string=client_version_string;
 	kex->server_version_string=server_version_string;